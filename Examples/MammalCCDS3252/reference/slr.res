@@ -0,0 +1,718 @@
+Site	Neutral	Optimal	Omega	Lower	Upper	LrtStat	Pvalue	AdjPvalue	Qvalue	Result	Note
+1	4.32	3.39	0.0000	0.0000	2.2662	1.8537	1.7335e-01	9.7404e-01	9.7985e-03	      	Constant
+2	15.97	15.15	3.2747	0.4833	32.1001	1.6420	2.0006e-01	9.7404e-01	1.1242e-02	      	
+3	9.54	9.44	1.5603	0.1071	9.2558	0.1917	6.6153e-01	9.7404e-01	3.6016e-02	      	
+4	13.61	13.19	2.1606	0.3449	14.7907	0.8281	3.6281e-01	9.7404e-01	2.0240e-02	      	
+5	11.68	11.66	1.2235	0.0787	6.5062	0.0419	8.3790e-01	9.7404e-01	4.5107e-02	      	
+6	11.35	11.10	1.8209	0.2705	7.6281	0.5137	4.7354e-01	9.7404e-01	2.6265e-02	      	
+7	4.98	3.65	0.0000	0.0000	1.4777	2.6647	1.0260e-01	9.7404e-01	6.6056e-03	      	Constant
+8	11.81	11.63	1.6176	0.2515	6.8564	0.3506	5.5377e-01	9.7404e-01	3.0494e-02	      	
+9	7.23	7.18	0.7220	0.0399	3.6976	0.1086	7.4176e-01	9.7404e-01	4.0213e-02	      	
+10	14.84	14.48	3.0497	0.1638	28.5879	0.7060	4.0076e-01	9.7404e-01	2.2292e-02	      	
+11	17.39	15.61	9.7523	0.9103	99.0000	3.5444	5.9746e-02	9.7404e-01	6.1077e-03	      	
+12	9.69	9.59	1.4314	0.2272	5.5063	0.2075	6.4876e-01	9.7404e-01	3.5421e-02	      	
+13	8.68	8.56	0.6246	0.0350	3.0738	0.2447	6.2086e-01	9.7404e-01	3.4043e-02	      	
+14	4.53	3.36	0.0000	0.0000	1.7256	2.3393	1.2615e-01	9.7404e-01	7.5643e-03	      	Constant
+15	11.85	9.64	0.0000	0.0000	0.8672	4.4068	3.5796e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+16	6.14	4.76	0.0000	0.0000	1.4272	2.7608	9.6602e-02	9.7404e-01	6.3783e-03	      	Constant
+17	5.95	4.24	0.0000	0.0000	1.1282	3.4240	6.4256e-02	9.7404e-01	6.1077e-03	      	Constant
+18	10.98	9.78	0.0000	0.0000	1.6705	2.3939	1.2181e-01	9.7404e-01	7.4004e-03	      	Synonymous
+19	9.51	7.84	0.0000	0.0000	1.1605	3.3406	6.7589e-02	9.7404e-01	6.1077e-03	      	Synonymous
+20	5.37	3.88	0.0000	0.0000	1.3091	2.9799	8.4305e-02	9.7404e-01	6.1077e-03	      	Constant
+21	4.89	3.99	0.0000	0.0000	2.2874	1.7882	1.8115e-01	9.7404e-01	1.0224e-02	      	Constant
+22	7.58	6.30	0.0000	0.0000	1.5543	2.5516	1.1018e-01	9.7404e-01	6.8975e-03	      	Synonymous
+23	7.48	6.54	0.0000	0.0000	2.2164	1.8783	1.7052e-01	9.7404e-01	9.6529e-03	      	Synonymous
+24	5.41	4.07	0.0000	0.0000	1.4734	2.6767	1.0183e-01	9.7404e-01	6.5668e-03	      	Constant
+25	9.03	7.75	0.0000	0.0000	1.5512	2.5557	1.0990e-01	9.7404e-01	6.8908e-03	      	Synonymous
+26	4.53	3.36	0.0000	0.0000	1.7256	2.3393	1.2615e-01	9.7404e-01	7.5643e-03	      	Constant
+27	5.93	4.33	0.0000	0.0000	1.2205	3.1801	7.4542e-02	9.7404e-01	6.1077e-03	      	Constant
+28	8.52	5.33	0.0000	0.0000	0.5958	6.3663	1.1631e-02	9.7404e-01	6.1077e-03	-     	Constant
+29	5.94	4.07	0.0000	0.0000	1.0286	3.7396	5.3138e-02	9.7404e-01	6.1077e-03	      	Constant
+30	6.93	5.62	0.0000	0.0000	1.4967	2.6097	1.0621e-01	9.7404e-01	6.7802e-03	      	Constant
+31	12.70	10.11	0.0000	0.0000	0.7344	5.1826	2.2814e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+32	4.98	3.47	0.0000	0.0000	1.2990	3.0061	8.2950e-02	9.7404e-01	6.1077e-03	      	Constant
+33	8.17	6.41	0.0000	0.0000	1.0980	3.5135	6.0870e-02	9.7404e-01	6.1077e-03	      	Constant
+34	5.37	3.88	0.0000	0.0000	1.3091	2.9799	8.4305e-02	9.7404e-01	6.1077e-03	      	Constant
+35	4.92	3.51	0.0000	0.0000	1.3899	2.8269	9.2694e-02	9.7404e-01	6.3403e-03	      	Constant
+36	12.06	8.81	0.0000	0.0000	0.5833	6.5000	1.0788e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+37	8.50	7.53	0.0000	0.0000	2.1249	1.9432	1.6332e-01	9.7404e-01	9.2860e-03	      	Synonymous
+38	12.16	9.96	0.0000	0.0000	0.8677	4.3968	3.6006e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+39	7.67	6.79	0.0000	0.0000	2.2819	1.7595	1.8469e-01	9.7404e-01	1.0409e-02	      	Constant
+40	5.41	4.07	0.0000	0.0000	1.4734	2.6767	1.0183e-01	9.7404e-01	6.5668e-03	      	Constant
+41	4.48	3.23	0.0000	0.0000	1.5956	2.4981	1.1399e-01	9.7404e-01	7.0665e-03	      	Constant
+42	10.44	10.34	0.6558	0.0367	3.1226	0.1943	6.5933e-01	9.7404e-01	3.5947e-02	      	
+43	5.56	3.91	0.0000	0.0000	1.1703	3.3063	6.9017e-02	9.7404e-01	6.1077e-03	      	Constant
+44	5.13	3.68	0.0000	0.0000	1.3412	2.9113	8.7961e-02	9.7404e-01	6.1809e-03	      	Constant
+45	5.13	3.68	0.0000	0.0000	1.3412	2.9113	8.7961e-02	9.7404e-01	6.1809e-03	      	Constant
+46	5.13	3.68	0.0000	0.0000	1.3412	2.9113	8.7961e-02	9.7404e-01	6.1809e-03	      	Constant
+47	5.56	3.91	0.0000	0.0000	1.1703	3.3063	6.9017e-02	9.7404e-01	6.1077e-03	      	Constant
+48	8.02	6.20	0.0000	0.0000	1.0588	3.6374	5.6494e-02	9.7404e-01	6.1077e-03	      	Constant
+49	4.83	3.39	0.0000	0.0000	1.3584	2.8815	8.9603e-02	9.7404e-01	6.1943e-03	      	Constant
+50	5.18	3.51	0.0000	0.0000	1.1590	3.3386	6.7674e-02	9.7404e-01	6.1077e-03	      	Constant
+51	5.18	3.51	0.0000	0.0000	1.1590	3.3386	6.7674e-02	9.7404e-01	6.1077e-03	      	Constant
+52	6.21	4.77	0.0000	0.0000	1.3531	2.8884	8.9221e-02	9.7404e-01	6.1895e-03	      	Constant
+53	5.13	3.68	0.0000	0.0000	1.3412	2.9113	8.7961e-02	9.7404e-01	6.1809e-03	      	Constant
+54	8.90	7.57	0.0000	0.0000	1.4814	2.6557	1.0318e-01	9.7404e-01	6.6318e-03	      	Synonymous
+55	6.14	4.26	0.0000	0.0000	1.0188	3.7736	5.2068e-02	9.7404e-01	6.1077e-03	      	Constant
+56	6.14	4.26	0.0000	0.0000	1.0188	3.7736	5.2068e-02	9.7404e-01	6.1077e-03	      	Constant
+57	5.88	3.96	0.0000	0.0000	0.9963	3.8551	4.9596e-02	9.7404e-01	6.1077e-03	-     	Constant
+58	8.14	6.60	0.0000	0.0000	1.2675	3.0753	7.9488e-02	9.7404e-01	6.1077e-03	      	Synonymous
+59	7.88	6.34	0.0000	0.0000	1.2616	3.0896	7.8793e-02	9.7404e-01	6.1077e-03	      	Synonymous
+60	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+61	14.81	12.31	0.0000	0.0000	0.7593	5.0135	2.5151e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+62	9.98	8.15	0.0000	0.0000	1.0517	3.6626	5.5646e-02	9.7404e-01	6.1077e-03	      	Synonymous
+63	5.52	3.58	0.0000	0.0000	0.9860	3.8938	4.8463e-02	9.7404e-01	6.1077e-03	-     	Constant
+64	8.72	5.79	0.0000	0.0000	0.6484	5.8586	1.5501e-02	9.7404e-01	6.1077e-03	-     	Constant
+65	5.26	3.73	0.0000	0.0000	1.2728	3.0552	8.0478e-02	9.7404e-01	6.1077e-03	      	Constant
+66	5.88	3.96	0.0000	0.0000	0.9963	3.8551	4.9596e-02	9.7404e-01	6.1077e-03	-     	Constant
+67	13.94	12.21	0.0000	0.0000	1.1159	3.4585	6.2927e-02	9.7404e-01	6.1077e-03	      	Synonymous
+68	14.57	12.96	0.0000	0.0000	1.2043	3.2216	7.2673e-02	9.7404e-01	6.1077e-03	      	Synonymous
+69	9.48	5.29	0.0000	0.0000	0.4518	8.3953	3.7618e-03	9.7404e-01	6.1077e-03	--    	Constant
+70	5.41	3.72	0.0000	0.0000	1.1383	3.3956	6.5370e-02	9.7404e-01	6.1077e-03	      	Constant
+71	8.72	5.79	0.0000	0.0000	0.6484	5.8586	1.5501e-02	9.7404e-01	6.1077e-03	-     	Constant
+72	5.45	3.62	0.0000	0.0000	1.0518	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Constant
+73	5.42	4.12	0.0000	0.0000	1.5215	2.5995	1.0690e-01	9.7404e-01	6.7802e-03	      	Constant
+74	6.14	4.26	0.0000	0.0000	1.0188	3.7736	5.2068e-02	9.7404e-01	6.1077e-03	      	Constant
+75	6.14	4.26	0.0000	0.0000	1.0188	3.7736	5.2068e-02	9.7404e-01	6.1077e-03	      	Constant
+76	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+77	7.00	4.73	0.0000	0.0000	0.8450	4.5304	3.3297e-02	9.7404e-01	6.1077e-03	-     	Constant
+78	8.16	6.97	0.0000	0.0000	1.6651	2.3786	1.2301e-01	9.7404e-01	7.4575e-03	      	Synonymous
+79	8.85	6.99	0.0000	0.0000	1.0364	3.7119	5.4025e-02	9.7404e-01	6.1077e-03	      	Synonymous
+80	19.35	17.53	0.0000	0.0000	1.0588	3.6407	5.6383e-02	9.7404e-01	6.1077e-03	      	Synonymous
+81	7.19	5.70	0.0000	0.0000	1.3087	2.9762	8.4497e-02	9.7404e-01	6.1077e-03	      	Constant
+82	12.29	10.74	0.0000	0.0000	1.2535	3.1098	7.7824e-02	9.7404e-01	6.1077e-03	      	Synonymous
+83	9.37	7.57	0.0000	0.0000	1.0691	3.6049	5.7609e-02	9.7404e-01	6.1077e-03	      	Synonymous
+84	9.80	8.36	0.0000	0.0000	1.3528	2.8894	8.9167e-02	9.7404e-01	6.1895e-03	      	Synonymous
+85	5.60	3.73	0.0000	0.0000	1.0263	3.7472	5.2896e-02	9.7404e-01	6.1077e-03	      	Constant
+86	10.10	8.98	0.0000	0.0000	1.8036	2.2451	1.3404e-01	9.7404e-01	7.7941e-03	      	Synonymous
+87	14.61	14.56	1.2723	0.1991	4.8159	0.0943	7.5876e-01	9.7404e-01	4.0961e-02	      	
+88	9.46	8.34	0.0000	0.0000	1.8086	2.2394	1.3454e-01	9.7404e-01	7.8036e-03	      	Synonymous
+89	12.31	10.69	0.0000	0.0000	1.2017	3.2265	7.2456e-02	9.7404e-01	6.1077e-03	      	Synonymous
+90	11.22	11.13	0.6639	0.0369	3.2545	0.1795	6.7181e-01	9.7404e-01	3.6472e-02	      	
+91	5.41	3.72	0.0000	0.0000	1.1383	3.3956	6.5370e-02	9.7404e-01	6.1077e-03	      	Constant
+92	11.85	7.57	0.0000	0.0000	0.4434	8.5548	3.4461e-03	9.7404e-01	6.1077e-03	--    	Constant
+93	7.19	5.70	0.0000	0.0000	1.3087	2.9762	8.4497e-02	9.7404e-01	6.1077e-03	      	Constant
+94	11.10	9.16	0.0000	0.0000	0.9870	3.8900	4.8573e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+95	8.54	7.78	0.3529	0.0199	1.6240	1.5077	2.1950e-01	9.7404e-01	1.2298e-02	      	
+96	10.57	9.35	0.0000	0.0000	1.6357	2.4437	1.1800e-01	9.7404e-01	7.2566e-03	      	Synonymous
+97	17.59	17.18	0.4458	0.0250	2.1109	0.8147	3.6674e-01	9.7404e-01	2.0429e-02	      	
+98	10.07	8.44	0.0000	0.0000	1.1902	3.2640	7.0817e-02	9.7404e-01	6.1077e-03	      	Synonymous
+99	5.32	4.16	0.0000	0.0000	1.7085	2.3085	1.2867e-01	9.7404e-01	7.5855e-03	      	Constant
+100	7.97	6.79	0.0000	0.0000	1.7013	2.3617	1.2435e-01	9.7404e-01	7.4914e-03	      	Synonymous
+101	10.08	8.84	0.0000	0.0000	1.5982	2.4950	1.1421e-01	9.7404e-01	7.0689e-03	      	Synonymous
+102	8.62	7.18	0.0000	0.0000	1.3612	2.8730	9.0075e-02	9.7404e-01	6.2047e-03	      	Synonymous
+103	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+104	7.88	6.34	0.0000	0.0000	1.2616	3.0896	7.8793e-02	9.7404e-01	6.1077e-03	      	Synonymous
+105	6.54	4.48	0.0000	0.0000	0.9314	4.1141	4.2527e-02	9.7404e-01	6.1077e-03	-     	Constant
+106	17.26	15.14	0.0000	0.0000	0.9021	4.2336	3.9632e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+107	7.35	5.86	0.0000	0.0000	1.3001	2.9965	8.3443e-02	9.7404e-01	6.1077e-03	      	Constant
+108	5.45	3.62	0.0000	0.0000	1.0518	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Constant
+109	16.10	14.23	0.0000	0.0000	1.0284	3.7399	5.3126e-02	9.7404e-01	6.1077e-03	      	Synonymous
+110	9.61	7.59	0.0000	0.0000	0.9473	4.0463	4.4268e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+111	5.52	3.58	0.0000	0.0000	0.9860	3.8938	4.8463e-02	9.7404e-01	6.1077e-03	-     	Constant
+112	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+113	9.33	8.11	0.0000	0.0000	1.6223	2.4343	1.1871e-01	9.7404e-01	7.2853e-03	      	Synonymous
+114	5.99	4.25	0.0000	0.0000	1.1126	3.4696	6.2508e-02	9.7404e-01	6.1077e-03	      	Constant
+115	10.10	8.98	0.0000	0.0000	1.8036	2.2451	1.3404e-01	9.7404e-01	7.7941e-03	      	Synonymous
+116	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+117	5.41	3.72	0.0000	0.0000	1.1383	3.3956	6.5370e-02	9.7404e-01	6.1077e-03	      	Constant
+118	10.19	8.59	0.0000	0.0000	1.2156	3.1921	7.3994e-02	9.7404e-01	6.1077e-03	      	Synonymous
+119	6.28	5.17	0.0000	0.0000	1.8231	2.2109	1.3704e-01	9.7404e-01	7.8732e-03	      	Constant
+120	10.52	7.84	0.0000	0.0000	0.7092	5.3581	2.0626e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+121	8.45	7.00	0.0000	0.0000	1.3437	2.9043	8.8346e-02	9.7404e-01	6.1853e-03	      	Synonymous
+122	10.54	10.11	0.4408	0.0248	2.0664	0.8487	3.5692e-01	9.7404e-01	1.9940e-02	      	
+123	9.26	7.32	0.0000	0.0000	0.9868	3.8909	4.8547e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+124	8.34	6.50	0.0000	0.0000	1.0497	3.6679	5.5471e-02	9.7404e-01	6.1077e-03	      	Synonymous
+125	4.88	3.30	0.0000	0.0000	1.2333	3.1508	7.5890e-02	9.7404e-01	6.1077e-03	      	Constant
+126	6.63	4.40	0.0000	0.0000	0.8567	4.4689	3.4517e-02	9.7404e-01	6.1077e-03	-     	Constant
+127	4.91	3.43	0.0000	0.0000	1.3236	2.9523	8.5757e-02	9.7404e-01	6.1154e-03	      	Constant
+128	7.00	4.13	0.0000	0.0000	0.6619	5.7398	1.6585e-02	9.7404e-01	6.1077e-03	-     	Constant
+129	10.72	9.52	0.0000	0.0000	1.6612	2.4035	1.2106e-01	9.7404e-01	7.3860e-03	      	Synonymous
+130	5.46	3.56	0.0000	0.0000	1.0148	3.7877	5.1631e-02	9.7404e-01	6.1077e-03	      	Constant
+131	8.61	5.76	0.0000	0.0000	0.6665	5.7004	1.6961e-02	9.7404e-01	6.1077e-03	-     	Constant
+132	5.46	3.56	0.0000	0.0000	1.0148	3.7877	5.1631e-02	9.7404e-01	6.1077e-03	      	Constant
+133	9.97	8.57	0.0000	0.0000	1.3816	2.8176	9.3238e-02	9.7404e-01	6.3403e-03	      	Synonymous
+134	8.09	6.59	0.0000	0.0000	1.3061	2.9920	8.3676e-02	9.7404e-01	6.1077e-03	      	Synonymous
+135	16.00	13.54	0.0000	0.0000	0.7747	4.9155	2.6618e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+136	7.84	5.98	0.0000	0.0000	1.0350	3.7179	5.3831e-02	9.7404e-01	6.1077e-03	      	Synonymous
+137	10.47	8.71	0.0000	0.0000	1.0953	3.5225	6.0543e-02	9.7404e-01	6.1077e-03	      	Synonymous
+138	7.63	5.95	0.0000	0.0000	1.1458	3.3656	6.6573e-02	9.7404e-01	6.1077e-03	      	Constant
+139	6.14	4.26	0.0000	0.0000	1.0188	3.7736	5.2068e-02	9.7404e-01	6.1077e-03	      	Constant
+140	11.70	9.64	0.0000	0.0000	0.9277	4.1284	4.2170e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+141	7.84	6.32	0.0000	0.0000	1.2754	3.0492	8.0775e-02	9.7404e-01	6.1077e-03	      	Synonymous
+142	9.91	7.50	0.0000	0.0000	0.7921	4.8215	2.8106e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+143	14.96	13.72	0.0000	0.0000	1.5849	2.4776	1.1548e-01	9.7404e-01	7.1363e-03	      	Synonymous
+144	9.59	8.06	0.0000	0.0000	1.2804	3.0445	8.1013e-02	9.7404e-01	6.1077e-03	      	Synonymous
+145	10.16	8.82	0.0000	0.0000	1.4693	2.6851	1.0129e-01	9.7404e-01	6.5542e-03	      	Synonymous
+146	7.97	6.79	0.0000	0.0000	1.7013	2.3617	1.2435e-01	9.7404e-01	7.4914e-03	      	Synonymous
+147	6.54	4.48	0.0000	0.0000	0.9314	4.1141	4.2527e-02	9.7404e-01	6.1077e-03	-     	Constant
+148	9.83	8.44	0.0000	0.0000	1.4712	2.7843	9.5190e-02	9.7404e-01	6.3403e-03	      	Synonymous
+149	9.86	5.85	0.0000	0.0000	0.4734	8.0099	4.6521e-03	9.7404e-01	6.1077e-03	--    	Constant
+150	8.40	6.70	0.0000	0.0000	1.1388	3.3966	6.5331e-02	9.7404e-01	6.1077e-03	      	Synonymous
+151	12.84	12.62	0.5387	0.0301	2.6185	0.4411	5.0661e-01	9.7404e-01	2.7977e-02	      	
+152	5.86	4.74	0.0000	0.0000	1.8189	2.2293	1.3542e-01	9.7404e-01	7.8036e-03	      	Constant
+153	9.75	8.10	0.0000	0.0000	1.1727	3.3085	6.8924e-02	9.7404e-01	6.1077e-03	      	Synonymous
+154	10.12	7.75	0.0000	0.0000	0.8046	4.7374	2.9514e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+155	11.79	11.70	0.6916	0.0448	2.8791	0.1796	6.7168e-01	9.7404e-01	3.6472e-02	      	
+156	20.05	20.03	1.1677	0.1931	4.0364	0.0441	8.3363e-01	9.7404e-01	4.4940e-02	      	
+157	8.51	7.22	0.0000	0.0000	1.5338	2.5762	1.0848e-01	9.7404e-01	6.8207e-03	      	Synonymous
+158	15.48	13.37	0.0000	0.0000	0.9077	4.2205	3.9939e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+159	12.05	9.13	0.0000	0.0000	0.6497	5.8360	1.5701e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+160	7.35	5.86	0.0000	0.0000	1.3001	2.9965	8.3443e-02	9.7404e-01	6.1077e-03	      	Constant
+161	8.96	6.45	0.0000	0.0000	0.7602	5.0110	2.5187e-02	9.7404e-01	6.1077e-03	-     	Constant
+162	22.29	19.77	0.0000	0.0000	0.7579	5.0244	2.4993e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+163	8.70	6.74	0.0000	0.0000	0.9760	3.9317	4.7384e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+164	6.87	4.83	0.0000	0.0000	0.9370	4.0899	4.3141e-02	9.7404e-01	6.1077e-03	-     	Constant
+165	10.10	8.56	0.0000	0.0000	1.2621	3.0849	7.9020e-02	9.7404e-01	6.1077e-03	      	Synonymous
+166	9.61	8.19	0.0000	0.0000	1.4471	2.8378	9.2068e-02	9.7404e-01	6.3193e-03	      	Synonymous
+167	8.30	7.02	0.0000	0.0000	1.5334	2.5745	1.0860e-01	9.7404e-01	6.8207e-03	      	Synonymous
+168	8.41	7.28	0.0000	0.0000	1.7265	2.2729	1.3165e-01	9.7404e-01	7.7020e-03	      	Constant
+169	9.54	7.98	0.0000	0.0000	1.2394	3.1387	7.6456e-02	9.7404e-01	6.1077e-03	      	Synonymous
+170	5.86	4.74	0.0000	0.0000	1.8189	2.2293	1.3542e-01	9.7404e-01	7.8036e-03	      	Constant
+171	11.10	9.04	0.0000	0.0000	0.9280	4.1278	4.2183e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+172	9.09	6.69	0.0000	0.0000	0.7940	4.8014	2.8436e-02	9.7404e-01	6.1077e-03	-     	Constant
+173	11.81	9.80	0.0000	0.0000	0.9572	4.0072	4.5306e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+174	11.68	9.92	0.0000	0.0000	1.0968	3.5205	6.0614e-02	9.7404e-01	6.1077e-03	      	Synonymous
+175	4.93	3.31	0.0000	0.0000	1.1971	3.2396	7.1879e-02	9.7404e-01	6.1077e-03	      	Constant
+176	12.00	10.53	0.0000	0.0000	1.3285	2.9442	8.6188e-02	9.7404e-01	6.1235e-03	      	Synonymous
+177	8.19	8.01	0.5615	0.0313	2.7616	0.3763	5.3957e-01	9.7404e-01	2.9755e-02	      	
+178	6.62	4.20	0.0000	0.0000	0.7884	4.8356	2.7877e-02	9.7404e-01	6.1077e-03	-     	Constant
+179	15.06	11.60	0.0000	0.0000	0.5477	6.9228	8.5103e-03	9.7404e-01	6.1077e-03	--    	Synonymous
+180	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+181	4.93	3.31	0.0000	0.0000	1.1971	3.2396	7.1879e-02	9.7404e-01	6.1077e-03	      	Constant
+182	13.90	12.29	0.0000	0.0000	1.1991	3.2365	7.2015e-02	9.7404e-01	6.1077e-03	      	Synonymous
+183	4.96	3.44	0.0000	0.0000	1.2841	3.0356	8.1456e-02	9.7404e-01	6.1077e-03	      	Constant
+184	14.59	12.98	0.0000	0.0000	1.2061	3.2169	7.2882e-02	9.7404e-01	6.1077e-03	      	Synonymous
+185	4.96	3.44	0.0000	0.0000	1.2841	3.0356	8.1456e-02	9.7404e-01	6.1077e-03	      	Constant
+186	6.62	4.20	0.0000	0.0000	0.7884	4.8356	2.7877e-02	9.7404e-01	6.1077e-03	-     	Constant
+187	6.62	4.20	0.0000	0.0000	0.7884	4.8356	2.7877e-02	9.7404e-01	6.1077e-03	-     	Constant
+188	4.93	3.31	0.0000	0.0000	1.1971	3.2396	7.1879e-02	9.7404e-01	6.1077e-03	      	Constant
+189	5.41	3.72	0.0000	0.0000	1.1383	3.3956	6.5370e-02	9.7404e-01	6.1077e-03	      	Constant
+190	13.45	13.00	0.4317	0.0243	2.0151	0.8991	3.4301e-01	9.7404e-01	1.9191e-02	      	
+191	10.05	8.20	0.0000	0.0000	1.0352	3.7173	5.3850e-02	9.7404e-01	6.1077e-03	      	Synonymous
+192	11.43	9.63	0.0000	0.0000	1.0746	3.5883	5.8188e-02	9.7404e-01	6.1077e-03	      	Synonymous
+193	8.67	6.98	0.0000	0.0000	1.1409	3.3900	6.5592e-02	9.7404e-01	6.1077e-03	      	Synonymous
+194	11.11	9.53	0.0000	0.0000	1.2381	3.1473	7.6053e-02	9.7404e-01	6.1077e-03	      	Synonymous
+195	6.60	4.91	0.0000	0.0000	1.1478	3.3694	6.6420e-02	9.7404e-01	6.1077e-03	      	Constant
+196	12.45	10.54	0.0000	0.0000	1.0075	3.8141	5.0822e-02	9.7404e-01	6.1077e-03	      	Synonymous
+197	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+198	6.62	4.20	0.0000	0.0000	0.7884	4.8356	2.7877e-02	9.7404e-01	6.1077e-03	-     	Constant
+199	4.93	3.31	0.0000	0.0000	1.1971	3.2396	7.1879e-02	9.7404e-01	6.1077e-03	      	Constant
+200	9.86	5.85	0.0000	0.0000	0.4734	8.0099	4.6521e-03	9.7404e-01	6.1077e-03	--    	Constant
+201	5.41	3.72	0.0000	0.0000	1.1383	3.3956	6.5370e-02	9.7404e-01	6.1077e-03	      	Constant
+202	4.93	3.31	0.0000	0.0000	1.1971	3.2396	7.1879e-02	9.7404e-01	6.1077e-03	      	Constant
+203	4.93	3.31	0.0000	0.0000	1.1971	3.2396	7.1879e-02	9.7404e-01	6.1077e-03	      	Constant
+204	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+205	10.04	8.59	0.0000	0.0000	1.3440	2.8918	8.9030e-02	9.7404e-01	6.1895e-03	      	Synonymous
+206	10.33	8.65	0.0000	0.0000	1.1524	3.3614	6.6741e-02	9.7404e-01	6.1077e-03	      	Synonymous
+207	6.70	4.40	0.0000	0.0000	0.8334	4.5918	3.2125e-02	9.7404e-01	6.1077e-03	-     	Constant
+208	4.93	3.31	0.0000	0.0000	1.1971	3.2396	7.1879e-02	9.7404e-01	6.1077e-03	      	Constant
+209	13.68	12.06	0.0000	0.0000	1.1988	3.2381	7.1943e-02	9.7404e-01	6.1077e-03	      	Synonymous
+210	5.26	3.73	0.0000	0.0000	1.2728	3.0552	8.0478e-02	9.7404e-01	6.1077e-03	      	Constant
+211	6.52	5.14	0.0000	0.0000	1.4249	2.7529	9.7076e-02	9.7404e-01	6.3783e-03	      	Constant
+212	6.54	4.48	0.0000	0.0000	0.9314	4.1141	4.2527e-02	9.7404e-01	6.1077e-03	-     	Constant
+213	10.21	8.94	0.0000	0.0000	1.5503	2.5308	1.1164e-01	9.7404e-01	6.9546e-03	      	Synonymous
+214	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+215	9.83	6.58	0.0000	0.0000	0.5842	6.5037	1.0765e-02	9.7404e-01	6.1077e-03	-     	Constant
+216	9.83	6.58	0.0000	0.0000	0.5842	6.5037	1.0765e-02	9.7404e-01	6.1077e-03	-     	Constant
+217	8.87	6.93	0.0000	0.0000	0.9857	3.8947	4.8438e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+218	5.88	3.96	0.0000	0.0000	0.9963	3.8551	4.9596e-02	9.7404e-01	6.1077e-03	-     	Constant
+219	5.42	4.12	0.0000	0.0000	1.5215	2.5995	1.0690e-01	9.7404e-01	6.7802e-03	      	Constant
+220	8.86	7.48	0.0000	0.0000	1.4349	2.7480	9.7378e-02	9.7404e-01	6.3872e-03	      	Synonymous
+221	5.42	4.12	0.0000	0.0000	1.5215	2.5995	1.0690e-01	9.7404e-01	6.7802e-03	      	Constant
+222	9.83	8.44	0.0000	0.0000	1.4712	2.7843	9.5190e-02	9.7404e-01	6.3403e-03	      	Synonymous
+223	8.70	6.74	0.0000	0.0000	0.9760	3.9317	4.7384e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+224	6.70	4.40	0.0000	0.0000	0.8334	4.5918	3.2125e-02	9.7404e-01	6.1077e-03	-     	Constant
+225	5.88	3.96	0.0000	0.0000	0.9963	3.8551	4.9596e-02	9.7404e-01	6.1077e-03	-     	Constant
+226	12.31	8.10	0.0000	0.0000	0.4503	8.4190	3.7132e-03	9.7404e-01	6.1077e-03	--    	Constant
+227	18.96	18.71	0.5188	0.0290	2.5529	0.5011	4.7900e-01	9.7404e-01	2.6529e-02	      	
+228	5.42	4.12	0.0000	0.0000	1.5215	2.5995	1.0690e-01	9.7404e-01	6.7802e-03	      	Constant
+229	7.94	6.00	0.0000	0.0000	0.9931	3.8671	4.9241e-02	9.7404e-01	6.1077e-03	-     	Constant
+230	4.96	3.44	0.0000	0.0000	1.2841	3.0356	8.1456e-02	9.7404e-01	6.1077e-03	      	Constant
+231	5.42	4.12	0.0000	0.0000	1.5215	2.5995	1.0690e-01	9.7404e-01	6.7802e-03	      	Constant
+232	16.82	16.65	0.5779	0.0322	2.8542	0.3364	5.6193e-01	9.7404e-01	3.0900e-02	      	
+233	17.32	15.49	0.0000	0.0000	1.0512	3.6639	5.5604e-02	9.7404e-01	6.1077e-03	      	Synonymous
+234	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+235	5.41	3.72	0.0000	0.0000	1.1383	3.3956	6.5370e-02	9.7404e-01	6.1077e-03	      	Constant
+236	4.93	3.31	0.0000	0.0000	1.1971	3.2396	7.1879e-02	9.7404e-01	6.1077e-03	      	Constant
+237	4.93	3.31	0.0000	0.0000	1.1971	3.2396	7.1879e-02	9.7404e-01	6.1077e-03	      	Constant
+238	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+239	8.90	6.03	0.0000	0.0000	0.6613	5.7511	1.6478e-02	9.7404e-01	6.1077e-03	-     	Constant
+240	5.52	3.58	0.0000	0.0000	0.9860	3.8938	4.8463e-02	9.7404e-01	6.1077e-03	-     	Constant
+241	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+242	11.38	8.96	0.0000	0.0000	0.7880	4.8378	2.7842e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+243	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+244	6.52	5.14	0.0000	0.0000	1.4249	2.7529	9.7076e-02	9.7404e-01	6.3783e-03	      	Constant
+245	9.17	5.51	0.0000	0.0000	0.5183	7.3200	6.8191e-03	9.7404e-01	6.1077e-03	--    	Constant
+246	7.09	4.15	0.0000	0.0000	0.6439	5.8990	1.5149e-02	9.7404e-01	6.1077e-03	-     	Constant
+247	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+248	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+249	15.04	12.51	0.0000	0.0000	0.7535	5.0535	2.4576e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+250	12.35	8.23	0.0000	0.0000	0.4608	8.2287	4.1234e-03	9.7404e-01	6.1077e-03	--    	Synonymous
+251	8.96	6.45	0.0000	0.0000	0.7602	5.0110	2.5187e-02	9.7404e-01	6.1077e-03	-     	Constant
+252	9.17	5.51	0.0000	0.0000	0.5183	7.3200	6.8191e-03	9.7404e-01	6.1077e-03	--    	Constant
+253	7.09	4.15	0.0000	0.0000	0.6439	5.8990	1.5149e-02	9.7404e-01	6.1077e-03	-     	Constant
+254	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+255	7.54	5.60	0.0000	0.0000	0.9882	3.8852	4.8712e-02	9.7404e-01	6.1077e-03	-     	Constant
+256	9.80	7.63	0.0000	0.0000	0.8819	4.3362	3.7310e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+257	9.95	7.96	0.0000	0.0000	0.9647	3.9773	4.6118e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+258	7.09	4.15	0.0000	0.0000	0.6439	5.8990	1.5149e-02	9.7404e-01	6.1077e-03	-     	Constant
+259	8.61	6.87	0.0000	0.0000	1.1111	3.4757	6.2278e-02	9.7404e-01	6.1077e-03	      	Synonymous
+260	7.63	5.95	0.0000	0.0000	1.1458	3.3656	6.6573e-02	9.7404e-01	6.1077e-03	      	Constant
+261	5.45	3.62	0.0000	0.0000	1.0518	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Constant
+262	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+263	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+264	9.14	7.23	0.0000	0.0000	1.0062	3.8189	5.0678e-02	9.7404e-01	6.1077e-03	      	Synonymous
+265	6.14	4.26	0.0000	0.0000	1.0188	3.7736	5.2068e-02	9.7404e-01	6.1077e-03	      	Constant
+266	5.45	3.62	0.0000	0.0000	1.0518	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Constant
+267	11.56	7.93	0.0000	0.0000	0.5250	7.2593	7.0534e-03	9.7404e-01	6.1077e-03	--    	Constant
+268	4.93	3.31	0.0000	0.0000	1.1971	3.2396	7.1879e-02	9.7404e-01	6.1077e-03	      	Constant
+269	7.09	4.15	0.0000	0.0000	0.6439	5.8990	1.5149e-02	9.7404e-01	6.1077e-03	-     	Constant
+270	4.96	3.44	0.0000	0.0000	1.2841	3.0356	8.1456e-02	9.7404e-01	6.1077e-03	      	Constant
+271	11.37	9.32	0.0000	0.0000	0.9349	4.0996	4.2894e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+272	16.35	14.02	0.0000	0.0000	0.8187	4.6588	3.0894e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+273	10.05	8.20	0.0000	0.0000	1.0352	3.7173	5.3850e-02	9.7404e-01	6.1077e-03	      	Synonymous
+274	10.17	8.51	0.0000	0.0000	1.1632	3.3280	6.8110e-02	9.7404e-01	6.1077e-03	      	Synonymous
+275	5.45	3.62	0.0000	0.0000	1.0518	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Constant
+276	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+277	6.54	4.33	0.0000	0.0000	0.8638	4.4266	3.5382e-02	9.7404e-01	6.1077e-03	-     	Constant
+278	9.13	7.30	0.0000	0.0000	1.0531	3.6559	5.5872e-02	9.7404e-01	6.1077e-03	      	Synonymous
+279	5.45	3.62	0.0000	0.0000	1.0518	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Constant
+280	9.69	7.60	0.0000	0.0000	0.9169	4.1756	4.1010e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+281	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+282	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+283	5.88	3.96	0.0000	0.0000	0.9963	3.8551	4.9596e-02	9.7404e-01	6.1077e-03	-     	Constant
+284	12.63	10.29	0.0000	0.0000	0.8156	4.6770	3.0568e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+285	6.87	4.83	0.0000	0.0000	0.9370	4.0899	4.3141e-02	9.7404e-01	6.1077e-03	-     	Constant
+286	8.06	6.54	0.0000	0.0000	1.2751	3.0499	8.0744e-02	9.7404e-01	6.1077e-03	      	Synonymous
+287	6.14	4.26	0.0000	0.0000	1.0188	3.7736	5.2068e-02	9.7404e-01	6.1077e-03	      	Constant
+288	7.19	5.70	0.0000	0.0000	1.3087	2.9762	8.4497e-02	9.7404e-01	6.1077e-03	      	Constant
+289	12.43	10.85	0.0000	0.0000	1.2335	3.1470	7.6065e-02	9.7404e-01	6.1077e-03	      	Synonymous
+290	8.67	6.98	0.0000	0.0000	1.1409	3.3900	6.5592e-02	9.7404e-01	6.1077e-03	      	Synonymous
+291	9.58	8.05	0.0000	0.0000	1.2701	3.0625	8.0118e-02	9.7404e-01	6.1077e-03	      	Synonymous
+292	6.54	4.48	0.0000	0.0000	0.9314	4.1141	4.2527e-02	9.7404e-01	6.1077e-03	-     	Constant
+293	15.80	14.01	0.0000	0.0000	1.0748	3.5858	5.8275e-02	9.7404e-01	6.1077e-03	      	Synonymous
+294	4.96	3.44	0.0000	0.0000	1.2841	3.0356	8.1456e-02	9.7404e-01	6.1077e-03	      	Constant
+295	5.86	4.74	0.0000	0.0000	1.8189	2.2293	1.3542e-01	9.7404e-01	7.8036e-03	      	Constant
+296	7.35	5.86	0.0000	0.0000	1.3001	2.9965	8.3443e-02	9.7404e-01	6.1077e-03	      	Constant
+297	9.69	7.97	0.0000	0.0000	1.1254	3.4377	6.3723e-02	9.7404e-01	6.1077e-03	      	Synonymous
+298	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+299	11.36	10.19	0.0000	0.0000	1.6909	2.3310	1.2682e-01	9.7404e-01	7.5774e-03	      	Synonymous
+300	12.11	8.85	0.0000	0.0000	0.5847	6.5231	1.0648e-02	9.7404e-01	6.1077e-03	-     	Constant
+301	6.70	4.40	0.0000	0.0000	0.8334	4.5918	3.2125e-02	9.7404e-01	6.1077e-03	-     	Constant
+302	8.28	6.74	0.0000	0.0000	1.2570	3.0796	7.9282e-02	9.7404e-01	6.1077e-03	      	Constant
+303	9.60	6.66	0.0000	0.0000	0.6457	5.8758	1.5351e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+304	4.96	3.44	0.0000	0.0000	1.2841	3.0356	8.1456e-02	9.7404e-01	6.1077e-03	      	Constant
+305	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+306	7.09	4.15	0.0000	0.0000	0.6439	5.8990	1.5149e-02	9.7404e-01	6.1077e-03	-     	Constant
+307	9.04	6.77	0.0000	0.0000	0.8409	4.5428	3.3057e-02	9.7404e-01	6.1077e-03	-     	Constant
+308	4.96	3.44	0.0000	0.0000	1.2841	3.0356	8.1456e-02	9.7404e-01	6.1077e-03	      	Constant
+309	7.09	4.15	0.0000	0.0000	0.6439	5.8990	1.5149e-02	9.7404e-01	6.1077e-03	-     	Constant
+310	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+311	7.16	5.48	0.0000	0.0000	1.1505	3.3616	6.6732e-02	9.7404e-01	6.1077e-03	      	Constant
+312	11.56	8.65	0.0000	0.0000	0.6502	5.8284	1.5769e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+313	7.90	5.99	0.0000	0.0000	1.0049	3.8234	5.0540e-02	9.7404e-01	6.1077e-03	      	Synonymous
+314	10.42	8.58	0.0000	0.0000	1.0522	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Synonymous
+315	13.83	11.19	0.0000	0.0000	0.7204	5.2807	2.1562e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+316	9.62	5.51	0.0000	0.0000	0.4617	8.2126	4.1600e-03	9.7404e-01	6.1077e-03	--    	Constant
+317	8.30	7.02	0.0000	0.0000	1.5334	2.5745	1.0860e-01	9.7404e-01	6.8207e-03	      	Synonymous
+318	8.28	6.74	0.0000	0.0000	1.2570	3.0796	7.9282e-02	9.7404e-01	6.1077e-03	      	Constant
+319	10.10	8.71	0.0000	0.0000	1.4049	2.7860	9.5092e-02	9.7404e-01	6.3403e-03	      	Synonymous
+320	10.37	9.07	0.0000	0.0000	1.5247	2.5945	1.0724e-01	9.7404e-01	6.7904e-03	      	Synonymous
+321	7.67	6.12	0.0000	0.0000	1.2571	3.1009	7.8250e-02	9.7404e-01	6.1077e-03	      	Synonymous
+322	9.71	7.79	0.0000	0.0000	1.0008	3.8383	5.0093e-02	9.7404e-01	6.1077e-03	      	Synonymous
+323	6.14	4.26	0.0000	0.0000	1.0188	3.7736	5.2068e-02	9.7404e-01	6.1077e-03	      	Constant
+324	5.60	3.73	0.0000	0.0000	1.0263	3.7472	5.2896e-02	9.7404e-01	6.1077e-03	      	Constant
+325	8.87	6.45	0.0000	0.0000	0.7885	4.8378	2.7843e-02	9.7404e-01	6.1077e-03	-     	Constant
+326	10.04	8.45	0.0000	0.0000	1.2197	3.1850	7.4316e-02	9.7404e-01	6.1077e-03	      	Synonymous
+327	9.09	7.10	0.0000	0.0000	0.9633	3.9823	4.5981e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+328	5.99	4.25	0.0000	0.0000	1.1126	3.4696	6.2508e-02	9.7404e-01	6.1077e-03	      	Constant
+329	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+330	6.62	4.20	0.0000	0.0000	0.7884	4.8356	2.7877e-02	9.7404e-01	6.1077e-03	-     	Constant
+331	7.94	6.74	0.0000	0.0000	1.6571	2.3938	1.2181e-01	9.7404e-01	7.4004e-03	      	Synonymous
+332	8.96	6.45	0.0000	0.0000	0.7602	5.0110	2.5187e-02	9.7404e-01	6.1077e-03	-     	Constant
+333	8.28	6.74	0.0000	0.0000	1.2570	3.0796	7.9282e-02	9.7404e-01	6.1077e-03	      	Constant
+334	5.26	3.73	0.0000	0.0000	1.2728	3.0552	8.0478e-02	9.7404e-01	6.1077e-03	      	Constant
+335	5.88	3.96	0.0000	0.0000	0.9963	3.8551	4.9596e-02	9.7404e-01	6.1077e-03	-     	Constant
+336	9.48	5.29	0.0000	0.0000	0.4518	8.3953	3.7618e-03	9.7404e-01	6.1077e-03	--    	Constant
+337	7.00	4.73	0.0000	0.0000	0.8450	4.5304	3.3297e-02	9.7404e-01	6.1077e-03	-     	Constant
+338	5.52	3.58	0.0000	0.0000	0.9860	3.8938	4.8463e-02	9.7404e-01	6.1077e-03	-     	Constant
+339	5.86	4.74	0.0000	0.0000	1.8189	2.2293	1.3542e-01	9.7404e-01	7.8036e-03	      	Constant
+340	7.16	5.48	0.0000	0.0000	1.1505	3.3616	6.6732e-02	9.7404e-01	6.1077e-03	      	Constant
+341	5.86	4.74	0.0000	0.0000	1.8189	2.2293	1.3542e-01	9.7404e-01	7.8036e-03	      	Constant
+342	10.40	8.35	0.0000	0.0000	0.9349	4.0994	4.2899e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+343	11.75	9.39	0.0000	0.0000	0.8078	4.7200	2.9814e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+344	9.48	5.29	0.0000	0.0000	0.4518	8.3953	3.7618e-03	9.7404e-01	6.1077e-03	--    	Constant
+345	5.41	3.72	0.0000	0.0000	1.1383	3.3956	6.5370e-02	9.7404e-01	6.1077e-03	      	Constant
+346	9.72	8.26	0.0000	0.0000	1.3300	2.9202	8.7478e-02	9.7404e-01	6.1809e-03	      	Synonymous
+347	12.00	10.45	0.0000	0.0000	1.2525	3.1017	7.8209e-02	9.7404e-01	6.1077e-03	      	Synonymous
+348	5.99	4.25	0.0000	0.0000	1.1126	3.4696	6.2508e-02	9.7404e-01	6.1077e-03	      	Constant
+349	9.86	5.85	0.0000	0.0000	0.4734	8.0099	4.6521e-03	9.7404e-01	6.1077e-03	--    	Constant
+350	9.94	8.31	0.0000	0.0000	1.1934	3.2529	7.1299e-02	9.7404e-01	6.1077e-03	      	Synonymous
+351	4.96	3.44	0.0000	0.0000	1.2841	3.0356	8.1456e-02	9.7404e-01	6.1077e-03	      	Constant
+352	8.19	6.51	0.0000	0.0000	1.1541	3.3512	6.7157e-02	9.7404e-01	6.1077e-03	      	Synonymous
+353	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+354	5.42	4.12	0.0000	0.0000	1.5215	2.5995	1.0690e-01	9.7404e-01	6.7802e-03	      	Constant
+355	5.99	4.25	0.0000	0.0000	1.1126	3.4696	6.2508e-02	9.7404e-01	6.1077e-03	      	Constant
+356	7.94	6.00	0.0000	0.0000	0.9931	3.8671	4.9241e-02	9.7404e-01	6.1077e-03	-     	Constant
+357	5.52	3.58	0.0000	0.0000	0.9860	3.8938	4.8463e-02	9.7404e-01	6.1077e-03	-     	Constant
+358	8.07	6.88	0.0000	0.0000	1.6668	2.3931	1.2188e-01	9.7404e-01	7.4004e-03	      	Synonymous
+359	15.88	12.60	0.0000	0.0000	0.5786	6.5621	1.0417e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+360	5.26	3.73	0.0000	0.0000	1.2728	3.0552	8.0478e-02	9.7404e-01	6.1077e-03	      	Constant
+361	7.00	4.73	0.0000	0.0000	0.8450	4.5304	3.3297e-02	9.7404e-01	6.1077e-03	-     	Constant
+362	9.62	5.51	0.0000	0.0000	0.4617	8.2126	4.1600e-03	9.7404e-01	6.1077e-03	--    	Constant
+363	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+364	5.60	3.73	0.0000	0.0000	1.0263	3.7472	5.2896e-02	9.7404e-01	6.1077e-03	      	Constant
+365	8.96	6.45	0.0000	0.0000	0.7602	5.0110	2.5187e-02	9.7404e-01	6.1077e-03	-     	Constant
+366	8.85	6.33	0.0000	0.0000	0.7571	5.0303	2.4907e-02	9.7404e-01	6.1077e-03	-     	Constant
+367	5.26	3.73	0.0000	0.0000	1.2728	3.0552	8.0478e-02	9.7404e-01	6.1077e-03	      	Constant
+368	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+369	17.91	15.38	0.0000	0.0000	0.7534	5.0530	2.4583e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+370	5.45	3.62	0.0000	0.0000	1.0518	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Constant
+371	9.29	6.86	0.0000	0.0000	0.7856	4.8521	2.7613e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+372	5.41	3.72	0.0000	0.0000	1.1383	3.3956	6.5370e-02	9.7404e-01	6.1077e-03	      	Constant
+373	6.34	5.21	0.0000	0.0000	1.7649	2.2738	1.3158e-01	9.7404e-01	7.7020e-03	      	Constant
+374	12.87	10.96	0.0000	0.0000	1.0058	3.8203	5.0636e-02	9.7404e-01	6.1077e-03	      	Synonymous
+375	12.00	9.83	0.0000	0.0000	0.8822	4.3370	3.7293e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+376	5.45	3.62	0.0000	0.0000	1.0518	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Constant
+377	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+378	4.93	3.31	0.0000	0.0000	1.1971	3.2396	7.1879e-02	9.7404e-01	6.1077e-03	      	Constant
+379	8.19	6.51	0.0000	0.0000	1.1546	3.3499	6.7209e-02	9.7404e-01	6.1077e-03	      	Synonymous
+380	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+381	5.32	4.16	0.0000	0.0000	1.7085	2.3085	1.2867e-01	9.7404e-01	7.5855e-03	      	Constant
+382	4.93	3.31	0.0000	0.0000	1.1971	3.2396	7.1879e-02	9.7404e-01	6.1077e-03	      	Constant
+383	6.62	4.20	0.0000	0.0000	0.7884	4.8356	2.7877e-02	9.7404e-01	6.1077e-03	-     	Constant
+384	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+385	6.62	4.20	0.0000	0.0000	0.7884	4.8356	2.7877e-02	9.7404e-01	6.1077e-03	-     	Constant
+386	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+387	6.62	4.20	0.0000	0.0000	0.7884	4.8356	2.7877e-02	9.7404e-01	6.1077e-03	-     	Constant
+388	4.93	3.31	0.0000	0.0000	1.1971	3.2396	7.1879e-02	9.7404e-01	6.1077e-03	      	Constant
+389	8.64	6.82	0.0000	0.0000	1.0542	3.6527	5.5978e-02	9.7404e-01	6.1077e-03	      	Synonymous
+390	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+391	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+392	6.62	4.20	0.0000	0.0000	0.7884	4.8356	2.7877e-02	9.7404e-01	6.1077e-03	-     	Constant
+393	8.47	6.83	0.0000	0.0000	1.1783	3.2894	6.9728e-02	9.7404e-01	6.1077e-03	      	Synonymous
+394	8.90	7.08	0.0000	0.0000	1.0583	3.6394	5.6428e-02	9.7404e-01	6.1077e-03	      	Synonymous
+395	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+396	6.34	5.21	0.0000	0.0000	1.7649	2.2738	1.3158e-01	9.7404e-01	7.7020e-03	      	Constant
+397	8.14	6.22	0.0000	0.0000	1.0013	3.8368	5.0138e-02	9.7404e-01	6.1077e-03	      	Synonymous
+398	12.40	11.03	0.0000	0.0000	1.4142	2.7532	9.7063e-02	9.7404e-01	6.3783e-03	      	Synonymous
+399	7.88	6.34	0.0000	0.0000	1.2616	3.0896	7.8793e-02	9.7404e-01	6.1077e-03	      	Synonymous
+400	9.53	7.47	0.0000	0.0000	0.9318	4.1123	4.2573e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+401	10.76	8.45	0.0000	0.0000	0.8280	4.6210	3.1582e-02	9.7404e-01	6.1077e-03	-     	Constant
+402	12.04	10.25	0.0000	0.0000	1.0742	3.5911	5.8089e-02	9.7404e-01	6.1077e-03	      	Synonymous
+403	5.52	3.58	0.0000	0.0000	0.9860	3.8938	4.8463e-02	9.7404e-01	6.1077e-03	-     	Constant
+404	5.41	3.72	0.0000	0.0000	1.1383	3.3956	6.5370e-02	9.7404e-01	6.1077e-03	      	Constant
+405	5.60	3.73	0.0000	0.0000	1.0263	3.7472	5.2896e-02	9.7404e-01	6.1077e-03	      	Constant
+406	15.45	13.81	0.0000	0.0000	1.1778	3.2834	6.9986e-02	9.7404e-01	6.1077e-03	      	Synonymous
+407	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+408	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+409	5.60	3.73	0.0000	0.0000	1.0263	3.7472	5.2896e-02	9.7404e-01	6.1077e-03	      	Constant
+410	9.34	7.67	0.0000	0.0000	1.1558	3.3483	6.7274e-02	9.7404e-01	6.1077e-03	      	Synonymous
+411	5.52	3.58	0.0000	0.0000	0.9860	3.8938	4.8463e-02	9.7404e-01	6.1077e-03	-     	Constant
+412	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+413	11.81	10.30	0.0000	0.0000	1.2939	3.0083	8.2841e-02	9.7404e-01	6.1077e-03	      	Synonymous
+414	5.26	3.73	0.0000	0.0000	1.2728	3.0552	8.0478e-02	9.7404e-01	6.1077e-03	      	Constant
+415	12.95	10.03	0.0000	0.0000	0.5934	5.8352	1.5709e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+416	10.05	8.49	0.0000	0.0000	1.2389	3.1235	7.7169e-02	9.7404e-01	6.1077e-03	      	Synonymous
+417	8.87	6.45	0.0000	0.0000	0.7885	4.8378	2.7843e-02	9.7404e-01	6.1077e-03	-     	Constant
+418	5.26	3.73	0.0000	0.0000	1.2728	3.0552	8.0478e-02	9.7404e-01	6.1077e-03	      	Constant
+419	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+420	5.26	3.73	0.0000	0.0000	1.2728	3.0552	8.0478e-02	9.7404e-01	6.1077e-03	      	Constant
+421	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+422	10.50	9.33	0.0000	0.0000	1.7172	2.3293	1.2696e-01	9.7404e-01	7.5774e-03	      	Synonymous
+423	7.54	5.60	0.0000	0.0000	0.9882	3.8852	4.8712e-02	9.7404e-01	6.1077e-03	-     	Constant
+424	12.51	10.88	0.0000	0.0000	1.1873	3.2645	7.0793e-02	9.7404e-01	6.1077e-03	      	Synonymous
+425	6.87	4.83	0.0000	0.0000	0.9370	4.0899	4.3141e-02	9.7404e-01	6.1077e-03	-     	Constant
+426	12.24	10.71	0.0000	0.0000	1.2735	3.0476	8.0857e-02	9.7404e-01	6.1077e-03	      	Synonymous
+427	4.96	3.44	0.0000	0.0000	1.2841	3.0356	8.1456e-02	9.7404e-01	6.1077e-03	      	Constant
+428	9.62	5.51	0.0000	0.0000	0.4617	8.2126	4.1600e-03	9.7404e-01	6.1077e-03	--    	Constant
+429	12.31	10.35	0.0000	0.0000	0.9788	3.9218	4.7665e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+430	9.93	9.67	0.5147	0.0288	2.4712	0.5190	4.7128e-01	9.7404e-01	2.6177e-02	      	
+431	10.42	8.45	0.0000	0.0000	0.9732	3.9434	4.7054e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+432	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+433	7.00	4.73	0.0000	0.0000	0.8450	4.5304	3.3297e-02	9.7404e-01	6.1077e-03	-     	Constant
+434	9.17	5.51	0.0000	0.0000	0.5183	7.3200	6.8191e-03	9.7404e-01	6.1077e-03	--    	Constant
+435	5.88	3.96	0.0000	0.0000	0.9963	3.8551	4.9596e-02	9.7404e-01	6.1077e-03	-     	Constant
+436	10.09	8.17	0.0000	0.0000	0.9988	3.8458	4.9871e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+437	6.62	4.20	0.0000	0.0000	0.7884	4.8356	2.7877e-02	9.7404e-01	6.1077e-03	-     	Constant
+438	8.18	6.43	0.0000	0.0000	1.1074	3.4857	6.1903e-02	9.7404e-01	6.1077e-03	      	Synonymous
+439	8.62	7.18	0.0000	0.0000	1.3612	2.8730	9.0075e-02	9.7404e-01	6.2047e-03	      	Synonymous
+440	11.48	8.54	0.0000	0.0000	0.6449	5.8871	1.5252e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+441	9.09	7.60	0.0000	0.0000	1.3061	2.9816	8.4214e-02	9.7404e-01	6.1077e-03	      	Synonymous
+442	5.41	3.72	0.0000	0.0000	1.1383	3.3956	6.5370e-02	9.7404e-01	6.1077e-03	      	Constant
+443	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+444	5.45	3.62	0.0000	0.0000	1.0518	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Constant
+445	11.02	9.25	0.0000	0.0000	1.0926	3.5317	6.0205e-02	9.7404e-01	6.1077e-03	      	Synonymous
+446	6.60	4.91	0.0000	0.0000	1.1478	3.3694	6.6420e-02	9.7404e-01	6.1077e-03	      	Constant
+447	10.96	9.08	0.0000	0.0000	1.0214	3.7642	5.2360e-02	9.7404e-01	6.1077e-03	      	Synonymous
+448	9.06	7.20	0.0000	0.0000	1.0343	3.7193	5.3788e-02	9.7404e-01	6.1077e-03	      	Synonymous
+449	5.52	3.58	0.0000	0.0000	0.9860	3.8938	4.8463e-02	9.7404e-01	6.1077e-03	-     	Constant
+450	7.00	4.73	0.0000	0.0000	0.8450	4.5304	3.3297e-02	9.7404e-01	6.1077e-03	-     	Constant
+451	5.32	4.16	0.0000	0.0000	1.7085	2.3085	1.2867e-01	9.7404e-01	7.5855e-03	      	Constant
+452	6.54	4.33	0.0000	0.0000	0.8638	4.4266	3.5382e-02	9.7404e-01	6.1077e-03	-     	Constant
+453	8.69	6.73	0.0000	0.0000	0.9798	3.9170	4.7800e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+454	10.35	7.41	0.0000	0.0000	0.6470	5.8666	1.5431e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+455	6.14	4.26	0.0000	0.0000	1.0188	3.7736	5.2068e-02	9.7404e-01	6.1077e-03	      	Constant
+456	7.54	5.60	0.0000	0.0000	0.9882	3.8852	4.8712e-02	9.7404e-01	6.1077e-03	-     	Constant
+457	5.45	3.62	0.0000	0.0000	1.0518	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Constant
+458	5.41	3.72	0.0000	0.0000	1.1383	3.3956	6.5370e-02	9.7404e-01	6.1077e-03	      	Constant
+459	14.23	11.68	0.0000	0.0000	0.7488	5.0858	2.4122e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+460	5.52	3.58	0.0000	0.0000	0.9860	3.8938	4.8463e-02	9.7404e-01	6.1077e-03	-     	Constant
+461	5.42	4.12	0.0000	0.0000	1.5215	2.5995	1.0690e-01	9.7404e-01	6.7802e-03	      	Constant
+462	16.68	14.18	0.0000	0.0000	0.7562	5.0076	2.5237e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+463	4.96	3.44	0.0000	0.0000	1.2841	3.0356	8.1456e-02	9.7404e-01	6.1077e-03	      	Constant
+464	5.26	3.73	0.0000	0.0000	1.2728	3.0552	8.0478e-02	9.7404e-01	6.1077e-03	      	Constant
+465	6.54	4.48	0.0000	0.0000	0.9314	4.1141	4.2527e-02	9.7404e-01	6.1077e-03	-     	Constant
+466	12.16	10.17	0.0000	0.0000	0.9626	3.9838	4.5940e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+467	10.60	8.62	0.0000	0.0000	0.9688	3.9610	4.6565e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+468	9.96	8.43	0.0000	0.0000	1.2732	3.0542	8.0527e-02	9.7404e-01	6.1077e-03	      	Synonymous
+469	4.93	3.31	0.0000	0.0000	1.1971	3.2396	7.1879e-02	9.7404e-01	6.1077e-03	      	Constant
+470	7.09	4.15	0.0000	0.0000	0.6439	5.8990	1.5149e-02	9.7404e-01	6.1077e-03	-     	Constant
+471	5.32	4.16	0.0000	0.0000	1.7085	2.3085	1.2867e-01	9.7404e-01	7.5855e-03	      	Constant
+472	5.32	4.16	0.0000	0.0000	1.7085	2.3085	1.2867e-01	9.7404e-01	7.5855e-03	      	Constant
+473	8.87	6.45	0.0000	0.0000	0.7885	4.8378	2.7843e-02	9.7404e-01	6.1077e-03	-     	Constant
+474	8.81	7.31	0.0000	0.0000	1.3053	2.9835	8.4118e-02	9.7404e-01	6.1077e-03	      	Synonymous
+475	5.45	3.62	0.0000	0.0000	1.0518	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Constant
+476	5.41	3.72	0.0000	0.0000	1.1383	3.3956	6.5370e-02	9.7404e-01	6.1077e-03	      	Constant
+477	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+478	6.54	4.48	0.0000	0.0000	0.9314	4.1141	4.2527e-02	9.7404e-01	6.1077e-03	-     	Constant
+479	10.53	8.52	0.0000	0.0000	0.9536	4.0201	4.4960e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+480	14.18	11.72	0.0000	0.0000	0.7757	4.9127	2.6660e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+481	9.62	5.51	0.0000	0.0000	0.4617	8.2126	4.1600e-03	9.7404e-01	6.1077e-03	--    	Constant
+482	7.09	4.15	0.0000	0.0000	0.6439	5.8990	1.5149e-02	9.7404e-01	6.1077e-03	-     	Constant
+483	5.88	3.96	0.0000	0.0000	0.9963	3.8551	4.9596e-02	9.7404e-01	6.1077e-03	-     	Constant
+484	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+485	6.62	4.20	0.0000	0.0000	0.7884	4.8356	2.7877e-02	9.7404e-01	6.1077e-03	-     	Constant
+486	5.41	3.72	0.0000	0.0000	1.1383	3.3956	6.5370e-02	9.7404e-01	6.1077e-03	      	Constant
+487	8.44	6.61	0.0000	0.0000	1.0514	3.6621	5.5662e-02	9.7404e-01	6.1077e-03	      	Synonymous
+488	4.96	3.44	0.0000	0.0000	1.2841	3.0356	8.1456e-02	9.7404e-01	6.1077e-03	      	Constant
+489	6.70	4.40	0.0000	0.0000	0.8334	4.5918	3.2125e-02	9.7404e-01	6.1077e-03	-     	Constant
+490	9.48	5.29	0.0000	0.0000	0.4518	8.3953	3.7618e-03	9.7404e-01	6.1077e-03	--    	Constant
+491	6.54	4.33	0.0000	0.0000	0.8638	4.4266	3.5382e-02	9.7404e-01	6.1077e-03	-     	Constant
+492	6.54	4.33	0.0000	0.0000	0.8638	4.4266	3.5382e-02	9.7404e-01	6.1077e-03	-     	Constant
+493	5.46	3.73	0.0000	0.0000	1.1193	3.4490	6.3289e-02	9.7404e-01	6.1077e-03	      	Constant
+494	12.47	10.68	0.0000	0.0000	1.0817	3.5661	5.8971e-02	9.7404e-01	6.1077e-03	      	Synonymous
+495	16.54	14.50	0.0000	0.0000	0.9399	4.0766	4.3482e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+496	5.52	3.58	0.0000	0.0000	0.9860	3.8938	4.8463e-02	9.7404e-01	6.1077e-03	-     	Constant
+497	9.17	5.51	0.0000	0.0000	0.5183	7.3200	6.8191e-03	9.7404e-01	6.1077e-03	--    	Constant
+498	14.55	10.34	0.0000	0.0000	0.4495	8.4299	3.6911e-03	9.7404e-01	6.1077e-03	--    	Synonymous
+499	5.45	3.62	0.0000	0.0000	1.0518	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Constant
+500	14.20	13.45	0.3509	0.0198	1.6335	1.5090	2.1929e-01	9.7404e-01	1.2298e-02	      	
+501	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+502	5.26	3.73	0.0000	0.0000	1.2728	3.0552	8.0478e-02	9.7404e-01	6.1077e-03	      	Constant
+503	7.09	4.15	0.0000	0.0000	0.6439	5.8990	1.5149e-02	9.7404e-01	6.1077e-03	-     	Constant
+504	9.41	8.01	0.0000	0.0000	1.4030	2.7890	9.4913e-02	9.7404e-01	6.3403e-03	      	Synonymous
+505	15.70	15.46	0.5282	0.0295	2.5649	0.4732	4.9151e-01	9.7404e-01	2.7183e-02	      	
+506	9.17	5.51	0.0000	0.0000	0.5183	7.3200	6.8191e-03	9.7404e-01	6.1077e-03	--    	Constant
+507	11.95	9.91	0.0000	0.0000	0.9382	4.0813	4.3359e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+508	8.14	6.44	0.0000	0.0000	1.1366	3.4035	6.5058e-02	9.7404e-01	6.1077e-03	      	Synonymous
+509	8.69	6.73	0.0000	0.0000	0.9798	3.9170	4.7800e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+510	13.24	11.49	0.0000	0.0000	1.1046	3.4962	6.1510e-02	9.7404e-01	6.1077e-03	      	Synonymous
+511	5.45	3.62	0.0000	0.0000	1.0518	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Constant
+512	5.64	3.84	0.0000	0.0000	1.0701	3.6010	5.7745e-02	9.7404e-01	6.1077e-03	      	Constant
+513	8.47	6.83	0.0000	0.0000	1.1783	3.2894	6.9728e-02	9.7404e-01	6.1077e-03	      	Synonymous
+514	8.40	6.52	0.0000	0.0000	1.0205	3.7676	5.2253e-02	9.7404e-01	6.1077e-03	      	Synonymous
+515	5.26	3.73	0.0000	0.0000	1.2728	3.0552	8.0478e-02	9.7404e-01	6.1077e-03	      	Constant
+516	9.69	7.60	0.0000	0.0000	0.9169	4.1756	4.1010e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+517	5.52	3.58	0.0000	0.0000	0.9860	3.8938	4.8463e-02	9.7404e-01	6.1077e-03	-     	Constant
+518	6.70	4.40	0.0000	0.0000	0.8334	4.5918	3.2125e-02	9.7404e-01	6.1077e-03	-     	Constant
+519	10.54	8.66	0.0000	0.0000	1.0235	3.7576	5.2567e-02	9.7404e-01	6.1077e-03	      	Synonymous
+520	12.85	10.54	0.0000	0.0000	0.8262	4.6183	3.1632e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+521	5.32	4.16	0.0000	0.0000	1.7085	2.3085	1.2867e-01	9.7404e-01	7.5855e-03	      	Constant
+522	7.84	6.32	0.0000	0.0000	1.2754	3.0492	8.0775e-02	9.7404e-01	6.1077e-03	      	Synonymous
+523	6.34	5.21	0.0000	0.0000	1.7649	2.2738	1.3158e-01	9.7404e-01	7.7020e-03	      	Constant
+524	8.94	7.32	0.0000	0.0000	1.1946	3.2381	7.1944e-02	9.7404e-01	6.1077e-03	      	Synonymous
+525	14.72	13.10	0.0000	0.0000	1.2025	3.2274	7.2414e-02	9.7404e-01	6.1077e-03	      	Synonymous
+526	5.60	3.73	0.0000	0.0000	1.0263	3.7472	5.2896e-02	9.7404e-01	6.1077e-03	      	Constant
+527	13.57	12.01	0.0000	0.0000	1.2504	3.1125	7.7692e-02	9.7404e-01	6.1077e-03	      	Synonymous
+528	9.09	7.10	0.0000	0.0000	0.9633	3.9823	4.5981e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+529	12.34	10.74	0.0000	0.0000	1.2109	3.2023	7.3534e-02	9.7404e-01	6.1077e-03	      	Synonymous
+530	7.84	6.31	0.0000	0.0000	1.2755	3.0491	8.0782e-02	9.7404e-01	6.1077e-03	      	Synonymous
+531	8.94	7.77	0.0000	0.0000	1.7157	2.3312	1.2681e-01	9.7404e-01	7.5774e-03	      	Synonymous
+532	7.00	4.73	0.0000	0.0000	0.8450	4.5304	3.3297e-02	9.7404e-01	6.1077e-03	-     	Constant
+533	10.40	8.67	0.0000	0.0000	1.1175	3.4551	6.3056e-02	9.7404e-01	6.1077e-03	      	Synonymous
+534	5.07	3.39	0.0000	0.0000	1.1509	3.3624	6.6699e-02	9.7404e-01	6.1077e-03	      	Constant
+535	7.19	5.70	0.0000	0.0000	1.3087	2.9762	8.4497e-02	9.7404e-01	6.1077e-03	      	Constant
+536	8.41	6.67	0.0000	0.0000	1.1071	3.4881	6.1813e-02	9.7404e-01	6.1077e-03	      	Synonymous
+537	18.15	16.93	0.0000	0.0000	1.6228	2.4481	1.1767e-01	9.7404e-01	7.2480e-03	      	Synonymous
+538	6.54	4.33	0.0000	0.0000	0.8638	4.4266	3.5382e-02	9.7404e-01	6.1077e-03	-     	Constant
+539	9.91	7.50	0.0000	0.0000	0.7921	4.8215	2.8106e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+540	6.54	4.33	0.0000	0.0000	0.8638	4.4266	3.5382e-02	9.7404e-01	6.1077e-03	-     	Constant
+541	6.80	5.01	0.0000	0.0000	1.0769	3.5793	5.8504e-02	9.7404e-01	6.1077e-03	      	Constant
+542	11.86	10.34	0.0000	0.0000	1.2837	3.0370	8.1387e-02	9.7404e-01	6.1077e-03	      	Synonymous
+543	5.99	4.25	0.0000	0.0000	1.1126	3.4696	6.2508e-02	9.7404e-01	6.1077e-03	      	Constant
+544	10.42	8.77	0.0000	0.0000	1.1715	3.3060	6.9028e-02	9.7404e-01	6.1077e-03	      	Synonymous
+545	5.60	3.73	0.0000	0.0000	1.0263	3.7472	5.2896e-02	9.7404e-01	6.1077e-03	      	Constant
+546	12.68	10.95	0.0000	0.0000	1.1150	3.4625	6.2776e-02	9.7404e-01	6.1077e-03	      	Synonymous
+547	9.39	7.19	0.0000	0.0000	0.8719	4.3867	3.6220e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+548	9.60	6.66	0.0000	0.0000	0.6457	5.8758	1.5350e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+549	15.95	14.35	0.0000	0.0000	1.2069	3.2162	7.2911e-02	9.7404e-01	6.1077e-03	      	Synonymous
+550	5.60	3.73	0.0000	0.0000	1.0263	3.7472	5.2896e-02	9.7404e-01	6.1077e-03	      	Constant
+551	15.25	13.89	0.0000	0.0000	1.4481	2.7234	9.8888e-02	9.7404e-01	6.4205e-03	      	Synonymous
+552	5.45	3.62	0.0000	0.0000	1.0518	3.6606	5.5713e-02	9.7404e-01	6.1077e-03	      	Constant
+553	5.41	3.72	0.0000	0.0000	1.1383	3.3956	6.5370e-02	9.7404e-01	6.1077e-03	      	Constant
+554	12.73	11.46	0.0000	0.0000	1.5697	2.5383	1.1112e-01	9.7404e-01	6.9446e-03	      	Synonymous
+555	4.96	3.44	0.0000	0.0000	1.2841	3.0356	8.1456e-02	9.7404e-01	6.1077e-03	      	Constant
+556	5.32	4.16	0.0000	0.0000	1.7085	2.3085	1.2867e-01	9.7404e-01	7.5855e-03	      	Constant
+557	12.61	10.71	0.0000	0.0000	1.0169	3.7805	5.1853e-02	9.7404e-01	6.1077e-03	      	Synonymous
+558	6.54	4.33	0.0000	0.0000	0.8638	4.4266	3.5382e-02	9.7404e-01	6.1077e-03	-     	Constant
+559	11.07	11.02	1.2702	0.2003	4.5842	0.0950	7.5797e-01	9.7404e-01	4.0961e-02	      	
+560	9.26	7.47	0.0000	0.0000	1.0760	3.5799	5.8483e-02	9.7404e-01	6.1077e-03	      	Synonymous
+561	8.04	6.44	0.0000	0.0000	1.2116	3.2020	7.3548e-02	9.7404e-01	6.1077e-03	      	Synonymous
+562	6.42	4.69	0.0000	0.0000	1.1161	3.4578	6.2952e-02	9.7404e-01	6.1077e-03	      	Constant
+563	5.09	3.54	0.0000	0.0000	1.2562	3.0947	7.8546e-02	9.7404e-01	6.1077e-03	      	Constant
+564	7.31	5.94	0.0000	0.0000	1.4397	2.7340	9.8231e-02	9.7404e-01	6.3886e-03	      	Synonymous
+565	4.94	3.65	0.0000	0.0000	1.5242	2.5824	1.0806e-01	9.7404e-01	6.8207e-03	      	Constant
+566	7.26	5.90	0.0000	0.0000	1.4396	2.7346	9.8197e-02	9.7404e-01	6.3886e-03	      	Synonymous
+567	8.77	7.36	0.0000	0.0000	1.3886	2.8223	9.2963e-02	9.7404e-01	6.3403e-03	      	Synonymous
+568	12.54	10.59	0.0000	0.0000	0.9859	3.8950	4.8430e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+569	5.27	3.69	0.0000	0.0000	1.2253	3.1680	7.5096e-02	9.7404e-01	6.1077e-03	      	Constant
+570	10.30	8.91	0.0000	0.0000	1.4184	2.7735	9.5838e-02	9.7404e-01	6.3403e-03	      	Synonymous
+571	7.05	5.41	0.0000	0.0000	1.1792	3.2841	6.9954e-02	9.7404e-01	6.1077e-03	      	Constant
+572	5.09	3.54	0.0000	0.0000	1.2562	3.0947	7.8546e-02	9.7404e-01	6.1077e-03	      	Constant
+573	7.09	5.86	0.0000	0.0000	1.6308	2.4685	1.1615e-01	9.7404e-01	7.1658e-03	      	Synonymous
+574	4.93	3.96	0.0000	0.0000	2.1789	1.9326	1.6447e-01	9.7404e-01	9.3242e-03	      	Constant
+575	4.43	3.22	0.0000	0.0000	1.6645	2.4194	1.1984e-01	9.7404e-01	7.3348e-03	      	Constant
+576	6.42	5.16	0.0000	0.0000	1.5867	2.5149	1.1278e-01	9.7404e-01	7.0028e-03	      	Constant
+577	7.98	6.58	0.0000	0.0000	1.4187	2.8066	9.3879e-02	9.7404e-01	6.3403e-03	      	Synonymous
+578	5.05	3.70	0.0000	0.0000	1.4766	2.6924	1.0083e-01	9.7404e-01	6.5356e-03	      	Constant
+579	10.70	8.52	0.0000	0.0000	0.8710	4.3721	3.6531e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+580	10.98	9.44	0.0000	0.0000	1.2642	3.0809	7.9218e-02	9.7404e-01	6.1077e-03	      	Synonymous
+581	7.58	6.37	0.0000	0.0000	1.6719	2.4164	1.2007e-01	9.7404e-01	7.3371e-03	      	Synonymous
+582	4.86	3.49	0.0000	0.0000	1.4479	2.7382	9.7974e-02	9.7404e-01	6.3886e-03	      	Constant
+583	9.60	8.39	0.0000	0.0000	1.6634	2.4325	1.1884e-01	9.7404e-01	7.2853e-03	      	Synonymous
+584	6.94	5.65	0.0000	0.0000	1.5586	2.5770	1.0842e-01	9.7404e-01	6.8207e-03	      	Synonymous
+585	4.93	3.96	0.0000	0.0000	2.1789	1.9326	1.6447e-01	9.7404e-01	9.3242e-03	      	Constant
+586	9.99	7.67	0.0000	0.0000	0.8045	4.6428	3.1184e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+587	8.59	7.12	0.0000	0.0000	1.3312	2.9459	8.6097e-02	9.7404e-01	6.1235e-03	      	Synonymous
+588	4.48	3.35	0.0000	0.0000	1.8038	2.2651	1.3232e-01	9.7404e-01	7.7295e-03	      	Constant
+589	10.19	8.73	0.0000	0.0000	1.3496	2.9066	8.8216e-02	9.7404e-01	6.1853e-03	      	Synonymous
+590	7.29	5.87	0.0000	0.0000	1.3905	2.8429	9.1779e-02	9.7404e-01	6.3107e-03	      	Synonymous
+591	14.90	14.89	0.8723	0.0469	5.3298	0.0169	8.9646e-01	9.7404e-01	4.8192e-02	      	
+592	5.32	3.87	0.0000	0.0000	1.3555	2.8942	8.8897e-02	9.7404e-01	6.1895e-03	      	Constant
+593	7.32	6.18	0.0000	0.0000	1.7649	2.2822	1.3086e-01	9.7404e-01	7.7020e-03	      	Synonymous
+594	6.13	4.60	0.0000	0.0000	1.2740	3.0646	8.0012e-02	9.7404e-01	6.1077e-03	      	Constant
+595	4.92	3.46	0.0000	0.0000	1.3493	2.9133	8.7849e-02	9.7404e-01	6.1809e-03	      	Constant
+596	12.94	11.50	0.0000	0.0000	1.3733	2.8857	8.9372e-02	9.7404e-01	6.1895e-03	      	Synonymous
+597	5.32	3.87	0.0000	0.0000	1.3555	2.8942	8.8897e-02	9.7404e-01	6.1895e-03	      	Constant
+598	18.43	16.23	0.0000	0.0000	0.8695	4.3935	3.6077e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+599	12.29	10.53	0.0000	0.0000	1.0966	3.5216	6.0573e-02	9.7404e-01	6.1077e-03	      	Synonymous
+600	5.25	3.58	0.0000	0.0000	1.1563	3.3489	6.7249e-02	9.7404e-01	6.1077e-03	      	Constant
+601	7.30	5.82	0.0000	0.0000	1.3245	2.9582	8.5446e-02	9.7404e-01	6.1077e-03	      	Synonymous
+602	5.25	3.58	0.0000	0.0000	1.1563	3.3489	6.7249e-02	9.7404e-01	6.1077e-03	      	Constant
+603	7.44	5.96	0.0000	0.0000	1.3245	2.9573	8.5489e-02	9.7404e-01	6.1077e-03	      	Synonymous
+604	8.69	6.97	0.0000	0.0000	1.1195	3.4544	6.3084e-02	9.7404e-01	6.1077e-03	      	Synonymous
+605	8.97	6.53	0.0000	0.0000	0.7831	4.8664	2.7385e-02	9.7404e-01	6.1077e-03	-     	Constant
+606	5.32	3.54	0.0000	0.0000	1.0829	3.5617	5.9127e-02	9.7404e-01	6.1077e-03	      	Constant
+607	5.42	3.70	0.0000	0.0000	1.1277	3.4285	6.4079e-02	9.7404e-01	6.1077e-03	      	Constant
+608	23.05	20.78	0.0000	0.0000	0.8388	4.5476	3.2964e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+609	10.23	8.55	0.0000	0.0000	1.1508	3.3611	6.6754e-02	9.7404e-01	6.1077e-03	      	Synonymous
+610	6.31	4.42	0.0000	0.0000	1.0210	3.7658	5.2309e-02	9.7404e-01	6.1077e-03	      	Constant
+611	4.76	3.28	0.0000	0.0000	1.3205	2.9613	8.5277e-02	9.7404e-01	6.1077e-03	      	Constant
+612	7.30	5.82	0.0000	0.0000	1.3245	2.9582	8.5446e-02	9.7404e-01	6.1077e-03	      	Synonymous
+613	5.16	4.10	0.0000	0.0000	1.8868	2.1156	1.4580e-01	9.7404e-01	8.3147e-03	      	Constant
+614	5.25	4.06	0.0000	0.0000	1.6948	2.3721	1.2352e-01	9.7404e-01	7.4648e-03	      	Constant
+615	9.95	8.09	0.0000	0.0000	1.0351	3.7170	5.3861e-02	9.7404e-01	6.1077e-03	      	Synonymous
+616	6.55	4.92	0.0000	0.0000	1.1854	3.2722	7.0461e-02	9.7404e-01	6.1077e-03	      	Constant
+617	5.25	4.06	0.0000	0.0000	1.6948	2.3721	1.2352e-01	9.7404e-01	7.4648e-03	      	Constant
+618	4.80	3.41	0.0000	0.0000	1.4204	2.7739	9.5813e-02	9.7404e-01	6.3403e-03	      	Constant
+619	8.60	7.43	0.0000	0.0000	1.7079	2.3531	1.2503e-01	9.7404e-01	7.5208e-03	      	Synonymous
+620	9.43	6.35	0.0000	0.0000	0.6162	6.1603	1.3065e-02	9.7404e-01	6.1077e-03	-     	Constant
+621	11.76	10.28	0.0000	0.0000	1.3176	2.9658	8.5041e-02	9.7404e-01	6.1077e-03	      	Synonymous
+622	7.44	5.96	0.0000	0.0000	1.3245	2.9573	8.5489e-02	9.7404e-01	6.1077e-03	      	Synonymous
+623	4.80	3.41	0.0000	0.0000	1.4204	2.7739	9.5813e-02	9.7404e-01	6.3403e-03	      	Constant
+624	6.31	4.42	0.0000	0.0000	1.0210	3.7658	5.2309e-02	9.7404e-01	6.1077e-03	      	Constant
+625	8.76	7.36	0.0000	0.0000	1.3976	2.8128	9.3514e-02	9.7404e-01	6.3403e-03	      	Synonymous
+626	15.51	13.60	0.0000	0.0000	1.0037	3.8279	5.0406e-02	9.7404e-01	6.1077e-03	      	Synonymous
+627	13.23	12.07	0.0000	0.0000	1.7361	2.3229	1.2748e-01	9.7404e-01	7.5855e-03	      	Synonymous
+628	12.95	10.82	0.0000	0.0000	0.9001	4.2486	3.9283e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+629	5.08	3.68	0.0000	0.0000	1.4035	2.7938	9.4630e-02	9.7404e-01	6.3403e-03	      	Constant
+630	7.92	6.44	0.0000	0.0000	1.3235	2.9583	8.5436e-02	9.7404e-01	6.1077e-03	      	Synonymous
+631	7.97	6.57	0.0000	0.0000	1.4003	2.8142	9.3435e-02	9.7404e-01	6.3403e-03	      	Synonymous
+632	9.69	7.59	0.0000	0.0000	0.9095	4.2043	4.0321e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+633	9.39	7.91	0.0000	0.0000	1.3213	2.9605	8.5321e-02	9.7404e-01	6.1077e-03	      	Synonymous
+634	5.42	3.70	0.0000	0.0000	1.1277	3.4285	6.4079e-02	9.7404e-01	6.1077e-03	      	Constant
+635	6.31	4.42	0.0000	0.0000	1.0210	3.7658	5.2309e-02	9.7404e-01	6.1077e-03	      	Constant
+636	4.76	3.28	0.0000	0.0000	1.3205	2.9613	8.5277e-02	9.7404e-01	6.1077e-03	      	Constant
+637	5.42	3.70	0.0000	0.0000	1.1277	3.4285	6.4079e-02	9.7404e-01	6.1077e-03	      	Constant
+638	10.54	8.41	0.0000	0.0000	0.8984	4.2524	3.9195e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+639	18.20	16.72	0.0000	0.0000	1.3201	2.9642	8.5129e-02	9.7404e-01	6.1077e-03	      	Synonymous
+640	8.55	8.55	1.0350	0.0565	5.7156	0.0011	9.7404e-01	9.7404e-01	5.2289e-02	      	
+641	5.08	3.68	0.0000	0.0000	1.4035	2.7938	9.4630e-02	9.7404e-01	6.3403e-03	      	Constant
+642	4.76	3.28	0.0000	0.0000	1.3205	2.9613	8.5277e-02	9.7404e-01	6.1077e-03	      	Constant
+643	4.76	3.28	0.0000	0.0000	1.3205	2.9613	8.5277e-02	9.7404e-01	6.1077e-03	      	Constant
+644	13.49	11.39	0.0000	0.0000	0.9091	4.2072	4.0253e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+645	6.31	4.42	0.0000	0.0000	1.0210	3.7658	5.2309e-02	9.7404e-01	6.1077e-03	      	Constant
+646	7.53	6.05	0.0000	0.0000	1.3242	2.9586	8.5424e-02	9.7404e-01	6.1077e-03	      	Synonymous
+647	8.38	6.55	0.0000	0.0000	1.0570	3.6463	5.6195e-02	9.7404e-01	6.1077e-03	      	Synonymous
+648	5.42	3.70	0.0000	0.0000	1.1277	3.4285	6.4079e-02	9.7404e-01	6.1077e-03	      	Constant
+649	9.89	8.07	0.0000	0.0000	1.0550	3.6503	5.6058e-02	9.7404e-01	6.1077e-03	      	Synonymous
+650	5.42	3.70	0.0000	0.0000	1.1277	3.4285	6.4079e-02	9.7404e-01	6.1077e-03	      	Constant
+651	11.38	9.90	0.0000	0.0000	1.3135	2.9768	8.4468e-02	9.7404e-01	6.1077e-03	      	Synonymous
+652	4.76	3.28	0.0000	0.0000	1.3205	2.9613	8.5277e-02	9.7404e-01	6.1077e-03	      	Constant
+653	9.44	7.42	0.0000	0.0000	0.9530	4.0235	4.4871e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+654	13.40	11.49	0.0000	0.0000	1.0057	3.8206	5.0626e-02	9.7404e-01	6.1077e-03	      	Synonymous
+655	8.21	6.94	0.0000	0.0000	1.5729	2.5283	1.1182e-01	9.7404e-01	6.9546e-03	      	Synonymous
+656	17.32	16.06	0.0000	0.0000	1.5670	2.5345	1.1138e-01	9.7404e-01	6.9501e-03	      	Synonymous
+657	14.11	12.59	0.0000	0.0000	1.2795	3.0532	8.0577e-02	9.7404e-01	6.1077e-03	      	Synonymous
+658	10.05	8.14	0.0000	0.0000	1.0053	3.8221	5.0581e-02	9.7404e-01	6.1077e-03	      	Synonymous
+659	9.05	9.00	0.7226	0.0395	3.8385	0.1050	7.4594e-01	9.7404e-01	4.0382e-02	      	
+660	8.04	6.95	0.0000	0.0000	1.8498	2.1928	1.3865e-01	9.7404e-01	7.9446e-03	      	Synonymous
+661	15.02	14.87	0.6861	0.1103	2.3764	0.2894	5.9062e-01	9.7404e-01	3.2431e-02	      	
+662	16.68	16.57	1.4349	0.2290	5.0022	0.2155	6.4249e-01	9.7404e-01	3.5128e-02	      	
+663	12.77	12.66	0.6311	0.0347	3.5613	0.2209	6.3838e-01	9.7404e-01	3.4953e-02	      	
+664	5.77	4.19	0.0000	0.0000	1.2245	3.1724	7.4892e-02	9.7404e-01	6.1077e-03	      	Constant
+665	10.18	8.60	0.0000	0.0000	1.2306	3.1578	7.5566e-02	9.7404e-01	6.1077e-03	      	Synonymous
+666	4.93	3.39	0.0000	0.0000	1.2684	3.0741	7.9550e-02	9.7404e-01	6.1077e-03	      	Constant
+667	7.64	6.53	0.0000	0.0000	1.8151	2.2221	1.3605e-01	9.7404e-01	7.8281e-03	      	Synonymous
+668	4.93	3.39	0.0000	0.0000	1.2684	3.0741	7.9550e-02	9.7404e-01	6.1077e-03	      	Constant
+669	4.93	3.39	0.0000	0.0000	1.2684	3.0741	7.9550e-02	9.7404e-01	6.1077e-03	      	Constant
+670	5.77	4.19	0.0000	0.0000	1.2245	3.1724	7.4892e-02	9.7404e-01	6.1077e-03	      	Constant
+671	13.21	12.08	0.0000	0.0000	1.8099	2.2519	1.3345e-01	9.7404e-01	7.7837e-03	      	Synonymous
+672	6.55	4.92	0.0000	0.0000	1.1854	3.2722	7.0461e-02	9.7404e-01	6.1077e-03	      	Constant
+673	5.77	4.19	0.0000	0.0000	1.2245	3.1724	7.4892e-02	9.7404e-01	6.1077e-03	      	Constant
+674	13.58	12.73	0.3343	0.0189	1.5372	1.7042	1.9174e-01	9.7404e-01	1.0790e-02	      	
+675	5.08	3.68	0.0000	0.0000	1.4035	2.7938	9.4630e-02	9.7404e-01	6.3403e-03	      	Constant
+676	4.93	3.39	0.0000	0.0000	1.2684	3.0741	7.9550e-02	9.7404e-01	6.1077e-03	      	Constant
+677	6.62	4.75	0.0000	0.0000	1.0276	3.7429	5.3034e-02	9.7404e-01	6.1077e-03	      	Constant
+678	5.77	4.19	0.0000	0.0000	1.2245	3.1724	7.4892e-02	9.7404e-01	6.1077e-03	      	Constant
+679	7.67	6.58	0.0000	0.0000	1.8712	2.1924	1.3869e-01	9.7404e-01	7.9446e-03	      	Synonymous
+680	7.11	5.74	0.0000	0.0000	1.4353	2.7399	9.7870e-02	9.7404e-01	6.3886e-03	      	Constant
+681	5.08	3.68	0.0000	0.0000	1.4035	2.7938	9.4630e-02	9.7404e-01	6.3403e-03	      	Constant
+682	6.14	5.10	0.0000	0.0000	1.9704	2.0763	1.4960e-01	9.7404e-01	8.5188e-03	      	Constant
+683	8.92	7.32	0.0000	0.0000	1.2185	3.1901	7.4087e-02	9.7404e-01	6.1077e-03	      	Synonymous
+684	8.28	6.54	0.0000	0.0000	1.1131	3.4711	6.2449e-02	9.7404e-01	6.1077e-03	      	Synonymous
+685	6.31	4.42	0.0000	0.0000	1.0210	3.7658	5.2309e-02	9.7404e-01	6.1077e-03	      	Constant
+686	5.32	3.54	0.0000	0.0000	1.0829	3.5617	5.9127e-02	9.7404e-01	6.1077e-03	      	Constant
+687	5.16	4.10	0.0000	0.0000	1.8868	2.1156	1.4580e-01	9.7404e-01	8.3147e-03	      	Constant
+688	5.08	3.68	0.0000	0.0000	1.4035	2.7938	9.4630e-02	9.7404e-01	6.3403e-03	      	Constant
+689	13.94	12.33	0.0000	0.0000	1.2066	3.2227	7.2622e-02	9.7404e-01	6.1077e-03	      	Synonymous
+690	5.94	4.21	0.0000	0.0000	1.1188	3.4528	6.3146e-02	9.7404e-01	6.1077e-03	      	Constant
+691	5.77	4.19	0.0000	0.0000	1.2245	3.1724	7.4892e-02	9.7404e-01	6.1077e-03	      	Constant
+692	9.85	8.24	0.0000	0.0000	1.2069	3.2168	7.2885e-02	9.7404e-01	6.1077e-03	      	Synonymous
+693	7.27	5.50	0.0000	0.0000	1.0857	3.5532	5.9429e-02	9.7404e-01	6.1077e-03	      	Constant
+694	5.16	4.10	0.0000	0.0000	1.8868	2.1156	1.4580e-01	9.7404e-01	8.3147e-03	      	Constant
+695	10.22	8.10	0.0000	0.0000	0.8996	4.2521	3.9202e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+696	5.08	3.68	0.0000	0.0000	1.4035	2.7938	9.4630e-02	9.7404e-01	6.3403e-03	      	Constant
+697	4.76	3.28	0.0000	0.0000	1.3205	2.9613	8.5277e-02	9.7404e-01	6.1077e-03	      	Constant
+698	13.02	10.21	0.0000	0.0000	0.6721	5.6277	1.7679e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+699	6.49	4.38	0.0000	0.0000	0.9096	4.2130	4.0114e-02	9.7404e-01	6.1077e-03	-     	Constant
+700	5.44	3.79	0.0000	0.0000	1.1773	3.2936	6.9552e-02	9.7404e-01	6.1077e-03	      	Constant
+701	5.24	3.69	0.0000	0.0000	1.2526	3.1065	7.7981e-02	9.7404e-01	6.1077e-03	      	Constant
+702	6.31	4.42	0.0000	0.0000	1.0210	3.7658	5.2309e-02	9.7404e-01	6.1077e-03	      	Constant
+703	4.93	3.39	0.0000	0.0000	1.2684	3.0741	7.9550e-02	9.7404e-01	6.1077e-03	      	Constant
+704	5.08	3.68	0.0000	0.0000	1.4035	2.7938	9.4630e-02	9.7404e-01	6.3403e-03	      	Constant
+705	4.93	3.39	0.0000	0.0000	1.2684	3.0741	7.9550e-02	9.7404e-01	6.1077e-03	      	Constant
+706	7.11	5.74	0.0000	0.0000	1.4353	2.7399	9.7870e-02	9.7404e-01	6.3886e-03	      	Constant
+707	6.81	4.11	0.0000	0.0000	0.7031	5.4038	2.0093e-02	9.7404e-01	6.1077e-03	-     	Constant
+708	5.77	4.19	0.0000	0.0000	1.2245	3.1724	7.4892e-02	9.7404e-01	6.1077e-03	      	Constant
+709	6.91	5.37	0.0000	0.0000	1.2669	3.0742	7.9543e-02	9.7404e-01	6.1077e-03	      	Constant
+710	4.80	3.41	0.0000	0.0000	1.4204	2.7739	9.5813e-02	9.7404e-01	6.3403e-03	      	Constant
+711	8.24	6.64	0.0000	0.0000	1.2150	3.1994	7.3667e-02	9.7404e-01	6.1077e-03	      	Synonymous
+712	9.50	7.50	0.0000	0.0000	0.9581	4.0018	4.5452e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+713	5.94	4.21	0.0000	0.0000	1.1188	3.4528	6.3146e-02	9.7404e-01	6.1077e-03	      	Constant
+714	6.37	4.83	0.0000	0.0000	1.2638	3.0815	7.9188e-02	9.7404e-01	6.1077e-03	      	Constant
+715	9.86	7.92	0.0000	0.0000	0.9915	3.8729	4.9073e-02	9.7404e-01	6.1077e-03	-     	Synonymous
+716	4.93	3.39	0.0000	0.0000	1.2684	3.0741	7.9550e-02	9.7404e-01	6.1077e-03	      	Constant
+717	0.00	0.00	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	All gaps
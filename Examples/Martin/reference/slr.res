@@ -0,0 +1,376 @@
+Site	Neutral	Optimal	Omega	Lower	Upper	LrtStat	Pvalue	AdjPvalue	Qvalue	Result	Note
+1	11.19	10.94	0.5283	0.0301	2.5393	0.4891	4.8435e-01	9.9665e-01	6.5183e-01	      	
+2	12.49	12.24	1.6001	0.3723	5.0205	0.4978	4.8047e-01	9.9665e-01	6.5183e-01	      	
+3	10.73	10.32	0.4422	0.0247	2.1137	0.8236	3.6414e-01	9.9665e-01	6.3226e-01	      	
+4	11.40	11.40	0.9674	0.1566	3.2773	0.0021	9.6371e-01	9.9665e-01	7.9559e-01	      	
+5	19.66	19.53	0.7018	0.1132	2.3941	0.2563	6.1266e-01	9.9665e-01	6.6360e-01	      	
+6	12.36	10.10	0.0000	0.0000	0.8361	4.5237	3.3429e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+7	5.98	4.18	0.0000	0.0000	1.0735	3.6004	5.7764e-02	9.9665e-01	1.9130e-01	      	Constant
+8	5.57	4.17	0.0000	0.0000	1.4207	2.8034	9.4064e-02	9.9665e-01	2.6312e-01	      	Constant
+9	19.76	19.57	0.6499	0.1041	2.2632	0.3791	5.3808e-01	9.9665e-01	6.5183e-01	      	
+10	16.38	16.29	1.4354	0.2104	6.2258	0.1808	6.7067e-01	9.9665e-01	7.0413e-01	      	
+11	9.87	9.82	0.8104	0.1300	2.8279	0.0854	7.7011e-01	9.9665e-01	7.4708e-01	      	
+12	7.59	7.27	0.4805	0.0267	2.3848	0.6303	4.2726e-01	9.9665e-01	6.5183e-01	      	
+13	7.09	4.66	0.0000	0.0000	0.7818	4.8446	2.7733e-02	9.9665e-01	1.8162e-01	-     	Constant
+14	9.59	7.56	0.0000	0.0000	0.9380	4.0572	4.3982e-02	9.9665e-01	1.8317e-01	-     	Synonymous
+15	12.06	9.68	0.0000	0.0000	0.7974	4.7453	2.9379e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+16	5.72	4.53	0.0000	0.0000	1.6804	2.3752	1.2328e-01	9.9665e-01	3.1156e-01	      	Constant
+17	7.78	7.64	0.5971	0.0328	3.0224	0.2847	5.9365e-01	9.9665e-01	6.5358e-01	      	
+18	6.34	4.19	0.0000	0.0000	0.8833	4.3107	3.7873e-02	9.9665e-01	1.8162e-01	-     	Constant
+19	11.21	8.95	0.0000	0.0000	0.8397	4.5203	3.3494e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+20	13.14	9.78	0.0000	0.0000	0.5548	6.7188	9.5400e-03	9.9665e-01	1.8162e-01	--    	Synonymous
+21	5.91	3.81	0.0000	0.0000	0.9085	4.1981	4.0469e-02	9.9665e-01	1.8162e-01	-     	Constant
+22	9.87	5.10	0.0000	0.0000	0.3922	9.5577	1.9912e-03	7.1084e-01	1.8162e-01	--    	Constant
+23	6.95	4.14	0.0000	0.0000	0.6678	5.6305	1.7651e-02	9.9665e-01	1.8162e-01	-     	Constant
+24	6.82	4.90	0.0000	0.0000	0.9955	3.8575	4.9525e-02	9.9665e-01	1.8565e-01	-     	Constant
+25	8.07	6.05	0.0000	0.0000	0.9476	4.0374	4.4503e-02	9.9665e-01	1.8317e-01	-     	Synonymous
+26	15.53	15.51	0.8771	0.1335	3.7827	0.0280	8.6703e-01	9.9665e-01	7.7339e-01	      	
+27	19.50	19.28	0.5321	0.0286	2.5713	0.4469	5.0382e-01	9.9665e-01	6.5183e-01	      	
+28	12.88	12.52	0.4387	0.0238	2.7482	0.7153	3.9768e-01	9.9665e-01	6.4468e-01	      	
+29	14.46	14.28	0.5533	0.0303	3.0089	0.3745	5.4054e-01	9.9665e-01	6.5183e-01	      	
+30	9.86	9.48	0.4485	0.0248	2.3370	0.7502	3.8642e-01	9.9665e-01	6.4355e-01	      	
+31	13.71	8.98	0.0000	0.0000	0.3958	9.4699	2.0887e-03	7.4357e-01	1.8162e-01	--    	Synonymous
+32	6.62	4.32	0.0000	0.0000	0.8235	4.6043	3.1892e-02	9.9665e-01	1.8162e-01	-     	Constant
+33	8.93	5.33	0.0000	0.0000	0.5194	7.2029	7.2784e-03	9.9665e-01	1.8162e-01	--    	Constant
+34	14.13	11.80	0.0000	0.0000	0.8121	4.6733	3.0636e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+35	13.22	12.94	0.4912	0.0270	2.6279	0.5624	4.5328e-01	9.9665e-01	6.5183e-01	      	
+36	6.05	4.50	0.0000	0.0000	1.2734	3.0882	7.8861e-02	9.9665e-01	2.3917e-01	      	Constant
+37	5.57	4.17	0.0000	0.0000	1.4207	2.8034	9.4064e-02	9.9665e-01	2.6312e-01	      	Constant
+38	11.07	8.38	0.0000	0.0000	0.7006	5.3826	2.0339e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+39	9.26	9.02	0.5165	0.0284	2.8401	0.4761	4.9019e-01	9.9665e-01	6.5183e-01	      	
+40	18.78	18.72	1.2392	0.3014	3.9100	0.1180	7.3122e-01	9.9665e-01	7.3188e-01	      	
+41	13.54	13.47	1.4040	0.1824	6.7382	0.1274	7.2119e-01	9.9665e-01	7.2908e-01	      	
+42	20.24	20.24	1.0657	0.2595	3.3782	0.0105	9.1828e-01	9.9665e-01	7.7976e-01	      	
+43	24.02	21.78	3.5049	1.1134	10.1102	4.4784	3.4325e-02	9.9665e-01	1.8162e-01	+     	
+44	21.75	21.73	1.0992	0.3201	3.5237	0.0282	8.6673e-01	9.9665e-01	7.7339e-01	      	
+45	15.78	15.37	1.9162	0.4196	6.9482	0.8231	3.6428e-01	9.9665e-01	6.3226e-01	      	
+46	15.16	15.16	1.0193	0.1619	3.7077	0.0006	9.7977e-01	9.9665e-01	8.0074e-01	      	
+47	6.62	4.32	0.0000	0.0000	0.8235	4.6043	3.1892e-02	9.9665e-01	1.8162e-01	-     	Constant
+48	18.53	17.82	2.0925	0.5875	6.4049	1.4345	2.3103e-01	9.9665e-01	4.9306e-01	      	
+49	25.86	22.71	5.1599	1.4660	26.4134	6.3017	1.2062e-02	9.9665e-01	1.8162e-01	+     	
+50	17.78	17.77	0.9319	0.1446	3.6704	0.0085	9.2671e-01	9.9665e-01	7.8181e-01	      	
+51	10.29	10.18	0.6334	0.0348	3.2271	0.2207	6.3853e-01	9.9665e-01	6.8137e-01	      	
+52	10.42	10.19	0.5189	0.0284	2.7245	0.4703	4.9285e-01	9.9665e-01	6.5183e-01	      	
+53	9.72	9.58	0.6060	0.0341	2.9972	0.2805	5.9637e-01	9.9665e-01	6.5358e-01	      	
+54	19.61	19.41	1.4988	0.3611	4.2390	0.4031	5.2549e-01	9.9665e-01	6.5183e-01	      	
+55	17.75	17.56	1.5075	0.3530	4.5948	0.3926	5.3093e-01	9.9665e-01	6.5183e-01	      	
+56	12.56	10.38	0.0000	0.0000	0.8694	4.3766	3.6436e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+57	8.66	8.42	0.5212	0.0289	2.6191	0.4824	4.8735e-01	9.9665e-01	6.5183e-01	      	
+58	6.49	4.63	0.0000	0.0000	1.0395	3.7067	5.4196e-02	9.9665e-01	1.8565e-01	      	Constant
+59	19.52	19.50	1.1312	0.2677	3.4428	0.0385	8.4444e-01	9.9665e-01	7.6268e-01	      	
+60	15.27	15.13	0.5886	0.0321	3.1047	0.2932	5.8818e-01	9.9665e-01	6.5358e-01	      	
+61	14.35	13.71	2.1417	0.5051	6.2754	1.2652	2.6066e-01	9.9665e-01	5.2851e-01	      	
+62	19.75	17.90	3.4575	0.9716	10.6771	3.6890	5.4771e-02	9.9665e-01	1.8565e-01	      	
+63	8.26	6.41	0.0000	0.0000	1.0420	3.6939	5.4611e-02	9.9665e-01	1.8565e-01	      	Synonymous
+64	13.58	13.42	0.5551	0.0293	3.8546	0.3242	5.6911e-01	9.9665e-01	6.5358e-01	      	
+65	8.06	5.57	0.0000	0.0000	0.7578	4.9847	2.5572e-02	9.9665e-01	1.8162e-01	-     	Constant
+66	8.02	6.06	0.0000	0.0000	0.9740	3.9364	4.7253e-02	9.9665e-01	1.8565e-01	-     	Synonymous
+67	25.14	22.98	5.1200	1.0966	27.5516	4.3099	3.7892e-02	9.9665e-01	1.8162e-01	+     	
+68	11.07	10.93	2.1107	0.0816	99.0000	0.2675	6.0503e-01	9.9665e-01	6.5998e-01	     !	
+69	5.25	5.25	1.0892	0.0548	9.8716	0.0055	9.4073e-01	9.9665e-01	7.8335e-01	      	
+70	8.14	8.08	0.7168	0.0393	3.9146	0.1108	7.3921e-01	9.9665e-01	7.3188e-01	      	
+71	10.09	10.06	1.2037	0.1879	5.1605	0.0560	8.1297e-01	9.9665e-01	7.6268e-01	      	
+72	22.38	22.23	1.4780	0.3233	5.0710	0.3092	5.7815e-01	9.9665e-01	6.5358e-01	      	
+73	16.09	15.04	2.6506	0.6721	8.7277	2.1070	1.4663e-01	9.9665e-01	3.5802e-01	      	
+74	14.53	14.52	0.9383	0.1405	4.3303	0.0061	9.3783e-01	9.9665e-01	7.8335e-01	      	
+75	18.95	18.32	2.2258	0.4979	7.5875	1.2565	2.6231e-01	9.9665e-01	5.2851e-01	      	
+76	19.87	15.64	0.0000	0.0000	0.4397	8.4512	3.6480e-03	9.9665e-01	1.8162e-01	--    	Synonymous
+77	14.93	14.54	0.4425	0.0245	2.4977	0.7680	3.8084e-01	9.9665e-01	6.3794e-01	      	
+78	23.19	22.79	1.7311	0.4826	5.9450	0.7977	3.7177e-01	9.9665e-01	6.3684e-01	      	
+79	7.77	7.61	0.5693	0.0311	3.0995	0.3336	5.6354e-01	9.9665e-01	6.5358e-01	      	
+80	13.01	11.45	0.2456	0.0139	1.1288	3.1201	7.7330e-02	9.9665e-01	2.3917e-01	      	
+81	12.92	12.92	0.9763	0.1462	4.3501	0.0009	9.7647e-01	9.9665e-01	8.0074e-01	      	
+82	15.26	15.18	0.7837	0.1876	2.4060	0.1669	6.8289e-01	9.9665e-01	7.1251e-01	      	
+83	14.14	13.96	0.5586	0.0307	2.8864	0.3680	5.4408e-01	9.9665e-01	6.5315e-01	      	
+84	19.73	19.47	1.7178	0.3618	9.4956	0.5162	4.7248e-01	9.9665e-01	6.5183e-01	      	
+85	15.32	14.82	2.0138	0.4547	7.1211	0.9912	3.1945e-01	9.9665e-01	5.9000e-01	      	
+86	16.84	16.57	1.6821	0.3737	6.2454	0.5459	4.5998e-01	9.9665e-01	6.5183e-01	      	
+87	11.72	11.53	0.5454	0.0297	3.1034	0.3855	5.3466e-01	9.9665e-01	6.5183e-01	      	
+88	15.13	14.96	1.6308	0.2439	6.7098	0.3416	5.5889e-01	9.9665e-01	6.5358e-01	      	
+89	12.79	12.76	0.8497	0.1347	3.0674	0.0490	8.2484e-01	9.9665e-01	7.6268e-01	      	
+90	10.28	9.66	0.3756	0.0209	1.8278	1.2313	2.6715e-01	9.9665e-01	5.3451e-01	      	
+91	6.86	4.75	0.0000	0.0000	0.9019	4.2269	3.9789e-02	9.9665e-01	1.8162e-01	-     	Constant
+92	15.05	12.11	8.4499	1.6198	99.0000	5.8901	1.5226e-02	9.9665e-01	1.8162e-01	+    !	
+93	5.11	3.60	0.0000	0.0000	1.3238	3.0268	8.1899e-02	9.9665e-01	2.4580e-01	      	Constant
+94	11.93	11.92	1.1074	0.1633	4.9977	0.0154	9.0129e-01	9.9665e-01	7.7976e-01	      	
+95	13.69	13.44	0.4982	0.0274	5.7750	0.5154	4.7281e-01	9.9665e-01	6.5183e-01	      	
+96	9.61	9.29	2.0664	0.2885	10.5260	0.6494	4.2032e-01	9.9665e-01	6.5183e-01	      	
+97	13.37	11.30	6.3760	1.0783	99.0000	4.1436	4.1791e-02	9.9665e-01	1.8162e-01	+    !	
+98	7.01	5.76	0.0000	0.0000	1.6559	2.4844	1.1498e-01	9.9665e-01	3.0393e-01	      	Synonymous
+99	10.92	10.08	3.1959	0.4810	15.5907	1.6814	1.9474e-01	9.9665e-01	4.5285e-01	      	
+100	15.52	14.87	2.6139	0.4875	43.8784	1.3142	2.5163e-01	9.9665e-01	5.1786e-01	     !	
+101	7.21	7.21	0.8748	0.0450	7.2582	0.0144	9.0452e-01	9.9665e-01	7.7976e-01	      	
+102	13.25	13.24	1.1062	0.2203	3.3434	0.0233	8.7874e-01	9.9665e-01	7.7479e-01	      	
+103	6.82	4.90	0.0000	0.0000	0.9955	3.8575	4.9525e-02	9.9665e-01	1.8565e-01	-     	Constant
+104	16.35	16.12	1.5340	0.3740	4.6269	0.4471	5.0370e-01	9.9665e-01	6.5183e-01	      	
+105	21.61	21.54	0.7620	0.1171	3.5494	0.1248	7.2390e-01	9.9665e-01	7.2926e-01	      	
+106	22.71	22.34	1.8343	0.4018	6.4380	0.7262	3.9411e-01	9.9665e-01	6.4468e-01	      	
+107	24.54	24.42	1.3974	0.3173	5.3069	0.2437	6.2153e-01	9.9665e-01	6.6818e-01	      	
+108	13.48	13.32	1.4397	0.3453	4.2324	0.3212	5.7087e-01	9.9665e-01	6.5358e-01	      	
+109	11.48	11.45	0.8347	0.1323	3.0518	0.0604	8.0582e-01	9.9665e-01	7.6268e-01	      	
+110	11.87	11.52	0.4585	0.0252	2.4418	0.6936	4.0494e-01	9.9665e-01	6.4804e-01	      	
+111	11.60	10.19	0.2603	0.0147	1.1892	2.8300	9.2518e-02	9.9665e-01	2.6312e-01	      	
+112	9.42	9.10	0.4820	0.0270	2.2893	0.6457	4.2164e-01	9.9665e-01	6.5183e-01	      	
+113	9.69	9.69	1.0129	0.1611	3.5455	0.0003	9.8635e-01	9.9665e-01	8.0210e-01	      	
+114	14.24	14.19	1.2784	0.2066	4.7755	0.1014	7.5016e-01	9.9665e-01	7.3765e-01	      	
+115	18.67	17.93	2.0073	0.6091	5.2577	1.4805	2.2370e-01	9.9665e-01	4.8826e-01	      	
+116	6.81	6.65	0.5781	0.0319	2.9804	0.3261	5.6797e-01	9.9665e-01	6.5358e-01	      	
+117	13.32	13.30	1.1764	0.1865	4.5668	0.0445	8.3296e-01	9.9665e-01	7.6268e-01	      	
+118	10.43	10.29	0.6059	0.0344	3.0526	0.2819	5.9547e-01	9.9665e-01	6.5358e-01	      	
+119	15.83	15.31	2.4658	0.3512	8.3327	1.0475	3.0609e-01	9.9665e-01	5.7266e-01	      	
+120	14.08	14.01	0.6838	0.0373	3.7507	0.1442	7.0411e-01	9.9665e-01	7.1684e-01	      	
+121	13.83	13.83	1.0032	0.1573	3.7665	0.0000	9.9665e-01	9.9665e-01	8.0210e-01	      	
+122	7.09	4.66	0.0000	0.0000	0.7818	4.8446	2.7733e-02	9.9665e-01	1.8162e-01	-     	Constant
+123	17.77	17.01	0.3443	0.0193	1.6581	1.5267	2.1661e-01	9.9665e-01	4.8386e-01	      	
+124	16.67	16.51	0.6625	0.1049	2.6096	0.3225	5.7008e-01	9.9665e-01	6.5358e-01	      	
+125	20.00	19.16	2.4134	0.5940	8.7986	1.6684	1.9647e-01	9.9665e-01	4.5285e-01	      	
+126	19.58	19.47	1.3538	0.3090	4.4873	0.2055	6.5030e-01	9.9665e-01	6.8883e-01	      	
+127	9.35	9.22	0.6082	0.0335	3.0654	0.2645	6.0702e-01	9.9665e-01	6.5998e-01	      	
+128	11.41	11.24	1.5568	0.2762	6.6236	0.3369	5.6164e-01	9.9665e-01	6.5358e-01	      	
+129	5.62	4.06	0.0000	0.0000	1.2659	3.1216	7.7262e-02	9.9665e-01	2.3917e-01	      	Constant
+130	9.62	9.37	0.5047	0.0277	2.7928	0.5117	4.7439e-01	9.9665e-01	6.5183e-01	      	
+131	16.57	16.54	0.8466	0.1356	2.9461	0.0541	8.1600e-01	9.9665e-01	7.6268e-01	      	
+132	17.66	17.62	1.2441	0.2686	5.4843	0.0890	7.6545e-01	9.9665e-01	7.4507e-01	      	
+133	13.63	11.27	0.0000	0.0000	0.8038	4.7095	2.9997e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+134	15.77	15.76	1.0804	0.1825	3.4699	0.0117	9.1377e-01	9.9665e-01	7.7976e-01	      	
+135	15.08	15.06	1.1656	0.1873	4.0529	0.0412	8.3907e-01	9.9665e-01	7.6268e-01	      	
+136	14.88	14.88	1.0267	0.1641	3.4924	0.0013	9.7165e-01	9.9665e-01	7.9985e-01	      	
+137	11.86	9.58	0.0000	0.0000	0.8342	4.5490	3.2938e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+138	16.33	16.27	0.7852	0.1249	2.8155	0.1112	7.3882e-01	9.9665e-01	7.3188e-01	      	
+139	16.13	15.74	1.9073	0.4144	7.6891	0.7918	3.7355e-01	9.9665e-01	6.3684e-01	      	
+140	11.85	11.68	0.5599	0.0303	3.2985	0.3431	5.5805e-01	9.9665e-01	6.5358e-01	      	
+141	12.65	12.65	0.9278	0.1553	3.0424	0.0114	9.1503e-01	9.9665e-01	7.7976e-01	      	
+142	11.87	9.37	0.0000	0.0000	0.7571	4.9967	2.5395e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+143	11.45	11.15	0.4825	0.0267	2.4181	0.6145	4.3311e-01	9.9665e-01	6.5183e-01	      	
+144	16.84	16.75	1.3849	0.2145	6.0160	0.1625	6.8688e-01	9.9665e-01	7.1251e-01	      	
+145	14.33	14.28	0.7934	0.1269	2.8099	0.1032	7.4798e-01	9.9665e-01	7.3765e-01	      	
+146	3.68	3.68	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+147	3.60	3.60	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+148	4.55	4.55	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+149	3.31	3.31	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+150	3.08	3.08	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+151	3.57	3.57	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+152	4.07	4.07	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+153	3.68	3.68	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+154	3.68	3.68	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+155	4.09	4.09	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+156	3.08	3.08	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+157	4.55	4.55	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+158	16.83	16.67	1.4450	0.3335	4.5745	0.3076	5.7914e-01	9.9665e-01	6.5358e-01	      	
+159	9.31	8.30	0.0000	0.0000	2.0185	2.0248	1.5475e-01	9.9665e-01	3.7156e-01	      	Synonymous
+160	18.01	17.94	1.3687	0.2128	5.4132	0.1546	6.9414e-01	9.9665e-01	7.1311e-01	      	
+161	21.91	18.31	7.2704	1.8584	26.0915	7.2037	7.2755e-03	9.9665e-01	1.8162e-01	++    	
+162	9.40	9.26	0.5994	0.0330	3.1662	0.2807	5.9624e-01	9.9665e-01	6.5358e-01	      	
+163	16.84	16.41	1.8000	0.4357	4.9534	0.8431	3.5852e-01	9.9665e-01	6.3226e-01	      	
+164	10.27	10.16	0.6355	0.0347	3.3502	0.2114	6.4569e-01	9.9665e-01	6.8647e-01	      	
+165	9.48	9.47	0.9062	0.0548	4.7264	0.0100	9.2017e-01	9.9665e-01	7.7976e-01	      	
+166	13.60	13.55	0.7264	0.0384	4.4319	0.0928	7.6063e-01	9.9665e-01	7.4507e-01	      	
+167	10.46	10.25	0.5486	0.0308	2.5929	0.4203	5.1678e-01	9.9665e-01	6.5183e-01	      	
+168	17.03	16.96	1.3464	0.2259	5.0954	0.1539	6.9488e-01	9.9665e-01	7.1311e-01	      	
+169	19.63	19.41	1.5958	0.3552	5.9494	0.4453	5.0459e-01	9.9665e-01	6.5183e-01	      	
+170	12.51	12.28	0.5122	0.0280	3.8926	0.4654	4.9513e-01	9.9665e-01	6.5183e-01	      	
+171	15.58	15.29	2.0100	0.2738	8.8360	0.5844	4.4459e-01	9.9665e-01	6.5183e-01	      	
+172	10.37	10.09	0.4974	0.0274	2.5836	0.5494	4.5857e-01	9.9665e-01	6.5183e-01	      	
+173	17.34	16.90	1.9396	0.4283	6.4898	0.8850	3.4684e-01	9.9665e-01	6.2457e-01	      	
+174	18.54	17.36	2.8148	0.7306	9.0149	2.3770	1.2313e-01	9.9665e-01	3.1156e-01	      	
+175	16.91	16.91	1.0595	0.1655	4.3532	0.0056	9.4047e-01	9.9665e-01	7.8335e-01	      	
+176	18.52	18.26	1.6647	0.3641	6.1149	0.5189	4.7133e-01	9.9665e-01	6.5183e-01	      	
+177	16.96	16.23	2.1250	0.5955	7.0531	1.4666	2.2588e-01	9.9665e-01	4.8932e-01	      	
+178	16.16	15.98	1.5799	0.2777	5.7276	0.3744	5.4063e-01	9.9665e-01	6.5183e-01	      	
+179	11.48	11.46	1.1710	0.1792	4.8960	0.0390	8.4338e-01	9.9665e-01	7.6268e-01	      	
+180	13.13	13.12	0.8320	0.0446	5.0727	0.0307	8.6091e-01	9.9665e-01	7.7339e-01	      	
+181	18.81	17.44	3.3656	0.7737	12.2792	2.7508	9.7208e-02	9.9665e-01	2.6813e-01	      	
+182	10.04	10.02	1.1253	0.1752	4.2624	0.0230	8.7935e-01	9.9665e-01	7.7479e-01	      	
+183	20.69	20.62	1.2829	0.2874	4.8819	0.1314	7.1703e-01	9.9665e-01	7.2742e-01	      	
+184	12.27	11.92	0.4608	0.0255	2.3027	0.7068	4.0052e-01	9.9665e-01	6.4468e-01	      	
+185	19.56	18.07	2.9837	0.8432	8.2800	2.9808	8.4256e-02	9.9665e-01	2.4949e-01	      	
+186	11.48	10.72	0.3452	0.0194	1.6373	1.5315	2.1588e-01	9.9665e-01	4.8386e-01	      	
+187	11.68	11.34	1.8094	0.3715	6.3418	0.6784	4.1015e-01	9.9665e-01	6.4929e-01	      	
+188	15.93	15.35	0.3788	0.0211	2.0017	1.1595	2.8156e-01	9.9665e-01	5.4816e-01	      	
+189	7.40	7.28	0.6301	0.0351	3.3870	0.2274	6.3344e-01	9.9665e-01	6.7845e-01	      	
+190	10.31	10.29	1.1746	0.1811	4.5188	0.0415	8.3848e-01	9.9665e-01	7.6268e-01	      	
+191	9.15	9.12	0.8065	0.0433	4.6139	0.0430	8.3579e-01	9.9665e-01	7.6268e-01	      	
+192	9.77	9.76	0.8575	0.0458	5.2689	0.0213	8.8406e-01	9.9665e-01	7.7656e-01	      	
+193	9.87	8.39	0.0000	0.0000	1.3293	2.9692	8.4862e-02	9.9665e-01	2.4949e-01	      	Synonymous
+194	4.81	4.81	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+195	3.10	3.10	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+196	3.94	3.94	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+197	10.26	10.26	1.0080	0.0508	5.7416	0.0000	9.9438e-01	9.9665e-01	8.0210e-01	      	
+198	12.89	12.60	1.8571	0.3042	9.9371	0.5691	4.5063e-01	9.9665e-01	6.5183e-01	      	
+199	17.06	16.72	2.2236	0.2939	24.4819	0.6872	4.0711e-01	9.9665e-01	6.4804e-01	      	
+200	15.47	14.27	3.3878	0.6942	13.3759	2.3999	1.2134e-01	9.9665e-01	3.1156e-01	      	
+201	16.82	15.52	3.1173	0.7449	11.3812	2.5837	1.0797e-01	9.9665e-01	2.8803e-01	      	
+202	11.52	9.02	0.0000	0.0000	0.7555	4.9932	2.5447e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+203	7.34	6.75	4.2852	0.2066	99.0000	1.1732	2.7875e-01	9.9665e-01	5.4816e-01	     !	
+204	6.44	6.20	0.0000	0.0000	99.0000	0.4699	4.9303e-01	9.9665e-01	6.5183e-01	     !	Synonymous
+205	5.79	5.31	0.0000	0.0000	4.4448	0.9561	3.2818e-01	9.9665e-01	6.0225e-01	      	Constant
+206	16.66	15.91	3.5770	0.4167	19.0992	1.5090	2.1929e-01	9.9665e-01	4.8386e-01	      	
+207	11.34	11.28	1.3095	0.2009	5.2279	0.1127	7.3713e-01	9.9665e-01	7.3188e-01	      	
+208	13.36	13.29	1.3348	0.2245	5.0092	0.1447	7.0370e-01	9.9665e-01	7.1684e-01	      	
+209	12.69	12.54	0.5833	0.0317	3.3804	0.2977	5.8533e-01	9.9665e-01	6.5358e-01	      	
+210	14.33	14.00	0.4707	0.0260	2.5222	0.6468	4.2127e-01	9.9665e-01	6.5183e-01	      	
+211	13.42	12.97	0.4224	0.0234	2.1437	0.8952	3.4407e-01	9.9665e-01	6.2348e-01	      	
+212	13.72	13.49	0.5285	0.0293	2.6534	0.4600	4.9764e-01	9.9665e-01	6.5183e-01	      	
+213	13.64	13.63	1.0947	0.1714	3.8891	0.0144	9.0455e-01	9.9665e-01	7.7976e-01	      	
+214	10.82	10.82	0.9362	0.1501	3.2281	0.0081	9.2813e-01	9.9665e-01	7.8181e-01	      	
+215	10.69	7.84	0.0000	0.0000	0.6584	5.7139	1.6831e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+216	20.80	20.80	1.0875	0.2514	3.5542	0.0169	8.9672e-01	9.9665e-01	7.7976e-01	      	
+217	9.79	7.69	0.0000	0.0000	0.9108	4.1885	4.0698e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+218	9.27	9.04	0.5438	0.0317	2.5482	0.4583	4.9844e-01	9.9665e-01	6.5183e-01	      	
+219	9.39	6.41	0.0000	0.0000	0.6293	5.9611	1.4625e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+220	7.87	5.84	0.0000	0.0000	0.9440	4.0516	4.4130e-02	9.9665e-01	1.8317e-01	-     	Synonymous
+221	11.04	7.66	0.0000	0.0000	0.5519	6.7710	9.2652e-03	9.9665e-01	1.8162e-01	--    	Synonymous
+222	15.62	11.42	0.0000	0.0000	0.4378	8.3900	3.7730e-03	9.9665e-01	1.8162e-01	--    	Synonymous
+223	13.45	13.44	1.0687	0.1677	3.8615	0.0076	9.3073e-01	9.9665e-01	7.8181e-01	      	
+224	12.70	12.66	0.7745	0.0484	3.4749	0.0773	7.8093e-01	9.9665e-01	7.5166e-01	      	
+225	11.91	9.76	0.0000	0.0000	0.8855	4.3027	3.8051e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+226	18.70	15.81	0.0000	0.0000	0.6503	5.7748	1.6258e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+227	12.14	9.72	0.0000	0.0000	0.7813	4.8328	2.7923e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+228	11.39	11.35	1.2193	0.1899	4.7785	0.0638	8.0063e-01	9.9665e-01	7.6268e-01	      	
+229	12.91	12.70	0.5445	0.0301	2.7097	0.4140	5.1994e-01	9.9665e-01	6.5183e-01	      	
+230	8.58	6.24	0.0000	0.0000	0.8116	4.6682	3.0726e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+231	7.79	5.38	0.0000	0.0000	0.7879	4.8110	2.8279e-02	9.9665e-01	1.8162e-01	-     	Constant
+232	13.69	8.52	0.0000	0.0000	0.3571	10.3379	1.3033e-03	4.6656e-01	1.8162e-01	--    	Synonymous
+233	8.42	5.98	0.0000	0.0000	0.7755	4.8755	2.7240e-02	9.9665e-01	1.8162e-01	-     	Constant
+234	7.79	5.38	0.0000	0.0000	0.7879	4.8110	2.8279e-02	9.9665e-01	1.8162e-01	-     	Constant
+235	8.96	7.53	0.0000	0.0000	1.3875	2.8626	9.0662e-02	9.9665e-01	2.6121e-01	      	Synonymous
+236	7.79	5.38	0.0000	0.0000	0.7879	4.8110	2.8279e-02	9.9665e-01	1.8162e-01	-     	Constant
+237	10.65	8.06	0.0000	0.0000	0.7253	5.1837	2.2800e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+238	6.93	4.77	0.0000	0.0000	0.8816	4.3305	3.7436e-02	9.9665e-01	1.8162e-01	-     	Constant
+239	15.87	15.63	1.7568	0.2743	6.4367	0.4889	4.8444e-01	9.9665e-01	6.5183e-01	      	
+240	6.05	4.50	0.0000	0.0000	1.2734	3.0882	7.8861e-02	9.9665e-01	2.3917e-01	      	Constant
+241	6.49	4.63	0.0000	0.0000	1.0395	3.7067	5.4196e-02	9.9665e-01	1.8565e-01	      	Constant
+242	6.82	4.90	0.0000	0.0000	0.9955	3.8575	4.9525e-02	9.9665e-01	1.8565e-01	-     	Constant
+243	9.90	9.60	0.4844	0.0267	2.4746	0.6005	4.3839e-01	9.9665e-01	6.5183e-01	      	
+244	14.91	14.76	0.5854	0.0319	3.0214	0.3021	5.8260e-01	9.9665e-01	6.5358e-01	      	
+245	7.88	5.75	0.0000	0.0000	0.8952	4.2570	3.9089e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+246	14.50	14.49	1.1146	0.1754	4.2717	0.0198	8.8802e-01	9.9665e-01	7.7767e-01	      	
+247	20.59	20.00	2.3223	0.4731	15.0731	1.1694	2.7953e-01	9.9665e-01	5.4816e-01	      	
+248	25.26	24.72	1.8599	0.5215	5.1605	1.0774	2.9928e-01	9.9665e-01	5.6729e-01	      	
+249	8.27	6.34	0.0000	0.0000	0.9911	3.8740	4.9040e-02	9.9665e-01	1.8565e-01	-     	Synonymous
+250	12.48	12.25	0.5205	0.0286	2.7173	0.4697	4.9313e-01	9.9665e-01	6.5183e-01	      	
+251	13.22	12.31	0.3186	0.0179	1.5320	1.8033	1.7932e-01	9.9665e-01	4.2698e-01	      	
+252	16.68	16.38	1.6893	0.3896	5.4393	0.6018	4.3788e-01	9.9665e-01	6.5183e-01	      	
+253	10.47	10.17	0.4843	0.0267	2.4709	0.6012	4.3812e-01	9.9665e-01	6.5183e-01	      	
+254	14.93	14.92	0.9369	0.2241	2.7669	0.0114	9.1491e-01	9.9665e-01	7.7976e-01	      	
+255	16.97	16.39	2.0910	0.4891	6.8279	1.1595	2.8158e-01	9.9665e-01	5.4816e-01	      	
+256	17.44	17.25	1.5661	0.3407	6.5825	0.3931	5.3068e-01	9.9665e-01	6.5183e-01	      	
+257	13.07	11.31	0.2295	0.0130	1.0522	3.5250	6.0451e-02	9.9665e-01	1.9792e-01	      	
+258	18.56	18.43	1.5223	0.2249	6.9481	0.2499	6.1714e-01	9.9665e-01	6.6595e-01	      	
+259	13.60	13.58	0.8035	0.0408	4.5132	0.0411	8.3939e-01	9.9665e-01	7.6268e-01	      	
+260	8.38	8.21	0.5635	0.0309	2.9192	0.3555	5.5102e-01	9.9665e-01	6.5358e-01	      	
+261	16.49	16.18	1.6929	0.3946	5.3725	0.6184	4.3164e-01	9.9665e-01	6.5183e-01	      	
+262	10.08	9.50	0.3873	0.0216	1.8726	1.1491	2.8375e-01	9.9665e-01	5.4867e-01	      	
+263	17.12	16.74	1.9099	0.4039	6.9453	0.7715	3.7974e-01	9.9665e-01	6.3794e-01	      	
+264	10.68	7.88	0.0000	0.0000	0.6705	5.5925	1.8038e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+265	18.08	15.66	0.0000	0.0000	0.7863	4.8317	2.7940e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+266	16.99	16.99	0.9957	0.1553	3.7685	0.0000	9.9549e-01	9.9665e-01	8.0210e-01	      	
+267	17.41	17.41	0.9918	0.1547	3.7861	0.0001	9.9144e-01	9.9665e-01	8.0210e-01	      	
+268	17.12	15.21	0.0000	0.0000	1.0055	3.8221	5.0579e-02	9.9665e-01	1.8565e-01	      	Synonymous
+269	16.95	16.91	0.8195	0.1315	2.8908	0.0761	7.8266e-01	9.9665e-01	7.5166e-01	      	
+270	19.58	17.89	2.8786	0.9242	7.8194	3.3755	6.6172e-02	9.9665e-01	2.1184e-01	      	
+271	9.30	8.94	0.4605	0.0255	2.2724	0.7106	3.9923e-01	9.9665e-01	6.4468e-01	      	
+272	8.30	8.27	0.8020	0.0428	5.7436	0.0436	8.3464e-01	9.9665e-01	7.6268e-01	      	
+273	19.08	18.00	2.5736	0.6982	7.6022	2.1560	1.4201e-01	9.9665e-01	3.5273e-01	      	
+274	21.74	19.89	3.0482	0.9783	8.2494	3.7095	5.4104e-02	9.9665e-01	1.8565e-01	      	
+275	10.33	6.83	0.0000	0.0000	0.5337	7.0024	8.1399e-03	9.9665e-01	1.8162e-01	--    	Synonymous
+276	13.96	13.94	0.8610	0.1367	3.0355	0.0416	8.3831e-01	9.9665e-01	7.6268e-01	      	
+277	10.45	7.91	0.0000	0.0000	0.7407	5.0904	2.4058e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+278	23.90	21.12	4.4958	1.3546	11.8598	5.5555	1.8423e-02	9.9665e-01	1.8162e-01	+     	
+279	11.01	10.83	0.5613	0.0306	2.8324	0.3619	5.4743e-01	9.9665e-01	6.5358e-01	      	
+280	21.21	20.58	2.0977	0.5522	8.2523	1.2764	2.5857e-01	9.9665e-01	5.2836e-01	      	
+281	25.53	23.89	4.6430	0.8729	17.8254	3.2730	7.0430e-02	9.9665e-01	2.2299e-01	      	
+282	13.18	13.17	0.8884	0.1378	3.3863	0.0241	8.7676e-01	9.9665e-01	7.7479e-01	      	
+283	26.27	25.86	1.9335	0.3768	6.5250	0.8121	3.6749e-01	9.9665e-01	6.3402e-01	      	
+284	24.14	24.05	0.7345	0.1159	2.7424	0.1792	6.7207e-01	9.9665e-01	7.0413e-01	      	
+285	6.55	4.05	0.0000	0.0000	0.7567	4.9994	2.5356e-02	9.9665e-01	1.8162e-01	-     	Constant
+286	25.56	24.84	2.2219	0.5492	6.8082	1.4405	2.3006e-01	9.9665e-01	4.9306e-01	      	
+287	7.89	6.07	0.0000	0.0000	1.0558	3.6539	5.5938e-02	9.9665e-01	1.8740e-01	      	Synonymous
+288	5.90	3.97	0.0000	0.0000	0.9983	3.8477	4.9813e-02	9.9665e-01	1.8565e-01	-     	Constant
+289	23.63	23.10	2.0540	0.4823	9.7051	1.0648	3.0213e-01	9.9665e-01	5.6894e-01	      	
+290	29.08	28.97	1.3644	0.2993	4.7652	0.2018	6.5325e-01	9.9665e-01	6.8942e-01	      	
+291	13.48	13.48	0.9560	0.1499	3.7178	0.0035	9.5277e-01	9.9665e-01	7.8977e-01	      	
+292	15.41	15.40	0.8876	0.1441	2.9656	0.0285	8.6592e-01	9.9665e-01	7.7339e-01	      	
+293	5.57	3.59	0.0000	0.0000	0.9635	3.9762	4.6147e-02	9.9665e-01	1.8565e-01	-     	Constant
+294	24.56	21.77	4.3163	1.2995	15.2601	5.5765	1.8204e-02	9.9665e-01	1.8162e-01	+     	
+295	13.06	13.05	0.9072	0.1319	3.3374	0.0166	8.9748e-01	9.9665e-01	7.7976e-01	      	
+296	5.19	4.98	0.0000	0.0000	11.5097	0.4249	5.1450e-01	9.9665e-01	6.5183e-01	      	Constant
+297	11.94	11.86	0.6770	0.0370	3.7207	0.1532	6.9549e-01	9.9665e-01	7.1311e-01	      	
+298	11.86	9.58	0.0000	0.0000	0.8342	4.5490	3.2938e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+299	16.21	16.01	1.4277	0.4185	3.8394	0.3936	5.3042e-01	9.9665e-01	6.5183e-01	      	
+300	18.34	17.66	2.1120	0.5538	7.0058	1.3574	2.4399e-01	9.9665e-01	5.0940e-01	      	
+301	10.83	10.17	0.3756	0.0214	1.7191	1.3213	2.5036e-01	9.9665e-01	5.1786e-01	      	
+302	22.46	22.43	1.1748	0.2689	4.4885	0.0584	8.0898e-01	9.9665e-01	7.6268e-01	      	
+303	15.96	15.95	1.1345	0.1737	4.8323	0.0252	8.7395e-01	9.9665e-01	7.7479e-01	      	
+304	15.65	15.63	1.1905	0.0902	4.0279	0.0480	8.2660e-01	9.9665e-01	7.6268e-01	      	
+305	25.83	23.76	3.4358	1.0506	10.9149	4.1360	4.1981e-02	9.9665e-01	1.8162e-01	+     	
+306	14.28	14.26	1.1787	0.1843	4.6130	0.0447	8.3265e-01	9.9665e-01	7.6268e-01	      	
+307	18.95	18.95	0.9272	0.2064	4.2753	0.0115	9.1446e-01	9.9665e-01	7.7976e-01	      	
+308	15.59	15.20	0.4465	0.0247	2.2530	0.7708	3.7997e-01	9.9665e-01	6.3794e-01	      	
+309	22.84	19.87	5.3505	1.4377	16.5732	5.9359	1.4835e-02	9.9665e-01	1.8162e-01	+     	
+310	18.17	17.91	0.5028	0.0277	2.7612	0.5216	4.7018e-01	9.9665e-01	6.5183e-01	      	
+311	4.79	4.42	0.0000	0.0000	6.9340	0.7239	3.9487e-01	9.9665e-01	6.4468e-01	      	Constant
+312	3.86	3.64	0.0000	0.0000	26.4150	0.4278	5.1309e-01	9.9665e-01	6.5183e-01	     !	Constant
+313	3.77	3.58	0.0000	0.0000	21.6675	0.3742	5.4071e-01	9.9665e-01	6.5183e-01	      	Constant
+314	3.77	3.58	0.0000	0.0000	16.0186	0.3850	5.3492e-01	9.9665e-01	6.5183e-01	      	Constant
+315	4.43	4.20	0.0000	0.0000	12.0752	0.4583	4.9843e-01	9.9665e-01	6.5183e-01	      	Constant
+316	3.60	3.46	0.0000	0.0000	41.2708	0.2827	5.9494e-01	9.9665e-01	6.5358e-01	     !	Constant
+317	9.65	9.51	0.5965	0.0327	3.0900	0.2830	5.9477e-01	9.9665e-01	6.5358e-01	      	
+318	9.68	9.54	0.6024	0.0335	3.0518	0.2801	5.9661e-01	9.9665e-01	6.5358e-01	      	
+319	6.14	5.43	0.0000	0.0000	3.3766	1.4124	2.3465e-01	9.9665e-01	4.9711e-01	      	Synonymous
+320	6.93	6.66	2.5792	0.1274	99.0000	0.5305	4.6638e-01	9.9665e-01	6.5183e-01	      	
+321	4.46	3.91	0.0000	0.0000	9.1411	1.0924	2.9594e-01	9.9665e-01	5.6729e-01	     !	Constant
+322	8.54	6.46	99.0000	1.2548	99.0000	4.1483	4.1676e-02	9.9665e-01	1.8162e-01	+    !	
+323	4.16	4.16	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+324	4.22	4.22	1.0000	0.0000	inf	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	     !	Single char
+325	15.49	14.14	5.0804	0.6606	17.4111	2.7015	1.0025e-01	9.9665e-01	2.7249e-01	      	
+326	4.90	4.03	0.0000	0.0000	2.4418	1.7446	1.8655e-01	9.9665e-01	4.4057e-01	      	Constant
+327	3.85	3.63	0.0000	0.0000	10.1236	0.4424	5.0594e-01	9.9665e-01	6.5183e-01	      	Constant
+328	4.74	4.31	0.0000	0.0000	4.8298	0.8596	3.5384e-01	9.9665e-01	6.3226e-01	      	Constant
+329	10.03	8.56	0.0000	0.0000	1.3507	2.9421	8.6300e-02	9.9665e-01	2.5116e-01	      	Synonymous
+330	7.25	6.21	0.0000	0.0000	2.0179	2.0795	1.4929e-01	9.9665e-01	3.6144e-01	      	Synonymous
+331	14.19	13.43	0.0000	0.0000	3.1688	1.5073	2.1955e-01	9.9665e-01	4.8386e-01	      	Synonymous
+332	6.24	4.87	0.0000	0.0000	1.4514	2.7424	9.7716e-02	9.9665e-01	2.6813e-01	      	Constant
+333	13.65	13.46	0.5497	0.0301	3.1085	0.3812	5.3695e-01	9.9665e-01	6.5183e-01	      	
+334	5.52	4.68	0.0000	0.0000	2.4404	1.6799	1.9493e-01	9.9665e-01	4.5285e-01	      	Constant
+335	10.82	10.61	1.6707	0.2640	6.2352	0.4078	5.2311e-01	9.9665e-01	6.5183e-01	      	
+336	10.84	10.78	0.7034	0.0377	4.6282	0.1150	7.3449e-01	9.9665e-01	7.3188e-01	      	
+337	10.60	10.60	0.9762	0.0551	4.8925	0.0006	9.8107e-01	9.9665e-01	8.0074e-01	      	
+338	11.14	10.77	0.4492	0.0248	2.4135	0.7407	3.8945e-01	9.9665e-01	6.4468e-01	      	
+339	15.17	15.17	0.9205	0.1140	8.2161	0.0033	9.5392e-01	9.9665e-01	7.8977e-01	      	
+340	13.93	13.74	0.5501	0.0301	2.8913	0.3857	5.3456e-01	9.9665e-01	6.5183e-01	      	
+341	3.74	3.49	0.0000	0.0000	11.6741	0.5031	4.7814e-01	9.9665e-01	6.5183e-01	      	Constant
+342	3.77	3.58	0.0000	0.0000	16.0186	0.3850	5.3492e-01	9.9665e-01	6.5183e-01	      	Constant
+343	5.91	5.08	6.0030	0.2844	99.0000	1.6523	1.9865e-01	9.9665e-01	4.5424e-01	     !	
+344	7.63	7.22	99.0000	0.0000	99.0000	0.8379	3.5999e-01	9.9665e-01	6.3226e-01	     !	Synonymous
+345	17.66	17.58	1.4222	0.2040	8.4045	0.1618	6.8749e-01	9.9665e-01	7.1251e-01	      	
+346	21.92	21.41	1.9647	0.4660	6.1833	1.0051	3.1609e-01	9.9665e-01	5.8755e-01	      	
+347	17.04	16.62	0.4096	0.0220	2.4237	0.8449	3.5800e-01	9.9665e-01	6.3226e-01	      	
+348	12.78	12.76	0.8517	0.1367	2.9391	0.0495	8.2402e-01	9.9665e-01	7.6268e-01	      	
+349	8.39	6.53	0.0000	0.0000	1.0341	3.7244	5.3624e-02	9.9665e-01	1.8565e-01	      	Synonymous
+350	8.83	6.54	0.0000	0.0000	0.8297	4.5883	3.2191e-02	9.9665e-01	1.8162e-01	-     	Synonymous
+351	22.16	20.02	4.1256	1.0875	13.2232	4.2720	3.8745e-02	9.9665e-01	1.8162e-01	+     	
+352	7.09	4.22	0.0000	0.0000	0.6621	5.7329	1.6650e-02	9.9665e-01	1.8162e-01	-     	Constant
+353	23.71	22.37	2.6437	0.8068	7.8708	2.6822	1.0147e-01	9.9665e-01	2.7324e-01	      	
+354	24.23	24.18	1.2181	0.2680	4.5451	0.0816	7.7511e-01	9.9665e-01	7.4940e-01	      	
+355	8.96	7.72	0.0000	0.0000	1.6227	2.4678	1.1620e-01	9.9665e-01	3.0436e-01	      	Synonymous
+356	7.13	5.05	0.0000	0.0000	0.9175	4.1640	4.1291e-02	9.9665e-01	1.8162e-01	-     	Constant
+357	9.63	9.17	0.4189	0.0233	2.0534	0.9321	3.3431e-01	9.9665e-01	6.0962e-01	      	
+358	15.15	14.61	0.5030	0.0817	1.6982	1.0795	2.9881e-01	9.9665e-01	5.6729e-01	      	
+359	10.22	9.46	0.3525	0.0199	1.6294	1.5044	2.2000e-01	9.9665e-01	4.8386e-01	      	
+360	5.89	3.83	0.0000	0.0000	0.9262	4.1257	4.2236e-02	9.9665e-01	1.8162e-01	-     	Constant
+361	13.30	11.44	0.0000	0.0000	1.0358	3.7207	5.3743e-02	9.9665e-01	1.8565e-01	      	Synonymous
+362	11.61	11.56	0.8045	0.1288	2.7974	0.0910	7.6295e-01	9.9665e-01	7.4507e-01	      	
+363	5.72	4.53	0.0000	0.0000	1.6804	2.3752	1.2328e-01	9.9665e-01	3.1156e-01	      	Constant
+364	14.35	13.29	2.7052	0.6648	7.9964	2.1348	1.4399e-01	9.9665e-01	3.5459e-01	      	
+365	6.55	4.05	0.0000	0.0000	0.7567	4.9994	2.5356e-02	9.9665e-01	1.8162e-01	-     	Constant
+366	9.25	8.56	0.3640	0.0204	1.6991	1.3771	2.4060e-01	9.9665e-01	5.0599e-01	      	
+367	9.83	8.09	0.0000	0.0000	1.1095	3.4873	6.1841e-02	9.9665e-01	2.0020e-01	      	Synonymous
+368	11.24	11.21	1.2432	0.0763	5.4842	0.0483	8.2613e-01	9.9665e-01	7.6268e-01	      	
+369	9.98	9.75	0.5207	0.0285	2.7557	0.4633	4.9607e-01	9.9665e-01	6.5183e-01	      	
+370	11.87	9.36	0.1868	0.0106	0.8482	5.0139	2.5144e-02	9.9665e-01	1.8162e-01	-     	
+371	13.58	12.47	0.2801	0.0156	1.4035	2.2177	1.3644e-01	9.9665e-01	3.4183e-01	      	
+372	7.09	4.66	0.0000	0.0000	0.7818	4.8446	2.7733e-02	9.9665e-01	1.8162e-01	-     	Constant
+373	9.74	9.42	0.4821	0.0269	2.3688	0.6314	4.2685e-01	9.9665e-01	6.5183e-01	      	
+374	17.93	17.79	1.5485	0.2362	5.9899	0.2848	5.9358e-01	9.9665e-01	6.5358e-01	      	
+375	5.89	3.83	0.0000	0.0000	0.9262	4.1257	4.2236e-02	9.9665e-01	1.8162e-01	-     	Constant
@@ -0,0 +1,201 @@
+Site	Neutral	Optimal	Omega	Lower	Upper	LrtStat	Pvalue	AdjPvalue	Qvalue	Result	Note
+1	8.62	8.62	1.0000	1.0000	3.1605	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+2	20.33	20.28	1.2856	1.0000	4.5377	0.1077	3.7139e-01	1.0000e+00	1.0000e+00	      	
+3	8.87	8.87	1.0000	1.0000	2.6401	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+4	6.98	6.98	1.0000	1.0000	2.2043	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+5	11.08	11.08	1.0000	1.0000	3.2297	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+6	6.30	6.30	1.0000	1.0000	3.2363	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+7	5.31	5.31	1.0000	1.0000	3.3913	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+8	19.76	18.04	3.8475	1.0000	12.4609	3.4505	3.1616e-02	1.0000e+00	1.0000e+00	+     	
+9	4.61	4.61	1.0000	1.0000	2.5833	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+10	11.64	11.64	1.0000	1.0000	2.3464	0.0000	5.0000e-01	1.0000e+00	1.0000e+00	      	
+11	12.65	12.65	1.0000	1.0000	2.1716	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+12	5.83	5.83	1.0000	1.0000	2.6190	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+13	8.79	8.79	1.0000	1.0000	2.2916	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+14	8.85	8.85	1.0000	1.0000	2.4101	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+15	5.30	5.30	1.0000	1.0000	2.6288	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+16	4.61	4.61	1.0000	1.0000	2.5833	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+17	6.83	6.83	1.0000	1.0000	2.1991	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+18	7.24	7.24	1.0000	1.0000	1.8708	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+19	9.98	9.98	1.0000	1.0000	2.4742	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+20	7.30	7.30	1.0000	1.0000	2.3967	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+21	8.77	8.77	1.0000	1.0000	2.9536	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+22	6.27	6.27	1.0000	1.0000	2.0716	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+23	6.48	6.48	1.0000	1.0000	2.1755	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+24	8.93	8.93	1.0000	1.0000	2.3184	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+25	7.28	7.27	1.1194	1.0000	5.4823	0.0116	4.5711e-01	1.0000e+00	1.0000e+00	      	
+26	10.35	10.35	1.0000	1.0000	2.0249	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+27	5.46	5.46	1.0000	1.0000	2.9859	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+28	9.08	9.08	1.0000	1.0000	2.1036	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+29	8.83	8.83	1.0000	1.0000	3.6268	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+30	16.21	15.84	2.0426	1.0000	8.6150	0.7335	1.9587e-01	1.0000e+00	1.0000e+00	      	
+31	13.27	13.20	1.3351	1.0000	4.7971	0.1409	3.5368e-01	1.0000e+00	1.0000e+00	      	
+32	8.23	8.23	1.0000	1.0000	4.1599	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+33	9.12	9.12	1.0000	1.0000	2.5690	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+34	9.01	9.00	1.2007	1.0000	5.8187	0.0302	4.3107e-01	1.0000e+00	1.0000e+00	      	
+35	6.45	6.45	1.0000	1.0000	1.9643	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+36	7.42	7.42	1.0000	1.0000	1.8718	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+37	15.50	15.13	2.0413	1.0000	8.6929	0.7259	1.9710e-01	1.0000e+00	1.0000e+00	      	
+38	4.77	4.77	1.0000	1.0000	2.5617	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+39	10.08	10.08	1.0000	1.0000	2.7247	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+40	6.09	6.09	1.0000	1.0000	2.3262	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+41	5.91	5.91	1.0000	1.0000	2.2181	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+42	8.59	8.59	1.0000	1.0000	3.7352	0.0000	5.0000e-01	1.0000e+00	1.0000e+00	      	
+43	12.46	12.46	1.0000	1.0000	2.1164	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+44	22.03	22.02	1.1461	1.0000	11.1925	0.0148	4.5157e-01	1.0000e+00	1.0000e+00	      	
+45	14.98	14.98	1.0000	1.0000	1.8701	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+46	6.24	6.24	1.0000	1.0000	2.5078	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+47	5.12	5.12	1.0000	1.0000	2.7598	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+48	15.65	15.65	1.0000	1.0000	2.9628	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+49	5.49	5.49	1.0000	1.0000	2.3958	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+50	5.30	5.30	1.0000	1.0000	2.6288	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+51	22.81	19.79	4.8881	1.4373	17.3552	6.0259	7.0488e-03	1.0000e+00	1.0000e+00	++    	
+52	6.25	6.25	1.0000	1.0000	3.2641	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+53	6.30	6.30	1.0000	1.0000	2.3625	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+54	5.12	5.12	1.0000	1.0000	2.7598	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+55	4.90	4.90	1.0000	1.0000	2.7519	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+56	12.11	12.11	1.0000	1.0000	2.9871	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+57	4.75	4.75	1.0000	1.0000	2.3091	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+58	9.27	9.27	1.0000	1.0000	2.3268	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+59	10.25	10.25	1.0000	1.0000	2.1103	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+60	4.24	4.24	1.0000	1.0000	3.2366	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+61	6.10	6.10	1.0000	1.0000	2.5342	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+62	5.02	5.02	1.0000	1.0000	2.7097	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+63	14.44	14.44	1.0000	1.0000	3.9720	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+64	8.53	8.53	1.0000	1.0000	4.4026	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+65	4.75	4.75	1.0000	1.0000	2.3091	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+66	4.61	4.61	1.0000	1.0000	2.5833	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+67	10.14	10.14	1.0000	1.0000	2.2034	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+68	10.58	10.58	1.0000	1.0000	2.9113	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+69	9.91	9.91	1.0000	1.0000	2.5580	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+70	11.34	11.34	1.0000	1.0000	2.1490	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+71	11.47	11.17	1.8831	1.0000	6.6749	0.6114	2.1713e-01	1.0000e+00	1.0000e+00	      	
+72	6.10	6.10	1.0000	1.0000	2.1450	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+73	4.61	4.61	1.0000	1.0000	2.5833	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+74	5.30	5.30	1.0000	1.0000	2.6288	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+75	9.22	9.22	1.0000	1.0000	2.4015	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+76	7.75	7.75	1.0000	1.0000	1.8695	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+77	9.67	9.67	1.0000	1.0000	2.9307	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+78	7.99	7.99	1.0000	1.0000	2.9258	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+79	6.30	6.30	1.0000	1.0000	2.3625	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+80	8.85	8.85	1.0000	1.0000	2.4101	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+81	11.69	11.58	1.4395	1.0000	5.1199	0.2182	3.2022e-01	1.0000e+00	1.0000e+00	      	
+82	8.46	8.46	1.0000	1.0000	2.6637	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+83	4.75	4.75	1.0000	1.0000	2.3091	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+84	8.20	8.20	1.0000	1.0000	2.7140	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+85	6.25	6.25	1.0000	1.0000	3.2641	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+86	9.20	9.20	1.0000	1.0000	2.5522	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+87	4.75	4.75	1.0000	1.0000	2.3091	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+88	4.61	4.61	1.0000	1.0000	2.5833	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+89	9.12	9.12	1.0000	1.0000	2.5690	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+90	6.45	6.45	1.0000	1.0000	2.3059	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+91	9.96	9.95	1.1624	1.0000	5.1126	0.0226	4.4022e-01	1.0000e+00	1.0000e+00	      	
+92	12.35	12.35	1.0000	1.0000	1.9823	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+93	8.35	8.34	1.1129	1.0000	5.4182	0.0105	4.5910e-01	1.0000e+00	1.0000e+00	      	
+94	16.45	16.42	1.1966	1.0000	4.2548	0.0562	4.0628e-01	1.0000e+00	1.0000e+00	      	
+95	16.74	15.61	3.3458	1.0000	15.0454	2.2639	6.6212e-02	1.0000e+00	1.0000e+00	      	
+96	10.07	10.07	1.0000	1.0000	2.8741	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+97	5.91	5.91	1.0000	1.0000	2.2181	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+98	17.24	17.24	1.0000	1.0000	3.1613	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+99	9.92	9.92	1.0000	1.0000	1.8957	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+100	5.49	5.49	1.0000	1.0000	2.3958	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+101	10.24	10.24	1.0000	1.0000	2.7968	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+102	9.56	9.56	1.0000	1.0000	3.4236	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+103	5.23	5.23	1.0000	1.0000	2.8240	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+104	13.90	13.90	1.0000	1.0000	2.4865	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+105	6.80	6.80	1.0000	1.0000	2.2895	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+106	27.52	25.34	6.5626	1.0952	38.1300	4.3449	1.8560e-02	1.0000e+00	1.0000e+00	+     	
+107	4.75	4.75	1.0000	1.0000	2.3091	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+108	9.01	9.01	1.0000	1.0000	3.3675	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+109	11.72	11.72	1.0000	1.0000	2.0034	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+110	7.96	7.96	1.0000	1.0000	2.6003	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+111	5.81	5.81	1.0000	1.0000	2.2882	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+112	7.20	7.20	1.0000	1.0000	2.1962	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+113	4.24	4.24	1.0000	1.0000	3.2366	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+114	7.08	7.08	1.0000	1.0000	2.1049	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+115	5.12	5.12	1.0000	1.0000	2.7598	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+116	5.49	5.49	1.0000	1.0000	2.3958	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+117	10.79	10.79	1.0000	1.0000	3.6219	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+118	4.75	4.75	1.0000	1.0000	2.3091	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+119	6.09	6.09	1.0000	1.0000	2.3262	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+120	6.44	6.44	1.0000	1.0000	2.3384	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+121	6.17	6.17	1.0000	1.0000	2.6050	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+122	5.23	5.23	1.0000	1.0000	2.8240	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+123	4.24	4.24	1.0000	1.0000	3.2366	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+124	8.83	8.83	1.0520	1.0000	5.0730	0.0024	4.8038e-01	1.0000e+00	1.0000e+00	      	
+125	9.49	9.49	1.0000	1.0000	2.3058	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+126	12.20	12.19	1.1670	1.0000	5.6991	0.0220	4.4106e-01	1.0000e+00	1.0000e+00	      	
+127	6.07	6.07	1.0000	1.0000	2.2638	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+128	5.02	5.02	1.0000	1.0000	2.7097	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+129	5.83	5.83	1.0000	1.0000	2.6190	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+130	9.86	9.86	1.0000	1.0000	1.9165	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+131	12.20	12.20	1.0000	1.0000	4.1988	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+132	13.52	13.16	2.0130	1.0000	7.7316	0.7159	1.9875e-01	1.0000e+00	1.0000e+00	      	
+133	6.53	6.53	1.0000	1.0000	2.0561	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+134	12.94	12.56	2.0302	1.0000	7.1073	0.7571	1.9212e-01	1.0000e+00	1.0000e+00	      	
+135	9.10	9.10	1.0000	1.0000	2.5692	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+136	8.38	8.38	1.0000	1.0000	4.0864	-0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+137	4.77	4.77	1.0000	1.0000	2.5617	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+138	4.24	4.24	1.0000	1.0000	3.2366	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+139	9.55	9.55	1.0000	1.0000	2.2670	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+140	6.07	6.07	1.0000	1.0000	2.2638	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+141	15.89	15.88	1.1269	1.0000	3.9448	0.0261	4.3584e-01	1.0000e+00	1.0000e+00	      	
+142	8.85	8.84	1.1431	1.0000	5.4882	0.0164	4.4900e-01	1.0000e+00	1.0000e+00	      	
+143	6.27	6.27	1.0000	1.0000	2.0716	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+144	4.77	4.77	1.0000	1.0000	2.5617	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+145	8.05	8.05	1.0000	1.0000	2.5319	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+146	8.48	8.48	1.0000	1.0000	2.9915	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+147	5.83	5.83	1.0000	1.0000	2.6190	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+148	4.77	4.77	1.0000	1.0000	2.5617	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+149	9.53	9.53	1.0000	1.0000	4.3154	-0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+150	9.59	9.59	1.0000	1.0000	3.2099	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+151	8.16	8.16	1.0000	1.0000	3.8713	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+152	9.95	9.95	1.0000	1.0000	3.4340	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+153	6.44	6.44	1.0000	1.0000	2.3384	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+154	14.98	14.98	1.0000	1.0000	4.5992	-0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+155	12.84	12.84	1.0000	1.0000	3.6152	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+156	12.02	12.02	1.0000	1.0000	3.5820	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+157	6.45	6.45	1.0000	1.0000	1.9643	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+158	15.25	15.25	1.0000	1.0000	3.0745	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+159	6.24	6.24	1.0000	1.0000	2.5078	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+160	10.45	10.45	1.0000	1.0000	3.2545	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+161	5.70	5.70	1.0000	1.0000	2.5848	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+162	6.87	6.87	1.0000	1.0000	2.1153	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+163	12.41	12.41	1.0000	1.0000	3.2950	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+164	12.46	12.46	1.0000	1.0000	2.3743	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+165	9.54	9.54	1.0000	1.0000	2.3490	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+166	8.69	8.69	1.0000	1.0000	2.4763	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+167	8.48	8.48	1.0000	1.0000	1.7045	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+168	8.40	8.40	1.0351	1.0000	4.9840	0.0011	4.8662e-01	1.0000e+00	1.0000e+00	      	
+169	8.09	8.09	1.0000	1.0000	3.0316	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+170	11.13	10.64	2.2759	1.0000	8.2337	0.9793	1.6119e-01	1.0000e+00	1.0000e+00	      	
+171	9.80	9.80	1.0000	1.0000	3.1513	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+172	9.32	9.32	1.0000	1.0000	2.4342	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+173	9.75	9.75	1.0000	1.0000	2.8149	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+174	4.90	4.90	1.0000	1.0000	2.7519	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+175	6.83	6.83	1.0000	1.0000	2.1991	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+176	15.08	15.08	1.0000	1.0000	2.6673	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+177	5.07	5.07	1.0000	1.0000	2.9210	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+178	5.49	5.49	1.0000	1.0000	2.3958	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+179	14.50	14.50	1.0000	1.0000	4.7543	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+180	10.63	10.63	1.0000	1.0000	3.1119	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+181	6.41	6.41	1.0000	1.0000	2.2272	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+182	5.31	5.31	1.0000	1.0000	3.3913	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+183	14.75	14.75	1.0000	1.0000	3.1917	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	
+184	11.64	11.64	1.0000	1.0000	1.9667	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+185	6.10	6.10	1.0000	1.0000	2.5342	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+186	5.02	5.02	1.0000	1.0000	2.7097	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+187	16.15	15.28	2.5311	1.0000	9.0358	1.7361	9.3818e-02	1.0000e+00	1.0000e+00	      	
+188	9.78	9.78	1.0000	1.0000	2.2774	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+189	11.71	11.71	1.0000	1.0000	2.9014	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+190	4.24	4.24	1.0000	1.0000	3.2366	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+191	8.64	8.64	1.0000	1.0000	2.2854	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+192	6.07	6.07	1.0000	1.0000	2.2638	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+193	14.19	13.36	2.4431	1.0000	7.6069	1.6691	9.8187e-02	1.0000e+00	1.0000e+00	      	
+194	5.81	5.81	1.0000	1.0000	2.2882	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+195	9.75	9.75	1.0000	1.0000	2.7812	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+196	6.10	6.10	1.0000	1.0000	2.1450	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+197	5.70	5.70	1.0000	1.0000	2.5848	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+198	5.23	5.23	1.0000	1.0000	2.8240	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Constant
+199	11.81	11.81	1.0000	1.0000	2.7955	0.0000	1.0000e+00	1.0000e+00	1.0000e+00	      	Synonymous
+200	11.20	10.97	1.7351	1.0000	6.2041	0.4745	2.4546e-01	1.0000e+00	1.0000e+00	      	
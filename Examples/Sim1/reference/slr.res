@@ -0,0 +1,201 @@
+Site	Neutral	Optimal	Omega	Lower	Upper	LrtStat	Pvalue	AdjPvalue	Qvalue	Result	Note
+1	4.33	4.04	0.0000	0.0000	6.8642	0.5673	4.5135e-01	5.7004e-01	5.7592e-03	      	Constant
+2	3.97	3.67	0.0000	0.0000	6.5415	0.5980	4.3935e-01	5.7004e-01	5.7592e-03	      	Constant
+3	5.29	4.72	0.0000	0.0000	3.3538	1.1508	2.8337e-01	5.7004e-01	5.7592e-03	      	Constant
+4	9.40	9.10	0.0000	0.0000	6.5621	0.5967	4.3983e-01	5.7004e-01	5.7592e-03	      	Synonymous
+5	5.68	5.16	0.0000	0.0000	3.7093	1.0409	3.0761e-01	5.7004e-01	5.7592e-03	      	Constant
+6	3.30	3.08	0.0000	0.0000	8.8918	0.4465	5.0399e-01	5.7004e-01	5.8556e-03	      	Constant
+7	3.89	3.60	0.0000	0.0000	6.6153	0.5923	4.4153e-01	5.7004e-01	5.7592e-03	      	Constant
+8	3.69	3.41	0.0000	0.0000	7.0451	0.5573	4.5536e-01	5.7004e-01	5.7592e-03	      	Constant
+9	17.11	16.54	0.0000	0.0000	3.3862	1.1392	2.8582e-01	5.7004e-01	5.7592e-03	      	Synonymous
+10	13.90	13.62	0.0000	0.0000	6.9386	0.5665	4.5165e-01	5.7004e-01	5.7592e-03	      	Synonymous
+11	5.48	4.91	0.0000	0.0000	3.3862	1.1391	2.8584e-01	5.7004e-01	5.7592e-03	      	Constant
+12	4.09	3.79	0.0000	0.0000	6.4519	0.6059	4.3634e-01	5.7004e-01	5.7592e-03	      	Constant
+13	5.34	4.78	0.0000	0.0000	3.4885	1.1061	2.9293e-01	5.7004e-01	5.7592e-03	      	Constant
+14	3.69	3.41	0.0000	0.0000	7.0451	0.5573	4.5536e-01	5.7004e-01	5.7592e-03	      	Constant
+15	3.71	3.41	0.0000	0.0000	6.6099	0.5951	4.4046e-01	5.7004e-01	5.7592e-03	      	Constant
+16	20.97	20.34	4.2488	0.2254	26.5474	1.2739	2.5904e-01	5.7004e-01	5.7592e-03	      	
+17	5.17	4.72	0.0000	0.0000	4.3310	0.8933	3.4459e-01	5.7004e-01	5.7592e-03	      	Constant
+18	4.66	4.35	0.0000	0.0000	6.1627	0.6328	4.2632e-01	5.7004e-01	5.7592e-03	      	Constant
+19	3.71	3.41	0.0000	0.0000	6.6099	0.5951	4.4046e-01	5.7004e-01	5.7592e-03	      	Constant
+20	4.80	4.43	0.0000	0.0000	5.1389	0.7536	3.8532e-01	5.7004e-01	5.7592e-03	      	Constant
+21	5.16	4.87	0.0000	0.0000	6.6611	0.5832	4.4508e-01	5.7004e-01	5.7592e-03	      	Constant
+22	5.97	5.38	0.0000	0.0000	3.2422	1.1892	2.7549e-01	5.7004e-01	5.7592e-03	      	Constant
+23	4.65	4.33	0.0000	0.0000	6.1933	0.6299	4.2738e-01	5.7004e-01	5.7592e-03	      	Constant
+24	3.55	3.26	0.0000	0.0000	6.7799	0.5792	4.4662e-01	5.7004e-01	5.7592e-03	      	Constant
+25	4.86	4.30	0.0000	0.0000	3.4969	1.1043	2.9332e-01	5.7004e-01	5.7592e-03	      	Constant
+26	3.69	3.41	0.0000	0.0000	7.0451	0.5573	4.5536e-01	5.7004e-01	5.7592e-03	      	Constant
+27	4.71	4.35	0.0000	0.0000	5.4273	0.7162	3.9738e-01	5.7004e-01	5.7592e-03	      	Constant
+28	4.79	4.31	0.0000	0.0000	3.9757	0.9731	3.2391e-01	5.7004e-01	5.7592e-03	      	Constant
+29	5.34	4.78	0.0000	0.0000	3.4885	1.1061	2.9293e-01	5.7004e-01	5.7592e-03	      	Constant
+30	4.38	4.06	0.0000	0.0000	6.1287	0.6365	4.2498e-01	5.7004e-01	5.7592e-03	      	Constant
+31	4.32	4.00	0.0000	0.0000	6.0574	0.6435	4.2244e-01	5.7004e-01	5.7592e-03	      	Constant
+32	4.75	4.39	0.0000	0.0000	5.3714	0.7234	3.9503e-01	5.7004e-01	5.7592e-03	      	Constant
+33	4.09	3.79	0.0000	0.0000	6.4519	0.6059	4.3634e-01	5.7004e-01	5.7592e-03	      	Constant
+34	3.71	3.41	0.0000	0.0000	6.6099	0.5951	4.4046e-01	5.7004e-01	5.7592e-03	      	Constant
+35	3.55	3.26	0.0000	0.0000	6.7799	0.5792	4.4662e-01	5.7004e-01	5.7592e-03	      	Constant
+36	8.34	8.07	0.0000	0.0000	7.3319	0.5512	4.5783e-01	5.7004e-01	5.7592e-03	      	Synonymous
+37	4.77	4.40	0.0000	0.0000	5.3194	0.7298	3.9296e-01	5.7004e-01	5.7592e-03	      	Constant
+38	3.37	3.10	0.0000	0.0000	7.1260	0.5518	4.5760e-01	5.7004e-01	5.7592e-03	      	Constant
+39	4.66	4.35	0.0000	0.0000	6.1627	0.6328	4.2632e-01	5.7004e-01	5.7592e-03	      	Constant
+40	10.28	9.75	0.0000	0.0000	3.6542	1.0641	3.0227e-01	5.7004e-01	5.7592e-03	      	Synonymous
+41	3.55	3.26	0.0000	0.0000	6.7799	0.5792	4.4662e-01	5.7004e-01	5.7592e-03	      	Constant
+42	3.30	3.08	0.0000	0.0000	8.8918	0.4465	5.0399e-01	5.7004e-01	5.8556e-03	      	Constant
+43	3.55	3.26	0.0000	0.0000	6.7799	0.5792	4.4662e-01	5.7004e-01	5.7592e-03	      	Constant
+44	3.30	3.08	0.0000	0.0000	8.8918	0.4465	5.0399e-01	5.7004e-01	5.8556e-03	      	Constant
+45	11.46	11.06	0.0000	0.0000	4.8499	0.7988	3.7145e-01	5.7004e-01	5.7592e-03	      	Synonymous
+46	4.09	3.79	0.0000	0.0000	6.4519	0.6059	4.3634e-01	5.7004e-01	5.7592e-03	      	Constant
+47	6.23	5.46	0.0000	0.0000	2.4928	1.5443	2.1398e-01	5.7004e-01	5.7592e-03	      	Constant
+48	5.19	4.82	0.0000	0.0000	5.1994	0.7469	3.8746e-01	5.7004e-01	5.7592e-03	      	Constant
+49	4.80	4.43	0.0000	0.0000	5.1389	0.7536	3.8532e-01	5.7004e-01	5.7592e-03	      	Constant
+50	4.60	4.25	0.0000	0.0000	5.5385	0.7030	4.0178e-01	5.7004e-01	5.7592e-03	      	Constant
+51	16.49	16.32	1.8991	0.1080	8.4677	0.3344	5.6310e-01	5.7004e-01	6.4765e-03	      	
+52	3.89	3.60	0.0000	0.0000	6.6153	0.5923	4.4153e-01	5.7004e-01	5.7592e-03	      	Constant
+53	4.03	3.71	0.0000	0.0000	6.2807	0.6217	4.3042e-01	5.7004e-01	5.7592e-03	      	Constant
+54	9.90	9.52	0.0000	0.0000	5.1994	0.7501	3.8645e-01	5.7004e-01	5.7592e-03	      	Synonymous
+55	3.89	3.67	0.0000	0.0000	8.6920	0.4543	5.0032e-01	5.7004e-01	5.8556e-03	      	Constant
+56	10.79	10.43	2.7017	0.1528	12.2961	0.7207	3.9593e-01	5.7004e-01	5.7592e-03	      	
+57	4.03	3.71	0.0000	0.0000	6.2807	0.6217	4.3042e-01	5.7004e-01	5.7592e-03	      	Constant
+58	4.38	4.06	0.0000	0.0000	6.1287	0.6365	4.2498e-01	5.7004e-01	5.7592e-03	      	Constant
+59	4.46	3.83	0.0000	0.0000	3.0791	1.2537	2.6285e-01	5.7004e-01	5.7592e-03	      	Constant
+60	3.69	3.41	0.0000	0.0000	7.0451	0.5573	4.5536e-01	5.7004e-01	5.7592e-03	      	Constant
+61	4.47	3.99	0.0000	0.0000	4.0128	0.9643	3.2611e-01	5.7004e-01	5.7592e-03	      	Constant
+62	3.30	3.08	0.0000	0.0000	8.8918	0.4465	5.0399e-01	5.7004e-01	5.8556e-03	      	Constant
+63	6.07	5.47	0.0000	0.0000	3.2226	1.1964	2.7404e-01	5.7004e-01	5.7592e-03	      	Constant
+64	3.30	3.08	0.0000	0.0000	8.8918	0.4465	5.0399e-01	5.7004e-01	5.8556e-03	      	Constant
+65	6.14	5.60	0.0000	0.0000	3.5485	1.0875	2.9702e-01	5.7004e-01	5.7592e-03	      	Constant
+66	3.37	3.10	0.0000	0.0000	7.1260	0.5518	4.5760e-01	5.7004e-01	5.7592e-03	      	Constant
+67	4.60	4.25	0.0000	0.0000	5.5385	0.7030	4.0178e-01	5.7004e-01	5.7592e-03	      	Constant
+68	5.04	4.61	0.0000	0.0000	4.4737	0.8644	3.5251e-01	5.7004e-01	5.7592e-03	      	Constant
+69	4.86	4.30	0.0000	0.0000	3.4969	1.1043	2.9332e-01	5.7004e-01	5.7592e-03	      	Constant
+70	4.33	4.04	0.0000	0.0000	6.8642	0.5673	4.5135e-01	5.7004e-01	5.7592e-03	      	Constant
+71	4.03	3.71	0.0000	0.0000	6.2807	0.6217	4.3042e-01	5.7004e-01	5.7592e-03	      	Constant
+72	4.69	4.33	0.0000	0.0000	5.3682	0.7244	3.9472e-01	5.7004e-01	5.7592e-03	      	Constant
+73	9.01	8.71	0.0000	0.0000	6.5319	0.5988	4.3902e-01	5.7004e-01	5.7592e-03	      	Synonymous
+74	4.21	3.91	0.0000	0.0000	6.4306	0.6046	4.3684e-01	5.7004e-01	5.7592e-03	      	Constant
+75	8.34	8.07	0.0000	0.0000	7.3319	0.5512	4.5783e-01	5.7004e-01	5.7592e-03	      	Synonymous
+76	10.97	10.81	1.8765	0.1066	8.4050	0.3226	5.7004e-01	5.7004e-01	6.5236e-03	      	
+77	4.85	4.32	0.0000	0.0000	3.6607	1.0555	3.0424e-01	5.7004e-01	5.7592e-03	      	Constant
+78	4.91	4.48	0.0000	0.0000	4.4877	0.8638	3.5268e-01	5.7004e-01	5.7592e-03	      	Constant
+79	3.30	3.08	0.0000	0.0000	8.8918	0.4465	5.0399e-01	5.7004e-01	5.8556e-03	      	Constant
+80	4.09	3.79	0.0000	0.0000	6.4519	0.6059	4.3634e-01	5.7004e-01	5.7592e-03	      	Constant
+81	4.32	4.00	0.0000	0.0000	6.0574	0.6435	4.2244e-01	5.7004e-01	5.7592e-03	      	Constant
+82	3.89	3.67	0.0000	0.0000	8.6920	0.4543	5.0032e-01	5.7004e-01	5.8556e-03	      	Constant
+83	5.17	4.72	0.0000	0.0000	4.3310	0.8933	3.4459e-01	5.7004e-01	5.7592e-03	      	Constant
+84	3.37	3.10	0.0000	0.0000	7.1260	0.5518	4.5760e-01	5.7004e-01	5.7592e-03	      	Constant
+85	4.91	4.48	0.0000	0.0000	4.4877	0.8638	3.5268e-01	5.7004e-01	5.7592e-03	      	Constant
+86	4.65	4.33	0.0000	0.0000	6.1933	0.6299	4.2738e-01	5.7004e-01	5.7592e-03	      	Constant
+87	3.89	3.60	0.0000	0.0000	6.6153	0.5923	4.4153e-01	5.7004e-01	5.7592e-03	      	Constant
+88	3.69	3.41	0.0000	0.0000	7.0451	0.5573	4.5536e-01	5.7004e-01	5.7592e-03	      	Constant
+89	10.53	10.35	1.9475	0.1106	8.7236	0.3579	5.4969e-01	5.7004e-01	6.3543e-03	      	
+90	3.89	3.60	0.0000	0.0000	6.6153	0.5923	4.4153e-01	5.7004e-01	5.7592e-03	      	Constant
+91	15.58	14.95	4.2194	0.2246	23.0900	1.2690	2.5996e-01	5.7004e-01	5.7592e-03	      	
+92	4.87	4.29	0.0000	0.0000	3.3525	1.1513	2.8327e-01	5.7004e-01	5.7592e-03	      	Constant
+93	5.14	4.72	0.0000	0.0000	4.7041	0.8236	3.6413e-01	5.7004e-01	5.7592e-03	      	Constant
+94	11.43	11.06	2.7339	0.1549	12.3789	0.7372	3.9057e-01	5.7004e-01	5.7592e-03	      	
+95	3.55	3.26	0.0000	0.0000	6.7799	0.5792	4.4662e-01	5.7004e-01	5.7592e-03	      	Constant
+96	4.03	3.71	0.0000	0.0000	6.2807	0.6217	4.3042e-01	5.7004e-01	5.7592e-03	      	Constant
+97	3.89	3.67	0.0000	0.0000	8.6920	0.4543	5.0032e-01	5.7004e-01	5.8556e-03	      	Constant
+98	3.37	3.10	0.0000	0.0000	7.1260	0.5518	4.5760e-01	5.7004e-01	5.7592e-03	      	Constant
+99	4.75	4.39	0.0000	0.0000	5.3714	0.7234	3.9503e-01	5.7004e-01	5.7592e-03	      	Constant
+100	5.29	4.72	0.0000	0.0000	3.3863	1.1391	2.8584e-01	5.7004e-01	5.7592e-03	      	Constant
+101	8.87	8.53	0.0000	0.0000	5.8548	0.6877	4.0696e-01	5.7004e-01	5.7592e-03	      	Synonymous
+102	4.87	4.29	0.0000	0.0000	3.3525	1.1513	2.8327e-01	5.7004e-01	5.7592e-03	      	Constant
+103	4.21	3.91	0.0000	0.0000	6.4306	0.6046	4.3684e-01	5.7004e-01	5.7592e-03	      	Constant
+104	4.13	3.84	0.0000	0.0000	6.8561	0.5714	4.4969e-01	5.7004e-01	5.7592e-03	      	Constant
+105	4.46	3.83	0.0000	0.0000	3.0791	1.2537	2.6285e-01	5.7004e-01	5.7592e-03	      	Constant
+106	5.35	4.67	0.0000	0.0000	2.8550	1.3499	2.4530e-01	5.7004e-01	5.7592e-03	      	Constant
+107	3.55	3.26	0.0000	0.0000	6.7799	0.5792	4.4662e-01	5.7004e-01	5.7592e-03	      	Constant
+108	10.25	9.88	0.0000	0.0000	5.2800	0.7361	3.9093e-01	5.7004e-01	5.7592e-03	      	Synonymous
+109	4.69	4.33	0.0000	0.0000	5.3682	0.7244	3.9472e-01	5.7004e-01	5.7592e-03	      	Constant
+110	9.17	8.75	2.9802	0.1682	13.7159	0.8449	3.5800e-01	5.7004e-01	5.7592e-03	      	
+111	10.26	9.93	2.5649	0.1456	11.5199	0.6596	4.1671e-01	5.7004e-01	5.7592e-03	      	
+112	4.47	3.99	0.0000	0.0000	4.0128	0.9643	3.2611e-01	5.7004e-01	5.7592e-03	      	Constant
+113	5.10	4.79	0.0000	0.0000	6.4721	0.6020	4.3780e-01	5.7004e-01	5.7592e-03	      	Constant
+114	4.13	3.84	0.0000	0.0000	6.8561	0.5714	4.4969e-01	5.7004e-01	5.7592e-03	      	Constant
+115	3.89	3.60	0.0000	0.0000	6.6153	0.5923	4.4153e-01	5.7004e-01	5.7592e-03	      	Constant
+116	3.55	3.26	0.0000	0.0000	6.7799	0.5792	4.4662e-01	5.7004e-01	5.7592e-03	      	Constant
+117	10.12	9.82	0.0000	0.0000	6.4260	0.6082	4.3547e-01	5.7004e-01	5.7592e-03	      	Synonymous
+118	4.47	3.99	0.0000	0.0000	4.0128	0.9643	3.2611e-01	5.7004e-01	5.7592e-03	      	Constant
+119	4.38	4.06	0.0000	0.0000	6.1287	0.6365	4.2498e-01	5.7004e-01	5.7592e-03	      	Constant
+120	5.59	4.91	0.0000	0.0000	2.8377	1.3577	2.4394e-01	5.7004e-01	5.7592e-03	      	Constant
+121	4.77	4.40	0.0000	0.0000	5.3194	0.7298	3.9296e-01	5.7004e-01	5.7592e-03	      	Constant
+122	4.71	4.35	0.0000	0.0000	5.4273	0.7162	3.9738e-01	5.7004e-01	5.7592e-03	      	Constant
+123	9.03	8.31	4.4949	0.2531	20.8674	1.4340	2.3110e-01	5.7004e-01	5.7592e-03	      	
+124	4.09	3.79	0.0000	0.0000	6.3691	0.6119	4.3408e-01	5.7004e-01	5.7592e-03	      	Constant
+125	4.47	3.99	0.0000	0.0000	4.0128	0.9643	3.2611e-01	5.7004e-01	5.7592e-03	      	Constant
+126	3.30	3.08	0.0000	0.0000	8.8918	0.4465	5.0399e-01	5.7004e-01	5.8556e-03	      	Constant
+127	4.21	3.91	0.0000	0.0000	6.4306	0.6046	4.3684e-01	5.7004e-01	5.7592e-03	      	Constant
+128	5.21	4.79	0.0000	0.0000	4.7019	0.8235	3.6416e-01	5.7004e-01	5.7592e-03	      	Constant
+129	5.03	4.65	0.0000	0.0000	5.1433	0.7547	3.8499e-01	5.7004e-01	5.7592e-03	      	Constant
+130	4.38	4.03	0.0000	0.0000	5.5221	0.7043	4.0135e-01	5.7004e-01	5.7592e-03	      	Constant
+131	5.19	4.82	0.0000	0.0000	5.1994	0.7469	3.8746e-01	5.7004e-01	5.7592e-03	      	Constant
+132	4.38	4.04	0.0000	0.0000	5.5717	0.6989	4.0317e-01	5.7004e-01	5.7592e-03	      	Constant
+133	3.69	3.41	0.0000	0.0000	7.0451	0.5573	4.5536e-01	5.7004e-01	5.7592e-03	      	Constant
+134	6.19	5.43	0.0000	0.0000	2.5450	1.5130	2.1868e-01	5.7004e-01	5.7592e-03	      	Constant
+135	5.29	4.72	0.0000	0.0000	3.3863	1.1391	2.8584e-01	5.7004e-01	5.7592e-03	      	Constant
+136	4.09	3.79	0.0000	0.0000	6.3691	0.6119	4.3408e-01	5.7004e-01	5.7592e-03	      	Constant
+137	6.20	5.57	0.0000	0.0000	3.0298	1.2719	2.5941e-01	5.7004e-01	5.7592e-03	      	Constant
+138	4.66	4.35	0.0000	0.0000	6.1627	0.6328	4.2632e-01	5.7004e-01	5.7592e-03	      	Constant
+139	4.79	4.31	0.0000	0.0000	3.9757	0.9731	3.2391e-01	5.7004e-01	5.7592e-03	      	Constant
+140	4.33	4.04	0.0000	0.0000	6.8642	0.5673	4.5135e-01	5.7004e-01	5.7592e-03	      	Constant
+141	4.79	4.31	0.0000	0.0000	3.9757	0.9731	3.2391e-01	5.7004e-01	5.7592e-03	      	Constant
+142	4.77	4.40	0.0000	0.0000	5.3194	0.7298	3.9296e-01	5.7004e-01	5.7592e-03	      	Constant
+143	4.86	4.50	0.0000	0.0000	5.3898	0.7211	3.9579e-01	5.7004e-01	5.7592e-03	      	Constant
+144	8.98	8.62	0.0000	0.0000	5.3990	0.7199	3.9617e-01	5.7004e-01	5.7592e-03	      	Synonymous
+145	7.93	7.66	0.0000	0.0000	7.4309	0.5509	4.5795e-01	5.7004e-01	5.7592e-03	      	Synonymous
+146	9.03	8.72	0.0000	0.0000	6.4761	0.6038	4.3714e-01	5.7004e-01	5.7592e-03	      	Synonymous
+147	4.38	4.04	0.0000	0.0000	5.5717	0.6989	4.0317e-01	5.7004e-01	5.7592e-03	      	Constant
+148	4.32	4.00	0.0000	0.0000	6.0574	0.6435	4.2244e-01	5.7004e-01	5.7592e-03	      	Constant
+149	4.09	3.79	0.0000	0.0000	6.3691	0.6119	4.3408e-01	5.7004e-01	5.7592e-03	      	Constant
+150	4.38	4.03	0.0000	0.0000	5.5221	0.7043	4.0135e-01	5.7004e-01	5.7592e-03	      	Constant
+151	4.80	4.43	0.0000	0.0000	5.1389	0.7536	3.8532e-01	5.7004e-01	5.7592e-03	      	Constant
+152	3.97	3.67	0.0000	0.0000	6.5415	0.5980	4.3935e-01	5.7004e-01	5.7592e-03	      	Constant
+153	4.09	3.79	0.0000	0.0000	6.3691	0.6119	4.3408e-01	5.7004e-01	5.7592e-03	      	Constant
+154	3.30	3.08	0.0000	0.0000	8.8918	0.4465	5.0399e-01	5.7004e-01	5.8556e-03	      	Constant
+155	6.05	5.52	0.0000	0.0000	3.6426	1.0597	3.0328e-01	5.7004e-01	5.7592e-03	      	Constant
+156	9.87	9.61	0.0000	0.0000	7.3863	0.5321	4.6571e-01	5.7004e-01	5.8247e-03	      	Synonymous
+157	8.43	7.82	3.8925	0.2194	18.0012	1.2176	2.6983e-01	5.7004e-01	5.7592e-03	      	
+158	3.30	3.08	0.0000	0.0000	8.8918	0.4465	5.0399e-01	5.7004e-01	5.8556e-03	      	Constant
+159	9.40	9.08	0.0000	0.0000	6.0093	0.6485	4.2063e-01	5.7004e-01	5.7592e-03	      	Synonymous
+160	9.81	9.51	0.0000	0.0000	6.6776	0.5911	4.4198e-01	5.7004e-01	5.7592e-03	      	Synonymous
+161	5.16	4.87	0.0000	0.0000	6.6611	0.5832	4.4508e-01	5.7004e-01	5.7592e-03	      	Constant
+162	5.10	4.79	0.0000	0.0000	6.4721	0.6020	4.3780e-01	5.7004e-01	5.7592e-03	      	Constant
+163	4.38	4.03	0.0000	0.0000	5.5221	0.7043	4.0135e-01	5.7004e-01	5.7592e-03	      	Constant
+164	3.71	3.41	0.0000	0.0000	6.6099	0.5951	4.4046e-01	5.7004e-01	5.7592e-03	      	Constant
+165	5.29	4.72	0.0000	0.0000	3.3538	1.1508	2.8337e-01	5.7004e-01	5.7592e-03	      	Constant
+166	4.03	3.71	0.0000	0.0000	6.2807	0.6217	4.3042e-01	5.7004e-01	5.7592e-03	      	Constant
+167	3.55	3.26	0.0000	0.0000	6.7799	0.5792	4.4662e-01	5.7004e-01	5.7592e-03	      	Constant
+168	4.65	4.33	0.0000	0.0000	6.1933	0.6299	4.2738e-01	5.7004e-01	5.7592e-03	      	Constant
+169	4.38	4.04	0.0000	0.0000	5.5717	0.6989	4.0317e-01	5.7004e-01	5.7592e-03	      	Constant
+170	5.14	4.72	0.0000	0.0000	4.7041	0.8236	3.6413e-01	5.7004e-01	5.7592e-03	      	Constant
+171	5.21	4.79	0.0000	0.0000	4.7019	0.8235	3.6416e-01	5.7004e-01	5.7592e-03	      	Constant
+172	4.13	3.84	0.0000	0.0000	6.8561	0.5714	4.4969e-01	5.7004e-01	5.7592e-03	      	Constant
+173	10.30	9.73	0.0000	0.0000	3.4488	1.1265	2.8852e-01	5.7004e-01	5.7592e-03	      	Synonymous
+174	3.89	3.67	0.0000	0.0000	8.6920	0.4543	5.0032e-01	5.7004e-01	5.8556e-03	      	Constant
+175	6.33	5.42	0.0000	0.0000	2.0952	1.8358	1.7544e-01	5.7004e-01	5.7592e-03	      	Constant
+176	22.40	21.81	3.9036	0.2111	21.2911	1.1736	2.7865e-01	5.7004e-01	5.7592e-03	      	
+177	5.03	4.65	0.0000	0.0000	5.1433	0.7547	3.8499e-01	5.7004e-01	5.7592e-03	      	Constant
+178	3.71	3.41	0.0000	0.0000	6.6099	0.5951	4.4046e-01	5.7004e-01	5.7592e-03	      	Constant
+179	5.35	4.67	0.0000	0.0000	2.8550	1.3499	2.4530e-01	5.7004e-01	5.7592e-03	      	Constant
+180	3.30	3.08	0.0000	0.0000	8.8918	0.4465	5.0399e-01	5.7004e-01	5.8556e-03	      	Constant
+181	4.69	4.33	0.0000	0.0000	5.3682	0.7244	3.9472e-01	5.7004e-01	5.7592e-03	      	Constant
+182	5.28	4.88	0.0000	0.0000	4.8274	0.8025	3.7036e-01	5.7004e-01	5.7592e-03	      	Constant
+183	4.33	4.04	0.0000	0.0000	6.8642	0.5673	4.5135e-01	5.7004e-01	5.7592e-03	      	Constant
+184	4.38	4.06	0.0000	0.0000	6.1287	0.6365	4.2498e-01	5.7004e-01	5.7592e-03	      	Constant
+185	4.09	3.79	0.0000	0.0000	6.3691	0.6119	4.3408e-01	5.7004e-01	5.7592e-03	      	Constant
+186	8.93	8.66	0.0000	0.0000	7.1154	0.5520	4.5750e-01	5.7004e-01	5.7592e-03	      	Synonymous
+187	4.09	3.79	0.0000	0.0000	6.4519	0.6059	4.3634e-01	5.7004e-01	5.7592e-03	      	Constant
+188	4.46	3.83	0.0000	0.0000	3.0791	1.2537	2.6285e-01	5.7004e-01	5.7592e-03	      	Constant
+189	3.97	3.67	0.0000	0.0000	6.5415	0.5980	4.3935e-01	5.7004e-01	5.7592e-03	      	Constant
+190	6.21	5.68	0.0000	0.0000	3.6517	1.0556	3.0423e-01	5.7004e-01	5.7592e-03	      	Constant
+191	4.46	3.83	0.0000	0.0000	3.0791	1.2537	2.6285e-01	5.7004e-01	5.7592e-03	      	Constant
+192	6.24	5.58	0.0000	0.0000	2.9148	1.3217	2.5029e-01	5.7004e-01	5.7592e-03	      	Constant
+193	4.60	4.25	0.0000	0.0000	5.5385	0.7030	4.0178e-01	5.7004e-01	5.7592e-03	      	Constant
+194	5.04	4.61	0.0000	0.0000	4.4737	0.8644	3.5251e-01	5.7004e-01	5.7592e-03	      	Constant
+195	9.93	9.44	3.2708	0.1853	14.8149	0.9744	3.2359e-01	5.7004e-01	5.7592e-03	      	
+196	3.69	3.41	0.0000	0.0000	7.0451	0.5573	4.5536e-01	5.7004e-01	5.7592e-03	      	Constant
+197	3.37	3.10	0.0000	0.0000	7.1260	0.5518	4.5760e-01	5.7004e-01	5.7592e-03	      	Constant
+198	4.38	4.03	0.0000	0.0000	5.5221	0.7043	4.0135e-01	5.7004e-01	5.7592e-03	      	Constant
+199	4.21	3.91	0.0000	0.0000	6.4306	0.6046	4.3684e-01	5.7004e-01	5.7592e-03	      	Constant
+200	15.91	14.54	4.2963	0.7093	13.5341	2.7420	9.7742e-02	5.7004e-01	5.7592e-03	      	
@@ -0,0 +1,201 @@
+Site	Neutral	Optimal	Omega	Lower	Upper	LrtStat	Pvalue	AdjPvalue	Qvalue	Result	Note
+1	3.91	3.75	0.0000	0.0000	12.6695	0.3167	5.7357e-01	6.3601e-01	0.0000e+00	      	Constant
+2	8.81	8.64	0.0000	0.0000	12.0110	0.3343	5.6314e-01	6.3601e-01	0.0000e+00	      	Synonymous
+3	4.21	3.96	0.0000	0.0000	7.7606	0.5054	4.7714e-01	6.3601e-01	0.0000e+00	      	Constant
+4	3.80	3.59	0.0000	0.0000	9.4667	0.4168	5.1855e-01	6.3601e-01	0.0000e+00	      	Constant
+5	10.53	9.91	3.9565	0.2244	17.8760	1.2489	2.6376e-01	6.3601e-01	0.0000e+00	      	
+6	3.46	3.28	0.0000	0.0000	10.7852	0.3678	5.4420e-01	6.3601e-01	0.0000e+00	      	Constant
+7	4.98	4.73	0.0000	0.0000	8.0081	0.4873	4.8513e-01	6.3601e-01	0.0000e+00	      	Constant
+8	4.56	4.35	0.0000	0.0000	9.2164	0.4259	5.1403e-01	6.3601e-01	0.0000e+00	      	Constant
+9	4.21	3.96	0.0000	0.0000	7.7606	0.5054	4.7714e-01	6.3601e-01	0.0000e+00	      	Constant
+10	3.46	3.28	0.0000	0.0000	10.7852	0.3678	5.4420e-01	6.3601e-01	0.0000e+00	      	Constant
+11	4.48	4.26	0.0000	0.0000	9.2746	0.4248	5.1457e-01	6.3601e-01	0.0000e+00	      	Constant
+12	5.67	5.34	0.0000	0.0000	5.9849	0.6478	4.2091e-01	6.3601e-01	0.0000e+00	      	Constant
+13	3.44	3.32	0.0000	0.0000	18.0308	0.2240	6.3601e-01	6.3601e-01	0.0000e+00	      	Constant
+14	15.70	15.49	0.0000	0.0000	9.8058	0.4142	5.1986e-01	6.3601e-01	0.0000e+00	      	Synonymous
+15	4.66	4.39	0.0000	0.0000	7.1959	0.5412	4.6192e-01	6.3601e-01	0.0000e+00	      	Constant
+16	4.06	3.83	0.0000	0.0000	8.3602	0.4681	4.9386e-01	6.3601e-01	0.0000e+00	      	Constant
+17	4.56	4.35	0.0000	0.0000	9.2164	0.4259	5.1403e-01	6.3601e-01	0.0000e+00	      	Constant
+18	10.91	10.54	2.7657	0.1571	12.4073	0.7537	3.8530e-01	6.3601e-01	0.0000e+00	      	
+19	3.93	3.74	0.0000	0.0000	10.4179	0.3767	5.3939e-01	6.3601e-01	0.0000e+00	      	Constant
+20	3.36	3.09	0.0000	0.0000	7.2870	0.5384	4.6311e-01	6.3601e-01	0.0000e+00	      	Constant
+21	4.44	4.22	0.0000	0.0000	8.8633	0.4417	5.0629e-01	6.3601e-01	0.0000e+00	      	Constant
+22	9.75	9.59	0.0000	0.0000	12.1681	0.3240	5.6923e-01	6.3601e-01	0.0000e+00	      	Synonymous
+23	8.68	7.88	4.9937	0.2815	23.0914	1.6002	2.0587e-01	6.3601e-01	0.0000e+00	      	
+24	4.96	4.74	0.0000	0.0000	8.9380	0.4381	5.0805e-01	6.3601e-01	0.0000e+00	      	Constant
+25	9.59	9.37	0.0000	0.0000	9.1967	0.4274	5.1325e-01	6.3601e-01	0.0000e+00	      	Synonymous
+26	4.03	3.79	0.0000	0.0000	8.2402	0.4753	4.9055e-01	6.3601e-01	0.0000e+00	      	Constant
+27	4.18	4.01	0.0000	0.0000	11.0860	0.3538	5.5199e-01	6.3601e-01	0.0000e+00	      	Constant
+28	3.36	3.09	0.0000	0.0000	7.2870	0.5384	4.6311e-01	6.3601e-01	0.0000e+00	      	Constant
+29	10.46	10.34	0.0000	0.0000	16.8677	0.2385	6.2530e-01	6.3601e-01	0.0000e+00	      	Synonymous
+30	4.21	3.96	0.0000	0.0000	7.7606	0.5054	4.7714e-01	6.3601e-01	0.0000e+00	      	Constant
+31	3.36	3.09	0.0000	0.0000	7.2870	0.5384	4.6311e-01	6.3601e-01	0.0000e+00	      	Constant
+32	4.06	3.83	0.0000	0.0000	8.3602	0.4681	4.9386e-01	6.3601e-01	0.0000e+00	      	Constant
+33	4.98	4.78	0.0000	0.0000	9.5528	0.4083	5.2282e-01	6.3601e-01	0.0000e+00	      	Constant
+34	4.42	4.15	0.0000	0.0000	7.3081	0.5334	4.6517e-01	6.3601e-01	0.0000e+00	      	Constant
+35	3.46	3.28	0.0000	0.0000	10.7852	0.3678	5.4420e-01	6.3601e-01	0.0000e+00	      	Constant
+36	4.56	4.26	0.0000	0.0000	6.5840	0.5906	4.4217e-01	6.3601e-01	0.0000e+00	      	Constant
+37	20.41	18.09	7.8738	1.2683	26.7630	4.6472	3.1105e-02	6.3601e-01	0.0000e+00	+     	
+38	4.23	4.03	0.0000	0.0000	9.7458	0.4013	5.2643e-01	6.3601e-01	0.0000e+00	      	Constant
+39	4.44	4.22	0.0000	0.0000	8.8633	0.4417	5.0629e-01	6.3601e-01	0.0000e+00	      	Constant
+40	3.32	3.14	0.0000	0.0000	10.7591	0.3687	5.4371e-01	6.3601e-01	0.0000e+00	      	Constant
+41	3.59	3.40	0.0000	0.0000	10.1940	0.3881	5.3329e-01	6.3601e-01	0.0000e+00	      	Constant
+42	3.80	3.59	0.0000	0.0000	9.4667	0.4168	5.1855e-01	6.3601e-01	0.0000e+00	      	Constant
+43	3.46	3.28	0.0000	0.0000	10.7852	0.3678	5.4420e-01	6.3601e-01	0.0000e+00	      	Constant
+44	4.56	4.26	0.0000	0.0000	6.5840	0.5906	4.4217e-01	6.3601e-01	0.0000e+00	      	Constant
+45	9.26	9.10	0.0000	0.0000	12.4183	0.3225	5.7009e-01	6.3601e-01	0.0000e+00	      	Synonymous
+46	4.03	3.79	0.0000	0.0000	8.2402	0.4753	4.9055e-01	6.3601e-01	0.0000e+00	      	Constant
+47	4.03	3.79	0.0000	0.0000	8.2402	0.4753	4.9055e-01	6.3601e-01	0.0000e+00	      	Constant
+48	3.59	3.40	0.0000	0.0000	10.1940	0.3881	5.3329e-01	6.3601e-01	0.0000e+00	      	Constant
+49	4.56	4.35	0.0000	0.0000	9.2164	0.4259	5.1403e-01	6.3601e-01	0.0000e+00	      	Constant
+50	4.03	3.79	0.0000	0.0000	7.9543	0.4924	4.8287e-01	6.3601e-01	0.0000e+00	      	Constant
+51	3.82	3.65	0.0000	0.0000	11.4510	0.3469	5.5587e-01	6.3601e-01	0.0000e+00	      	Constant
+52	11.69	11.39	0.0000	0.0000	6.5739	0.5932	4.4120e-01	6.3601e-01	0.0000e+00	      	Synonymous
+53	3.93	3.74	0.0000	0.0000	10.4179	0.3767	5.3939e-01	6.3601e-01	0.0000e+00	      	Constant
+54	4.03	3.79	0.0000	0.0000	8.2402	0.4753	4.9055e-01	6.3601e-01	0.0000e+00	      	Constant
+55	4.03	3.79	0.0000	0.0000	7.9543	0.4924	4.8287e-01	6.3601e-01	0.0000e+00	      	Constant
+56	3.42	3.28	0.0000	0.0000	14.3589	0.2815	5.9572e-01	6.3601e-01	0.0000e+00	      	Constant
+57	3.97	3.73	0.0000	0.0000	8.0653	0.4849	4.8620e-01	6.3601e-01	0.0000e+00	      	Constant
+58	4.36	4.20	0.0000	0.0000	12.2397	0.3220	5.7040e-01	6.3601e-01	0.0000e+00	      	Constant
+59	4.06	3.90	0.0000	0.0000	12.8886	0.3063	5.7996e-01	6.3601e-01	0.0000e+00	      	Constant
+60	3.91	3.75	0.0000	0.0000	12.6695	0.3167	5.7357e-01	6.3601e-01	0.0000e+00	      	Constant
+61	4.44	4.28	0.0000	0.0000	12.3252	0.3206	5.7127e-01	6.3601e-01	0.0000e+00	      	Constant
+62	10.08	9.19	5.5753	0.3126	26.2637	1.7704	1.8333e-01	6.3601e-01	0.0000e+00	      	
+63	8.83	8.10	4.5472	0.2565	20.9983	1.4542	2.2785e-01	6.3601e-01	0.0000e+00	      	
+64	3.94	3.79	0.0000	0.0000	13.0513	0.3072	5.7943e-01	6.3601e-01	0.0000e+00	      	Constant
+65	4.23	4.03	0.0000	0.0000	9.7458	0.4013	5.2643e-01	6.3601e-01	0.0000e+00	      	Constant
+66	4.21	3.96	0.0000	0.0000	7.7606	0.5054	4.7714e-01	6.3601e-01	0.0000e+00	      	Constant
+67	3.46	3.28	0.0000	0.0000	10.7852	0.3678	5.4420e-01	6.3601e-01	0.0000e+00	      	Constant
+68	3.46	3.28	0.0000	0.0000	10.7852	0.3678	5.4420e-01	6.3601e-01	0.0000e+00	      	Constant
+69	4.24	3.95	0.0000	0.0000	6.7055	0.5801	4.4627e-01	6.3601e-01	0.0000e+00	      	Constant
+70	3.59	3.40	0.0000	0.0000	10.1940	0.3881	5.3329e-01	6.3601e-01	0.0000e+00	      	Constant
+71	3.97	3.73	0.0000	0.0000	8.0653	0.4849	4.8620e-01	6.3601e-01	0.0000e+00	      	Constant
+72	4.24	3.95	0.0000	0.0000	6.7055	0.5801	4.4627e-01	6.3601e-01	0.0000e+00	      	Constant
+73	4.00	3.77	0.0000	0.0000	8.3935	0.4663	4.9468e-01	6.3601e-01	0.0000e+00	      	Constant
+74	4.12	3.97	0.0000	0.0000	13.2118	0.3042	5.8127e-01	6.3601e-01	0.0000e+00	      	Constant
+75	4.18	3.99	0.0000	0.0000	10.6136	0.3721	5.4185e-01	6.3601e-01	0.0000e+00	      	Constant
+76	3.42	3.28	0.0000	0.0000	14.3589	0.2815	5.9572e-01	6.3601e-01	0.0000e+00	      	Constant
+77	3.82	3.65	0.0000	0.0000	11.4510	0.3469	5.5587e-01	6.3601e-01	0.0000e+00	      	Constant
+78	4.95	4.71	0.0000	0.0000	8.4560	0.4621	4.9663e-01	6.3601e-01	0.0000e+00	      	Constant
+79	4.24	4.05	0.0000	0.0000	10.1963	0.3867	5.3403e-01	6.3601e-01	0.0000e+00	      	Constant
+80	4.98	4.73	0.0000	0.0000	8.0081	0.4873	4.8513e-01	6.3601e-01	0.0000e+00	      	Constant
+81	3.36	3.09	0.0000	0.0000	7.2870	0.5384	4.6311e-01	6.3601e-01	0.0000e+00	      	Constant
+82	5.70	5.49	0.0000	0.0000	9.2312	0.4217	5.1610e-01	6.3601e-01	0.0000e+00	      	Constant
+83	4.66	4.39	0.0000	0.0000	7.1959	0.5412	4.6192e-01	6.3601e-01	0.0000e+00	      	Constant
+84	3.32	3.14	0.0000	0.0000	10.7591	0.3687	5.4371e-01	6.3601e-01	0.0000e+00	      	Constant
+85	4.93	4.72	0.0000	0.0000	9.2706	0.4203	5.1678e-01	6.3601e-01	0.0000e+00	      	Constant
+86	3.32	3.14	0.0000	0.0000	10.7591	0.3687	5.4371e-01	6.3601e-01	0.0000e+00	      	Constant
+87	3.59	3.40	0.0000	0.0000	10.1940	0.3881	5.3329e-01	6.3601e-01	0.0000e+00	      	Constant
+88	4.54	4.26	0.0000	0.0000	6.7545	0.5757	4.4798e-01	6.3601e-01	0.0000e+00	      	Constant
+89	4.06	3.83	0.0000	0.0000	8.3602	0.4681	4.9386e-01	6.3601e-01	0.0000e+00	      	Constant
+90	3.32	3.14	0.0000	0.0000	10.7591	0.3687	5.4371e-01	6.3601e-01	0.0000e+00	      	Constant
+91	4.36	4.20	0.0000	0.0000	12.2397	0.3220	5.7040e-01	6.3601e-01	0.0000e+00	      	Constant
+92	4.18	4.00	0.0000	0.0000	10.6089	0.3728	5.4150e-01	6.3601e-01	0.0000e+00	      	Constant
+93	3.42	3.28	0.0000	0.0000	14.3589	0.2815	5.9572e-01	6.3601e-01	0.0000e+00	      	Constant
+94	5.77	5.48	0.0000	0.0000	6.6499	0.5820	4.4555e-01	6.3601e-01	0.0000e+00	      	Constant
+95	4.18	3.99	0.0000	0.0000	10.6136	0.3721	5.4185e-01	6.3601e-01	0.0000e+00	      	Constant
+96	4.12	3.97	0.0000	0.0000	13.2118	0.3042	5.8127e-01	6.3601e-01	0.0000e+00	      	Constant
+97	4.12	3.97	0.0000	0.0000	13.2118	0.3042	5.8127e-01	6.3601e-01	0.0000e+00	      	Constant
+98	4.06	3.90	0.0000	0.0000	12.8886	0.3063	5.7996e-01	6.3601e-01	0.0000e+00	      	Constant
+99	4.36	4.20	0.0000	0.0000	12.2397	0.3220	5.7040e-01	6.3601e-01	0.0000e+00	      	Constant
+100	9.41	8.61	5.0027	0.2820	23.1322	1.6031	2.0546e-01	6.3601e-01	0.0000e+00	      	
+101	4.18	4.01	0.0000	0.0000	11.0860	0.3538	5.5199e-01	6.3601e-01	0.0000e+00	      	Constant
+102	3.42	3.28	0.0000	0.0000	14.3589	0.2815	5.9572e-01	6.3601e-01	0.0000e+00	      	Constant
+103	5.01	4.72	0.0000	0.0000	6.6076	0.5881	4.4314e-01	6.3601e-01	0.0000e+00	      	Constant
+104	5.81	5.28	0.0000	0.0000	3.6458	1.0574	3.0381e-01	6.3601e-01	0.0000e+00	      	Constant
+105	3.91	3.75	0.0000	0.0000	12.6695	0.3167	5.7357e-01	6.3601e-01	0.0000e+00	      	Constant
+106	4.56	4.36	0.0000	0.0000	9.7644	0.4036	5.2526e-01	6.3601e-01	0.0000e+00	      	Constant
+107	3.36	3.09	0.0000	0.0000	7.2870	0.5384	4.6311e-01	6.3601e-01	0.0000e+00	      	Constant
+108	3.80	3.59	0.0000	0.0000	9.4667	0.4168	5.1855e-01	6.3601e-01	0.0000e+00	      	Constant
+109	4.96	4.74	0.0000	0.0000	8.9380	0.4381	5.0805e-01	6.3601e-01	0.0000e+00	      	Constant
+110	3.91	3.75	0.0000	0.0000	12.6695	0.3167	5.7357e-01	6.3601e-01	0.0000e+00	      	Constant
+111	3.46	3.28	0.0000	0.0000	10.7852	0.3678	5.4420e-01	6.3601e-01	0.0000e+00	      	Constant
+112	3.59	3.40	0.0000	0.0000	10.1940	0.3881	5.3329e-01	6.3601e-01	0.0000e+00	      	Constant
+113	3.82	3.65	0.0000	0.0000	11.4510	0.3469	5.5587e-01	6.3601e-01	0.0000e+00	      	Constant
+114	3.93	3.74	0.0000	0.0000	10.4179	0.3767	5.3939e-01	6.3601e-01	0.0000e+00	      	Constant
+115	3.42	3.28	0.0000	0.0000	14.3589	0.2815	5.9572e-01	6.3601e-01	0.0000e+00	      	Constant
+116	3.80	3.59	0.0000	0.0000	9.4667	0.4168	5.1855e-01	6.3601e-01	0.0000e+00	      	Constant
+117	9.07	8.84	0.0000	0.0000	8.4504	0.4702	4.9288e-01	6.3601e-01	0.0000e+00	      	Synonymous
+118	3.32	3.14	0.0000	0.0000	10.7591	0.3687	5.4371e-01	6.3601e-01	0.0000e+00	      	Constant
+119	10.40	9.52	5.5553	0.3122	25.8893	1.7681	1.8362e-01	6.3601e-01	0.0000e+00	      	
+120	4.44	4.28	0.0000	0.0000	12.3252	0.3206	5.7127e-01	6.3601e-01	0.0000e+00	      	Constant
+121	4.18	4.01	0.0000	0.0000	11.0860	0.3538	5.5199e-01	6.3601e-01	0.0000e+00	      	Constant
+122	5.08	4.71	0.0000	0.0000	5.2398	0.7386	3.9012e-01	6.3601e-01	0.0000e+00	      	Constant
+123	3.97	3.73	0.0000	0.0000	8.0653	0.4849	4.8620e-01	6.3601e-01	0.0000e+00	      	Constant
+124	5.07	4.72	0.0000	0.0000	5.4580	0.7094	3.9966e-01	6.3601e-01	0.0000e+00	      	Constant
+125	10.79	10.46	2.5648	0.1457	11.4893	0.6603	4.1646e-01	6.3601e-01	0.0000e+00	      	
+126	4.24	4.05	0.0000	0.0000	10.1963	0.3867	5.3403e-01	6.3601e-01	0.0000e+00	      	Constant
+127	3.44	3.32	0.0000	0.0000	18.0308	0.2240	6.3601e-01	6.3601e-01	0.0000e+00	      	Constant
+128	8.00	7.81	0.0000	0.0000	11.1853	0.3768	5.3931e-01	6.3601e-01	0.0000e+00	      	Synonymous
+129	4.23	4.03	0.0000	0.0000	9.7458	0.4013	5.2643e-01	6.3601e-01	0.0000e+00	      	Constant
+130	4.00	3.77	0.0000	0.0000	8.3935	0.4663	4.9468e-01	6.3601e-01	0.0000e+00	      	Constant
+131	4.00	3.77	0.0000	0.0000	8.3935	0.4663	4.9468e-01	6.3601e-01	0.0000e+00	      	Constant
+132	4.06	3.83	0.0000	0.0000	8.3602	0.4681	4.9386e-01	6.3601e-01	0.0000e+00	      	Constant
+133	3.36	3.09	0.0000	0.0000	7.2870	0.5384	4.6311e-01	6.3601e-01	0.0000e+00	      	Constant
+134	3.32	3.14	0.0000	0.0000	10.7591	0.3687	5.4371e-01	6.3601e-01	0.0000e+00	      	Constant
+135	27.73	18.99	25.0567	7.3498	99.0000	17.4915	2.8859e-05	5.7718e-03	0.0000e+00	++++  	
+136	4.23	4.03	0.0000	0.0000	9.7458	0.4013	5.2643e-01	6.3601e-01	0.0000e+00	      	Constant
+137	4.95	4.71	0.0000	0.0000	8.4560	0.4621	4.9663e-01	6.3601e-01	0.0000e+00	      	Constant
+138	3.94	3.79	0.0000	0.0000	13.0513	0.3072	5.7943e-01	6.3601e-01	0.0000e+00	      	Constant
+139	3.42	3.28	0.0000	0.0000	14.3589	0.2815	5.9572e-01	6.3601e-01	0.0000e+00	      	Constant
+140	4.12	3.97	0.0000	0.0000	13.2118	0.3042	5.8127e-01	6.3601e-01	0.0000e+00	      	Constant
+141	4.03	3.79	0.0000	0.0000	7.9543	0.4924	4.8287e-01	6.3601e-01	0.0000e+00	      	Constant
+142	3.80	3.59	0.0000	0.0000	9.4667	0.4168	5.1855e-01	6.3601e-01	0.0000e+00	      	Constant
+143	5.23	4.86	0.0000	0.0000	5.1248	0.7547	3.8498e-01	6.3601e-01	0.0000e+00	      	Constant
+144	4.54	4.26	0.0000	0.0000	6.7545	0.5757	4.4798e-01	6.3601e-01	0.0000e+00	      	Constant
+145	3.59	3.40	0.0000	0.0000	10.1940	0.3881	5.3329e-01	6.3601e-01	0.0000e+00	      	Constant
+146	8.28	7.48	5.0255	0.2831	23.2426	1.6098	2.0452e-01	6.3601e-01	0.0000e+00	      	
+147	3.91	3.75	0.0000	0.0000	12.6695	0.3167	5.7357e-01	6.3601e-01	0.0000e+00	      	Constant
+148	3.44	3.32	0.0000	0.0000	18.0308	0.2240	6.3601e-01	6.3601e-01	0.0000e+00	      	Constant
+149	15.59	13.22	7.9118	1.2969	25.4525	4.7270	2.9692e-02	6.3601e-01	0.0000e+00	+     	
+150	5.01	4.72	0.0000	0.0000	6.6076	0.5881	4.4314e-01	6.3601e-01	0.0000e+00	      	Constant
+151	4.54	4.26	0.0000	0.0000	6.7545	0.5757	4.4798e-01	6.3601e-01	0.0000e+00	      	Constant
+152	11.32	11.13	0.0000	0.0000	9.9483	0.3924	5.3103e-01	6.3601e-01	0.0000e+00	      	Synonymous
+153	3.93	3.74	0.0000	0.0000	10.4179	0.3767	5.3939e-01	6.3601e-01	0.0000e+00	      	Constant
+154	4.18	3.99	0.0000	0.0000	10.6136	0.3721	5.4185e-01	6.3601e-01	0.0000e+00	      	Constant
+155	4.24	4.05	0.0000	0.0000	10.1963	0.3867	5.3403e-01	6.3601e-01	0.0000e+00	      	Constant
+156	3.94	3.79	0.0000	0.0000	13.0513	0.3072	5.7943e-01	6.3601e-01	0.0000e+00	      	Constant
+157	4.06	3.90	0.0000	0.0000	12.8886	0.3063	5.7996e-01	6.3601e-01	0.0000e+00	      	Constant
+158	5.83	5.37	0.0000	0.0000	4.1190	0.9369	3.3307e-01	6.3601e-01	0.0000e+00	      	Constant
+159	3.94	3.79	0.0000	0.0000	13.0513	0.3072	5.7943e-01	6.3601e-01	0.0000e+00	      	Constant
+160	3.44	3.32	0.0000	0.0000	18.0308	0.2240	6.3601e-01	6.3601e-01	0.0000e+00	      	Constant
+161	4.03	3.79	0.0000	0.0000	7.9543	0.4924	4.8287e-01	6.3601e-01	0.0000e+00	      	Constant
+162	4.56	4.26	0.0000	0.0000	6.5840	0.5906	4.4217e-01	6.3601e-01	0.0000e+00	      	Constant
+163	4.24	3.95	0.0000	0.0000	6.7055	0.5801	4.4627e-01	6.3601e-01	0.0000e+00	      	Constant
+164	5.84	5.39	0.0000	0.0000	4.2738	0.9029	3.4200e-01	6.3601e-01	0.0000e+00	      	Constant
+165	4.57	4.36	0.0000	0.0000	9.3388	0.4212	5.1633e-01	6.3601e-01	0.0000e+00	      	Constant
+166	5.91	5.51	0.0000	0.0000	4.8356	0.7989	3.7142e-01	6.3601e-01	0.0000e+00	      	Constant
+167	3.42	3.28	0.0000	0.0000	14.3589	0.2815	5.9572e-01	6.3601e-01	0.0000e+00	      	Constant
+168	4.93	4.72	0.0000	0.0000	9.2706	0.4203	5.1678e-01	6.3601e-01	0.0000e+00	      	Constant
+169	4.24	3.95	0.0000	0.0000	6.7055	0.5801	4.4627e-01	6.3601e-01	0.0000e+00	      	Constant
+170	3.94	3.79	0.0000	0.0000	13.0513	0.3072	5.7943e-01	6.3601e-01	0.0000e+00	      	Constant
+171	3.42	3.28	0.0000	0.0000	14.3589	0.2815	5.9572e-01	6.3601e-01	0.0000e+00	      	Constant
+172	3.32	3.14	0.0000	0.0000	10.7591	0.3687	5.4371e-01	6.3601e-01	0.0000e+00	      	Constant
+173	3.36	3.09	0.0000	0.0000	7.2870	0.5384	4.6311e-01	6.3601e-01	0.0000e+00	      	Constant
+174	10.86	10.49	2.7234	0.1546	12.2455	0.7339	3.9161e-01	6.3601e-01	0.0000e+00	      	
+175	3.36	3.09	0.0000	0.0000	7.2870	0.5384	4.6311e-01	6.3601e-01	0.0000e+00	      	Constant
+176	4.18	3.99	0.0000	0.0000	10.6136	0.3721	5.4185e-01	6.3601e-01	0.0000e+00	      	Constant
+177	4.00	3.77	0.0000	0.0000	8.3935	0.4663	4.9468e-01	6.3601e-01	0.0000e+00	      	Constant
+178	5.07	4.72	0.0000	0.0000	5.4580	0.7094	3.9966e-01	6.3601e-01	0.0000e+00	      	Constant
+179	4.44	4.28	0.0000	0.0000	12.3252	0.3206	5.7127e-01	6.3601e-01	0.0000e+00	      	Constant
+180	4.48	4.26	0.0000	0.0000	9.2746	0.4248	5.1457e-01	6.3601e-01	0.0000e+00	      	Constant
+181	9.77	9.65	0.0000	0.0000	17.7080	0.2289	6.3232e-01	6.3601e-01	0.0000e+00	      	Synonymous
+182	4.44	4.22	0.0000	0.0000	8.8633	0.4417	5.0629e-01	6.3601e-01	0.0000e+00	      	Constant
+183	9.57	8.72	5.3625	0.3016	25.0360	1.7114	1.9081e-01	6.3601e-01	0.0000e+00	      	
+184	11.36	11.09	0.0000	0.0000	7.1903	0.5419	4.6165e-01	6.3601e-01	0.0000e+00	      	Synonymous
+185	3.93	3.74	0.0000	0.0000	10.4179	0.3767	5.3939e-01	6.3601e-01	0.0000e+00	      	Constant
+186	4.56	4.36	0.0000	0.0000	9.7644	0.4036	5.2526e-01	6.3601e-01	0.0000e+00	      	Constant
+187	5.85	5.55	0.0000	0.0000	6.2984	0.6140	4.3329e-01	6.3601e-01	0.0000e+00	      	Constant
+188	3.59	3.40	0.0000	0.0000	10.1940	0.3881	5.3329e-01	6.3601e-01	0.0000e+00	      	Constant
+189	3.36	3.09	0.0000	0.0000	7.2870	0.5384	4.6311e-01	6.3601e-01	0.0000e+00	      	Constant
+190	9.78	8.87	5.7353	0.3236	26.3544	1.8260	1.7660e-01	6.3601e-01	0.0000e+00	      	
+191	9.47	9.36	0.0000	0.0000	19.6654	0.2274	6.3342e-01	6.3601e-01	0.0000e+00	      	Synonymous
+192	4.42	4.15	0.0000	0.0000	7.3081	0.5334	4.6517e-01	6.3601e-01	0.0000e+00	      	Constant
+193	4.18	4.00	0.0000	0.0000	10.6089	0.3728	5.4150e-01	6.3601e-01	0.0000e+00	      	Constant
+194	5.52	5.15	0.0000	0.0000	5.2895	0.7314	3.9242e-01	6.3601e-01	0.0000e+00	      	Constant
+195	4.48	4.26	0.0000	0.0000	9.2746	0.4248	5.1457e-01	6.3601e-01	0.0000e+00	      	Constant
+196	3.97	3.73	0.0000	0.0000	8.0653	0.4849	4.8620e-01	6.3601e-01	0.0000e+00	      	Constant
+197	16.85	13.70	12.4645	2.0106	41.8222	6.2901	1.2142e-02	6.3601e-01	0.0000e+00	+     	
+198	10.88	10.67	0.0000	0.0000	9.6153	0.4214	5.1622e-01	6.3601e-01	0.0000e+00	      	Synonymous
+199	4.00	3.77	0.0000	0.0000	8.3935	0.4663	4.9468e-01	6.3601e-01	0.0000e+00	      	Constant
+200	4.57	4.36	0.0000	0.0000	9.3388	0.4212	5.1633e-01	6.3601e-01	0.0000e+00	      	Constant
@@ -0,0 +1,300 @@
+Site	Neutral	Optimal	Omega	Lower	Upper	LrtStat	Pvalue	AdjPvalue	Qvalue	Result	Note
+1	8.21	7.14	0.1394	0.0141	1.7137	2.1225	1.4515e-01	9.9985e-01	2.5308e-02	      	
+2	14.63	14.52	1.7027	0.0829	9.7613	0.2211	6.3822e-01	9.9985e-01	7.0420e-02	      	
+3	8.30	7.59	0.1754	0.0253	2.4809	1.4212	2.3321e-01	9.9985e-01	2.8148e-02	      	
+4	15.78	15.04	2.8365	0.4478	13.4762	1.4716	2.2509e-01	9.9985e-01	2.7542e-02	      	
+5	8.99	7.82	0.0418	0.0020	1.7828	2.3338	1.2659e-01	9.9985e-01	2.5136e-02	      	
+6	10.53	9.27	0.1220	0.0034	1.4557	2.5100	1.1313e-01	9.9985e-01	2.5136e-02	      	
+7	16.77	16.77	1.1432	0.0788	7.3224	0.0150	9.0239e-01	9.9985e-01	9.5868e-02	     !	
+8	12.63	11.96	0.1503	0.0037	2.7854	1.3383	2.4734e-01	9.9985e-01	2.9023e-02	      	
+9	13.47	12.46	0.1271	0.0140	1.8046	2.0304	1.5418e-01	9.9985e-01	2.5389e-02	      	
+10	10.10	8.42	0.0353	0.0016	1.1593	3.3530	6.7081e-02	9.9985e-01	2.5136e-02	      	
+11	11.36	7.76	0.0000	0.0000	0.0725	7.1952	7.3100e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+12	10.18	9.07	0.1329	0.0142	1.6409	2.2173	1.3647e-01	9.9985e-01	2.5136e-02	      	
+13	9.97	8.14	0.0317	0.0016	1.0726	3.6564	5.5853e-02	9.9985e-01	2.5136e-02	      	
+14	12.75	11.66	0.1168	0.0126	1.7003	2.1739	1.4037e-01	9.9985e-01	2.5136e-02	      	
+15	9.62	8.42	0.1488	0.0169	1.5078	2.4000	1.2133e-01	9.9985e-01	2.5136e-02	      	
+16	10.16	6.31	0.0000	0.0000	0.0509	7.6973	5.5302e-03	9.9985e-01	1.3383e-02	--    	Constant
+17	12.73	10.81	0.0235	0.0012	1.0007	3.8395	5.0059e-02	9.9985e-01	2.5136e-02	      	
+18	15.58	15.44	1.5434	0.2443	6.0778	0.2945	5.8738e-01	9.9985e-01	6.5269e-02	      	
+19	13.13	11.85	0.0387	0.0018	1.6315	2.5634	1.0936e-01	9.9985e-01	2.5136e-02	      	
+20	15.59	14.21	0.0312	0.0016	1.5484	2.7729	9.5872e-02	9.9985e-01	2.5136e-02	      	
+21	10.13	8.34	0.0360	0.0017	1.0947	3.5783	5.8539e-02	9.9985e-01	2.5136e-02	      	
+22	12.89	12.21	0.1419	0.0139	2.7155	1.3559	2.4425e-01	9.9985e-01	2.8767e-02	      	
+23	14.36	14.21	1.6939	0.1421	7.8571	0.2910	5.8958e-01	9.9985e-01	6.5283e-02	      	
+24	12.08	12.03	0.7333	0.0337	3.7306	0.0996	7.5227e-01	9.9985e-01	8.1293e-02	      	
+25	12.27	11.12	0.1064	0.0122	1.6534	2.2957	1.2973e-01	9.9985e-01	2.5136e-02	      	
+26	14.14	12.85	0.0641	0.0032	1.5248	2.5935	1.0731e-01	9.9985e-01	2.5136e-02	      	
+27	9.26	8.46	0.1880	0.0238	2.1510	1.6098	2.0453e-01	9.9985e-01	2.6063e-02	      	
+28	12.26	11.35	0.0671	0.0033	2.3912	1.8052	1.7908e-01	9.9985e-01	2.5886e-02	      	
+29	8.25	7.46	0.0706	0.0036	2.7297	1.5795	2.0884e-01	9.9985e-01	2.6164e-02	      	
+30	9.21	8.61	0.1596	0.0148	2.9389	1.1998	2.7337e-01	9.9985e-01	3.1605e-02	      	
+31	14.59	12.87	0.0428	0.0017	1.1133	3.4409	6.3601e-02	9.9985e-01	2.5136e-02	      	
+32	13.97	13.89	0.6666	0.0474	3.3626	0.1749	6.7576e-01	9.9985e-01	7.3530e-02	      	
+33	9.41	5.95	0.0000	0.0000	0.0527	6.9317	8.4680e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+34	8.94	7.86	0.0722	0.0083	1.8316	2.1618	1.4148e-01	9.9985e-01	2.5136e-02	      	
+35	12.64	12.60	1.3191	0.0889	6.8058	0.0666	7.9631e-01	9.9985e-01	8.5758e-02	      	
+36	9.80	6.01	0.0000	0.0000	0.0524	7.5770	5.9118e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+37	13.25	10.46	0.0206	0.0009	0.6777	5.5798	1.8169e-02	9.9985e-01	1.9784e-02	-     	
+38	14.39	10.23	0.0000	0.0000	0.0507	8.3204	3.9203e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+39	10.88	9.65	0.0567	0.0069	1.6373	2.4521	1.1737e-01	9.9985e-01	2.5136e-02	      	
+40	15.70	15.51	0.5672	0.0399	2.9056	0.3613	5.4781e-01	9.9985e-01	6.1088e-02	      	
+41	9.46	8.62	0.1366	0.0144	2.1585	1.6759	1.9547e-01	9.9985e-01	2.5886e-02	      	
+42	12.73	12.73	0.9767	0.0645	4.9601	0.0005	9.8169e-01	9.9985e-01	1.0394e-01	      	
+43	16.07	15.81	1.8340	0.2743	9.6064	0.5046	4.7750e-01	9.9985e-01	5.3627e-02	      	
+44	11.77	10.42	0.0416	0.0018	1.5120	2.6957	1.0062e-01	9.9985e-01	2.5136e-02	      	
+45	11.71	11.69	0.8539	0.0197	4.3512	0.0246	8.7534e-01	9.9985e-01	9.3310e-02	      	
+46	11.81	10.99	0.1748	0.0174	2.1152	1.6476	1.9929e-01	9.9985e-01	2.5886e-02	      	
+47	11.48	8.13	0.0000	0.0000	0.0748	6.7084	9.5962e-03	9.9985e-01	1.3898e-02	--    	Synonymous
+48	11.38	9.96	0.0657	0.0035	1.3709	2.8407	9.1907e-02	9.9985e-01	2.5136e-02	      	
+49	10.15	8.94	0.1569	0.0166	1.4958	2.4075	1.2076e-01	9.9985e-01	2.5136e-02	      	
+50	12.35	11.39	0.0698	0.0037	2.1906	1.9043	1.6760e-01	9.9985e-01	2.5389e-02	      	
+51	15.90	15.87	0.7938	0.0182	4.9655	0.0500	8.2309e-01	9.9985e-01	8.8339e-02	     !	
+52	9.72	6.12	0.0000	0.0000	0.0725	7.2086	7.2555e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+53	14.96	13.80	0.0373	0.0017	1.8082	2.3161	1.2804e-01	9.9985e-01	2.5136e-02	      	
+54	9.98	8.80	0.1571	0.0166	1.5219	2.3609	1.2441e-01	9.9985e-01	2.5136e-02	      	
+55	9.78	8.65	0.1722	0.0226	1.5716	2.2612	1.3265e-01	9.9985e-01	2.5136e-02	      	
+56	12.03	11.12	0.1678	0.0153	1.9881	1.8273	1.7644e-01	9.9985e-01	2.5886e-02	      	
+57	8.70	7.89	0.1321	0.0143	2.2762	1.6093	2.0459e-01	9.9985e-01	2.6063e-02	      	
+58	9.90	9.03	0.1347	0.0143	2.0936	1.7275	1.8873e-01	9.9985e-01	2.5886e-02	      	
+59	11.79	10.60	0.0417	0.0019	1.7377	2.3893	1.2217e-01	9.9985e-01	2.5136e-02	      	
+60	9.89	8.67	0.1227	0.0138	1.5177	2.4305	1.1900e-01	9.9985e-01	2.5136e-02	      	
+61	9.07	8.02	0.0423	0.0021	2.0502	2.0915	1.4812e-01	9.9985e-01	2.5308e-02	      	
+62	11.99	10.57	0.0396	0.0017	1.4189	2.8424	9.1808e-02	9.9985e-01	2.5136e-02	      	
+63	9.72	8.34	0.1371	0.0157	1.3376	2.7610	9.6586e-02	9.9985e-01	2.5136e-02	      	
+64	8.50	7.66	0.1503	0.0169	2.1465	1.6728	1.9589e-01	9.9985e-01	2.5886e-02	      	
+65	12.26	11.47	0.1437	0.0142	2.2737	1.5838	2.0821e-01	9.9985e-01	2.6164e-02	      	
+66	8.68	7.84	0.1709	0.0189	2.0699	1.6873	1.9395e-01	9.9985e-01	2.5886e-02	      	
+67	8.15	6.65	0.0377	0.0018	1.4290	3.0009	8.3221e-02	9.9985e-01	2.5136e-02	      	
+68	9.39	7.99	0.0325	0.0015	1.4617	2.7995	9.4291e-02	9.9985e-01	2.5136e-02	      	
+69	9.32	7.90	0.0405	0.0018	1.3801	2.8452	9.1644e-02	9.9985e-01	2.5136e-02	      	
+70	12.36	11.10	0.1225	0.0133	1.4780	2.5202	1.1240e-01	9.9985e-01	2.5136e-02	      	
+71	10.01	8.45	0.0363	0.0016	1.2430	3.1306	7.6835e-02	9.9985e-01	2.5136e-02	      	
+72	10.75	9.59	0.1440	0.0164	1.5556	2.3299	1.2691e-01	9.9985e-01	2.5136e-02	      	
+73	11.73	10.58	0.0374	0.0017	1.8128	2.3040	1.2904e-01	9.9985e-01	2.5136e-02	      	
+74	9.30	8.16	0.1658	0.0236	1.5645	2.2803	1.3103e-01	9.9985e-01	2.5136e-02	      	
+75	9.27	8.16	0.1168	0.0123	1.6766	2.2086	1.3725e-01	9.9985e-01	2.5136e-02	      	
+76	8.14	6.76	0.0324	0.0016	1.6328	2.7672	9.6217e-02	9.9985e-01	2.5136e-02	      	
+77	9.79	8.43	0.0420	0.0020	1.5040	2.7092	9.9771e-02	9.9985e-01	2.5136e-02	      	
+78	7.65	3.56	0.0000	0.0000	0.0565	8.1781	4.2400e-03	9.9985e-01	1.3383e-02	--    	Constant
+79	9.58	8.75	0.1864	0.0207	2.0715	1.6684	1.9647e-01	9.9985e-01	2.5886e-02	      	
+80	8.32	7.49	0.1539	0.0186	2.1579	1.6577	1.9792e-01	9.9985e-01	2.5886e-02	      	
+81	8.20	6.95	0.0365	0.0017	1.7851	2.5173	1.1260e-01	9.9985e-01	2.5136e-02	      	
+82	9.31	8.07	0.1260	0.0126	1.4766	2.4866	1.1482e-01	9.9985e-01	2.5136e-02	      	
+83	8.59	7.42	0.0832	0.0099	1.6437	2.3437	1.2579e-01	9.9985e-01	2.5136e-02	      	
+84	9.05	8.21	0.1401	0.0130	2.1456	1.6795	1.9499e-01	9.9985e-01	2.5886e-02	      	
+85	10.19	9.05	0.0823	0.0089	1.6488	2.2963	1.2968e-01	9.9985e-01	2.5136e-02	      	
+86	9.73	7.95	0.0261	0.0012	1.0897	3.5704	5.8820e-02	9.9985e-01	2.5136e-02	      	
+87	12.21	8.38	0.0000	0.0000	0.0514	7.6466	5.6880e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+88	10.75	8.80	0.0212	0.0011	0.9833	3.8819	4.8809e-02	9.9985e-01	2.5136e-02	-     	
+89	12.88	11.62	0.0803	0.0087	1.5374	2.5114	1.1303e-01	9.9985e-01	2.5136e-02	      	
+90	12.15	10.58	0.0303	0.0014	1.2880	3.1417	7.6314e-02	9.9985e-01	2.5136e-02	      	
+91	9.39	8.07	0.0332	0.0016	1.5604	2.6399	1.0421e-01	9.9985e-01	2.5136e-02	      	
+92	12.84	11.93	0.1759	0.0246	1.9770	1.8065	1.7893e-01	9.9985e-01	2.5886e-02	      	
+93	8.81	7.88	0.0537	0.0026	2.2933	1.8637	1.7219e-01	9.9985e-01	2.5663e-02	      	
+94	9.94	8.66	0.1000	0.0097	1.4493	2.5562	1.0986e-01	9.9985e-01	2.5136e-02	      	
+95	8.57	7.05	0.0386	0.0018	1.3185	3.0589	8.0297e-02	9.9985e-01	2.5136e-02	      	
+96	9.03	8.01	0.0777	0.0094	1.9365	2.0512	1.5208e-01	9.9985e-01	2.5389e-02	      	
+97	8.96	8.07	0.1453	0.0142	2.0106	1.7862	1.8138e-01	9.9985e-01	2.5886e-02	      	
+98	12.83	11.43	0.0424	0.0019	1.3927	2.8020	9.4145e-02	9.9985e-01	2.5136e-02	      	
+99	13.75	12.51	0.0920	0.0109	1.5949	2.4778	1.1546e-01	9.9985e-01	2.5136e-02	      	
+100	10.99	9.67	0.1085	0.0125	1.4092	2.6437	1.0396e-01	9.9985e-01	2.5136e-02	      	
+101	8.97	8.36	0.1171	0.0030	3.0397	1.2087	2.7158e-01	9.9985e-01	3.1514e-02	      	
+102	9.80	6.01	0.0000	0.0000	0.0524	7.5770	5.9118e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+103	12.36	10.74	0.0461	0.0022	1.2125	3.2402	7.1852e-02	9.9985e-01	2.5136e-02	      	
+104	8.08	6.94	0.0377	0.0018	1.9252	2.2904	1.3018e-01	9.9985e-01	2.5136e-02	      	
+105	8.38	7.65	0.1515	0.0173	2.4537	1.4603	2.2688e-01	9.9985e-01	2.7653e-02	      	
+106	8.98	7.85	0.0354	0.0018	2.1315	2.2567	1.3304e-01	9.9985e-01	2.5136e-02	      	
+107	11.11	10.28	0.1535	0.0186	2.1997	1.6580	1.9787e-01	9.9985e-01	2.5886e-02	      	
+108	11.76	11.75	0.8248	0.0339	4.2579	0.0368	8.4780e-01	9.9985e-01	9.0682e-02	      	
+109	8.87	7.46	0.0334	0.0016	1.4357	2.8181	9.3205e-02	9.9985e-01	2.5136e-02	      	
+110	9.27	8.17	0.0524	0.0020	1.7340	2.2024	1.3780e-01	9.9985e-01	2.5136e-02	      	
+111	11.26	10.13	0.0683	0.0086	1.8971	2.2466	1.3391e-01	9.9985e-01	2.5136e-02	      	
+112	10.14	8.96	0.1026	0.0118	1.5796	2.3645	1.2412e-01	9.9985e-01	2.5136e-02	      	
+113	10.18	8.60	0.0385	0.0019	1.3092	3.1535	7.5767e-02	9.9985e-01	2.5136e-02	      	
+114	12.05	10.92	0.0487	0.0023	1.8524	2.2558	1.3312e-01	9.9985e-01	2.5136e-02	      	
+115	12.06	10.91	0.1296	0.0137	1.6397	2.3013	1.2927e-01	9.9985e-01	2.5136e-02	      	
+116	9.21	7.79	0.0330	0.0016	1.4254	2.8418	9.1840e-02	9.9985e-01	2.5136e-02	      	
+117	8.61	7.76	0.1465	0.0160	2.1398	1.6848	1.9429e-01	9.9985e-01	2.5886e-02	      	
+118	11.86	9.94	0.0254	0.0013	1.0000	3.8415	4.9998e-02	9.9985e-01	2.5136e-02	-     	
+119	7.63	6.35	0.0362	0.0017	1.7589	2.5601	1.0959e-01	9.9985e-01	2.5136e-02	      	
+120	8.43	4.53	0.0000	0.0000	0.0616	7.7982	5.2300e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+121	12.19	9.30	0.0208	0.0011	0.4469	5.7690	1.6311e-02	9.9985e-01	1.8454e-02	-     	
+122	7.86	3.96	0.0000	0.0000	0.0618	7.7982	5.2300e-03	9.9985e-01	1.3383e-02	--    	Constant
+123	13.74	12.79	0.0945	0.0022	1.9510	1.8947	1.6867e-01	9.9985e-01	2.5389e-02	      	
+124	11.51	10.69	0.1721	0.0190	2.1307	1.6421	2.0003e-01	9.9985e-01	2.5886e-02	      	
+125	12.09	10.81	0.1434	0.0182	1.4413	2.5504	1.1026e-01	9.9985e-01	2.5136e-02	      	
+126	9.05	7.92	0.0864	0.0105	1.7302	2.2574	1.3298e-01	9.9985e-01	2.5136e-02	      	
+127	11.72	10.77	0.1572	0.0177	1.8796	1.8941	1.6874e-01	9.9985e-01	2.5389e-02	      	
+128	13.67	12.34	0.0380	0.0018	1.6423	2.6702	1.0224e-01	9.9985e-01	2.5136e-02	      	
+129	11.22	9.84	0.0822	0.0101	1.3920	2.7668	9.6240e-02	9.9985e-01	2.5136e-02	      	
+130	9.84	8.89	0.1283	0.0140	1.9121	1.9154	1.6636e-01	9.9985e-01	2.5389e-02	      	
+131	9.43	8.17	0.0847	0.0103	1.5256	2.5279	1.1185e-01	9.9985e-01	2.5136e-02	      	
+132	9.12	7.84	0.0386	0.0017	1.5850	2.5627	1.0941e-01	9.9985e-01	2.5136e-02	      	
+133	10.10	8.74	0.0400	0.0018	1.4984	2.7217	9.8993e-02	9.9985e-01	2.5136e-02	      	
+134	9.10	8.05	0.0873	0.0105	1.8509	2.1112	1.4622e-01	9.9985e-01	2.5308e-02	      	
+135	9.92	8.41	0.0395	0.0018	1.3274	3.0159	8.2452e-02	9.9985e-01	2.5136e-02	      	
+136	8.75	7.74	0.0429	0.0018	2.1943	2.0087	1.5640e-01	9.9985e-01	2.5389e-02	      	
+137	9.98	8.34	0.0316	0.0015	1.1978	3.2894	6.9727e-02	9.9985e-01	2.5136e-02	      	
+138	8.56	7.76	0.1354	0.0140	2.2832	1.5977	2.0622e-01	9.9985e-01	2.6063e-02	      	
+139	15.91	14.23	0.0253	0.0013	1.2080	3.3624	6.6700e-02	9.9985e-01	2.5136e-02	      	
+140	9.94	8.52	0.1136	0.0126	1.3075	2.8528	9.1212e-02	9.9985e-01	2.5136e-02	      	
+141	9.24	8.56	0.1409	0.0141	2.6431	1.3597	2.4358e-01	9.9985e-01	2.8767e-02	      	
+142	12.17	12.17	1.0089	0.0546	5.1954	0.0001	9.9317e-01	9.9985e-01	1.0480e-01	      	
+143	13.63	12.05	0.0356	0.0016	1.2375	3.1625	7.5346e-02	9.9985e-01	2.5136e-02	      	
+144	10.11	8.78	0.1151	0.0139	1.3931	2.6569	1.0310e-01	9.9985e-01	2.5136e-02	      	
+145	14.04	12.91	0.1321	0.0142	1.6183	2.2509	1.3354e-01	9.9985e-01	2.5136e-02	      	
+146	13.38	12.05	0.1265	0.0148	1.3848	2.6715	1.0216e-01	9.9985e-01	2.5136e-02	      	
+147	10.39	9.17	0.1261	0.0142	1.5143	2.4234	1.1954e-01	9.9985e-01	2.5136e-02	      	
+148	9.45	8.71	0.1506	0.0174	2.4459	1.4746	2.2463e-01	9.9985e-01	2.7542e-02	      	
+149	9.70	8.44	0.1068	0.0123	1.4821	2.5255	1.1202e-01	9.9985e-01	2.5136e-02	      	
+150	8.96	8.13	0.0490	0.0023	2.8704	1.6632	1.9717e-01	9.9985e-01	2.5886e-02	      	
+151	10.84	8.86	0.0279	0.0014	0.9546	3.9656	4.6440e-02	9.9985e-01	2.5136e-02	-     	
+152	9.13	8.17	0.1285	0.0142	1.9111	1.9174	1.6614e-01	9.9985e-01	2.5389e-02	      	
+153	14.96	14.11	0.1325	0.0135	2.1481	1.6980	1.9255e-01	9.9985e-01	2.5886e-02	      	
+154	12.52	11.49	0.1379	0.0142	1.7695	2.0415	1.5306e-01	9.9985e-01	2.5389e-02	      	
+155	8.53	7.64	0.1134	0.0108	2.1003	1.7607	1.8453e-01	9.9985e-01	2.5886e-02	      	
+156	13.35	12.40	0.1376	0.0140	1.9749	1.9033	1.6771e-01	9.9985e-01	2.5389e-02	      	
+157	11.44	10.57	0.0524	0.0025	2.7194	1.7395	1.8720e-01	9.9985e-01	2.5886e-02	      	
+158	11.92	10.63	0.0381	0.0017	1.5966	2.5827	1.0804e-01	9.9985e-01	2.5136e-02	      	
+159	10.22	9.42	0.1724	0.0183	2.1847	1.5967	2.0637e-01	9.9985e-01	2.6063e-02	      	
+160	10.03	9.12	0.1679	0.0181	1.9360	1.8099	1.7852e-01	9.9985e-01	2.5886e-02	      	
+161	11.57	10.99	0.1873	0.0190	3.3160	1.1572	2.8206e-01	9.9985e-01	3.2490e-02	      	
+162	12.30	11.55	0.1772	0.0186	2.3294	1.4996	2.2073e-01	9.9985e-01	2.7220e-02	      	
+163	11.28	10.46	0.1341	0.0137	2.2223	1.6446	1.9970e-01	9.9985e-01	2.5886e-02	      	
+164	8.79	7.48	0.0375	0.0017	1.5902	2.6276	1.0502e-01	9.9985e-01	2.5136e-02	      	
+165	16.58	16.48	0.6353	0.0211	3.5724	0.2164	6.4183e-01	9.9985e-01	7.0571e-02	      	
+166	8.53	7.57	0.0385	0.0017	2.4476	1.9258	1.6522e-01	9.9985e-01	2.5389e-02	      	
+167	9.54	8.63	0.1333	0.0141	1.9954	1.8157	1.7783e-01	9.9985e-01	2.5886e-02	      	
+168	11.75	8.46	0.0000	0.0000	0.0795	6.5924	1.0241e-02	9.9985e-01	1.4067e-02	-     	Synonymous
+169	9.64	7.64	0.0258	0.0013	0.9351	4.0044	4.5381e-02	9.9985e-01	2.5136e-02	-     	
+170	13.04	9.96	0.0000	0.0000	0.0808	6.1575	1.3086e-02	9.9985e-01	1.5543e-02	-     	Synonymous
+171	9.53	8.53	0.0918	0.0115	1.9690	1.9893	1.5842e-01	9.9985e-01	2.5389e-02	      	
+172	9.54	7.79	0.0458	0.0022	1.1068	3.4961	6.1514e-02	9.9985e-01	2.5136e-02	      	
+173	8.79	5.24	0.0000	0.0000	0.0642	7.0900	7.7516e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+174	10.35	9.40	0.1371	0.0137	1.8890	1.9082	1.6716e-01	9.9985e-01	2.5389e-02	      	
+175	10.06	9.06	0.1233	0.0127	1.8355	1.9829	1.5908e-01	9.9985e-01	2.5389e-02	      	
+176	12.25	11.69	0.1931	0.0203	3.0986	1.1186	2.9023e-01	9.9985e-01	3.3309e-02	      	
+177	12.24	11.01	0.1282	0.0146	1.4907	2.4591	1.1684e-01	9.9985e-01	2.5136e-02	      	
+178	14.83	14.73	1.4254	0.2244	6.1300	0.1999	6.5484e-01	9.9985e-01	7.1562e-02	      	
+179	10.19	8.14	0.0234	0.0012	0.9143	4.0907	4.3120e-02	9.9985e-01	2.5136e-02	-     	
+180	8.99	8.09	0.1768	0.0243	1.9533	1.7984	1.7991e-01	9.9985e-01	2.5886e-02	      	
+181	12.49	11.65	0.1403	0.0131	2.1689	1.6790	1.9506e-01	9.9985e-01	2.5886e-02	      	
+182	8.06	7.35	0.1676	0.0175	2.4880	1.4079	2.3541e-01	9.9985e-01	2.8148e-02	      	
+183	13.48	11.64	0.0261	0.0012	1.0478	3.6927	5.4652e-02	9.9985e-01	2.5136e-02	      	
+184	9.52	8.25	0.0515	0.0023	1.5037	2.5542	1.1000e-01	9.9985e-01	2.5136e-02	      	
+185	11.57	9.69	0.0698	0.0080	1.0181	3.7695	5.2194e-02	9.9985e-01	2.5136e-02	      	
+186	11.70	8.56	0.0000	0.0000	0.0793	6.2820	1.2197e-02	9.9985e-01	1.5138e-02	-     	Synonymous
+187	10.20	9.03	0.0313	0.0014	1.7284	2.3523	1.2510e-01	9.9985e-01	2.5136e-02	      	
+188	8.32	6.86	0.0429	0.0020	1.3728	2.9278	8.7067e-02	9.9985e-01	2.5136e-02	      	
+189	8.20	7.17	0.0394	0.0019	2.0676	2.0627	1.5094e-01	9.9985e-01	2.5383e-02	      	
+190	12.04	10.81	0.0406	0.0019	1.7795	2.4605	1.1674e-01	9.9985e-01	2.5136e-02	      	
+191	11.23	9.03	0.0949	0.0119	0.8829	4.4161	3.5601e-02	9.9985e-01	2.5136e-02	-     	
+192	8.00	7.23	0.0640	0.0024	2.3944	1.5515	2.1292e-01	9.9985e-01	2.6570e-02	      	
+193	14.20	12.84	0.0998	0.0106	1.3706	2.7310	9.8416e-02	9.9985e-01	2.5136e-02	      	
+194	14.63	13.26	0.0834	0.0099	1.4108	2.7439	9.7629e-02	9.9985e-01	2.5136e-02	      	
+195	15.44	14.46	0.1177	0.0122	1.8839	1.9605	1.6146e-01	9.9985e-01	2.5389e-02	      	
+196	10.18	8.77	0.1215	0.0127	1.3210	2.8134	9.3481e-02	9.9985e-01	2.5136e-02	      	
+197	12.90	11.70	0.1117	0.0120	1.5419	2.3973	1.2155e-01	9.9985e-01	2.5136e-02	      	
+198	12.84	11.85	0.1092	0.0106	1.8664	1.9864	1.5871e-01	9.9985e-01	2.5389e-02	      	
+199	11.33	10.29	0.1197	0.0128	1.7641	2.0754	1.4969e-01	9.9985e-01	2.5308e-02	      	
+200	9.66	8.44	0.1236	0.0138	1.5199	2.4247	1.1944e-01	9.9985e-01	2.5136e-02	      	
+201	8.68	5.09	0.0000	0.0000	0.0736	7.1785	7.3782e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+202	8.67	7.98	0.1858	0.0194	2.4894	1.3839	2.3945e-01	9.9985e-01	2.8414e-02	      	
+203	8.54	7.85	0.1845	0.0200	2.4871	1.3856	2.3915e-01	9.9985e-01	2.8414e-02	      	
+204	14.65	13.37	0.0421	0.0020	1.5894	2.5683	1.0902e-01	9.9985e-01	2.5136e-02	      	
+205	10.02	8.34	0.0346	0.0016	1.1554	3.3648	6.6602e-02	9.9985e-01	2.5136e-02	      	
+206	8.92	7.76	0.0416	0.0019	1.7862	2.3275	1.2710e-01	9.9985e-01	2.5136e-02	      	
+207	11.11	6.54	0.0000	0.0000	0.0381	9.1407	2.4998e-03	7.4495e-01	1.3383e-02	--    	Synonymous
+208	11.63	10.79	0.1442	0.0142	2.1908	1.6729	1.9587e-01	9.9985e-01	2.5886e-02	      	
+209	11.33	10.29	0.1197	0.0128	1.7641	2.0754	1.4969e-01	9.9985e-01	2.5308e-02	      	
+210	12.65	11.79	0.1151	0.0109	2.1363	1.7263	1.8889e-01	9.9985e-01	2.5886e-02	      	
+211	8.42	7.47	0.0634	0.0030	2.2708	1.8966	1.6846e-01	9.9985e-01	2.5389e-02	      	
+212	8.43	7.32	0.1171	0.0123	1.6770	2.2078	1.3732e-01	9.9985e-01	2.5136e-02	      	
+213	13.38	11.88	0.0349	0.0016	1.3131	3.0073	8.2892e-02	9.9985e-01	2.5136e-02	      	
+214	15.64	13.80	0.0320	0.0016	1.0562	3.6756	5.5215e-02	9.9985e-01	2.5136e-02	      	
+215	8.69	7.58	0.0416	0.0018	1.8445	2.2198	1.3625e-01	9.9985e-01	2.5136e-02	      	
+216	10.98	6.53	0.0000	0.0000	0.0383	8.8919	2.8644e-03	8.5071e-01	1.3383e-02	--    	Synonymous
+217	8.57	7.24	0.0673	0.0085	1.5049	2.6591	1.0296e-01	9.9985e-01	2.5136e-02	      	
+218	12.94	11.57	0.1036	0.0116	1.3745	2.7412	9.7791e-02	9.9985e-01	2.5136e-02	      	
+219	9.83	8.66	0.1120	0.0124	1.5727	2.3507	1.2523e-01	9.9985e-01	2.5136e-02	      	
+220	12.92	10.69	0.0215	0.0011	0.7499	4.4674	3.4547e-02	9.9985e-01	2.5136e-02	-     	
+221	12.51	10.83	0.1191	0.0148	1.1224	3.3670	6.6517e-02	9.9985e-01	2.5136e-02	      	
+222	8.46	7.10	0.0328	0.0016	1.6624	2.7184	9.9199e-02	9.9985e-01	2.5136e-02	      	
+223	12.31	10.92	0.0353	0.0017	1.5750	2.7798	9.5457e-02	9.9985e-01	2.5136e-02	      	
+224	9.53	6.92	0.0212	0.0011	0.5318	5.2233	2.2287e-02	9.9985e-01	2.3389e-02	-     	
+225	11.60	9.58	0.0257	0.0013	0.9135	4.0573	4.3980e-02	9.9985e-01	2.5136e-02	-     	
+226	9.61	8.56	0.0541	0.0017	1.8664	2.0938	1.4790e-01	9.9985e-01	2.5308e-02	      	
+227	10.04	9.10	0.1588	0.0202	1.8893	1.8736	1.7106e-01	9.9985e-01	2.5616e-02	      	
+228	9.27	7.42	0.0280	0.0013	1.0481	3.7057	5.4227e-02	9.9985e-01	2.5136e-02	      	
+229	10.23	7.82	0.0245	0.0013	0.6257	4.8257	2.8039e-02	9.9985e-01	2.5136e-02	-     	
+230	8.52	7.81	0.1706	0.0206	2.4843	1.4159	2.3407e-01	9.9985e-01	2.8148e-02	      	
+231	8.97	8.36	0.1345	0.0124	3.0392	1.2094	2.7146e-01	9.9985e-01	3.1514e-02	      	
+232	8.54	7.55	0.0439	0.0021	2.1046	1.9854	1.5883e-01	9.9985e-01	2.5389e-02	      	
+233	9.49	8.22	0.1027	0.0119	1.4679	2.5488	1.1038e-01	9.9985e-01	2.5136e-02	      	
+234	10.32	6.38	0.0000	0.0000	0.0627	7.8681	5.0313e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+235	10.53	9.21	0.1230	0.0140	1.4007	2.6345	1.0457e-01	9.9985e-01	2.5136e-02	      	
+236	9.19	8.64	0.1908	0.0187	3.1330	1.0992	2.9443e-01	9.9985e-01	3.3669e-02	      	
+237	13.47	12.16	0.1269	0.0148	1.4043	2.6328	1.0468e-01	9.9985e-01	2.5136e-02	      	
+238	8.12	7.36	0.1320	0.0135	2.4126	1.5257	2.1676e-01	9.9985e-01	2.6837e-02	      	
+239	9.63	5.96	0.0000	0.0000	0.0553	7.3460	6.7213e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+240	11.11	8.98	0.0354	0.0018	0.8879	4.2572	3.9085e-02	9.9985e-01	2.5136e-02	-     	
+241	10.28	9.30	0.1412	0.0172	1.8563	1.9441	1.6322e-01	9.9985e-01	2.5389e-02	      	
+242	15.85	14.79	3.9898	0.5569	19.9869	2.1122	1.4612e-01	9.9985e-01	2.5308e-02	      	
+243	10.45	8.34	0.0240	0.0012	0.8784	4.2119	4.0141e-02	9.9985e-01	2.5136e-02	-     	
+244	12.21	10.59	0.0357	0.0017	1.2116	3.2431	7.1724e-02	9.9985e-01	2.5136e-02	      	
+245	15.41	13.85	0.0257	0.0013	1.3695	3.1099	7.7818e-02	9.9985e-01	2.5136e-02	      	
+246	17.36	17.12	1.8026	0.2745	14.1722	0.4901	4.8387e-01	9.9985e-01	5.4150e-02	      	
+247	10.05	8.99	0.1603	0.0177	1.6789	2.1183	1.4555e-01	9.9985e-01	2.5308e-02	      	
+248	13.87	12.53	0.1115	0.0125	1.3829	2.6895	1.0101e-01	9.9985e-01	2.5136e-02	      	
+249	10.46	7.01	0.0000	0.0000	0.0780	6.8897	8.6696e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+250	16.30	16.20	0.6469	0.0221	3.6137	0.1992	6.5540e-01	9.9985e-01	7.1562e-02	      	
+251	8.61	7.76	0.1465	0.0160	2.1398	1.6848	1.9429e-01	9.9985e-01	2.5886e-02	      	
+252	12.37	10.57	0.0316	0.0016	1.0921	3.6125	5.7346e-02	9.9985e-01	2.5136e-02	      	
+253	10.02	8.52	0.0421	0.0019	1.3031	2.9821	8.4192e-02	9.9985e-01	2.5136e-02	      	
+254	8.56	7.35	0.0330	0.0017	2.1808	2.4244	1.1946e-01	9.9985e-01	2.5136e-02	      	
+255	17.81	17.52	1.9376	0.2866	17.3322	0.5755	4.4809e-01	9.9985e-01	5.0686e-02	      	
+256	8.55	7.68	0.1305	0.0142	2.1123	1.7393	1.8723e-01	9.9985e-01	2.5886e-02	      	
+257	15.24	14.53	2.8026	0.4426	16.6457	1.4331	2.3125e-01	9.9985e-01	2.8078e-02	      	
+258	15.88	15.88	0.9998	0.0755	5.0171	0.0000	9.9985e-01	9.9985e-01	1.0516e-01	      	
+259	12.96	11.58	0.0412	0.0019	1.4496	2.7655	9.6315e-02	9.9985e-01	2.5136e-02	      	
+260	16.18	16.10	1.3582	0.2163	5.4894	0.1566	6.9228e-01	9.9985e-01	7.5069e-02	      	
+261	15.01	14.75	0.5185	0.0461	2.5173	0.5085	4.7580e-01	9.9985e-01	5.3627e-02	      	
+262	8.94	8.12	0.1721	0.0181	2.1315	1.6454	1.9959e-01	9.9985e-01	2.5886e-02	      	
+263	14.84	14.18	0.0767	0.0021	3.7701	1.3071	2.5292e-01	9.9985e-01	2.9566e-02	      	
+264	8.25	5.06	0.0000	0.0000	0.0758	6.3679	1.1621e-02	9.9985e-01	1.5075e-02	-     	Synonymous
+265	10.02	9.18	0.1221	0.0123	2.1755	1.6884	1.9381e-01	9.9985e-01	2.5886e-02	      	
+266	12.71	10.21	0.0310	0.0016	0.7017	5.0073	2.5240e-02	9.9985e-01	2.5136e-02	-     	
+267	9.46	7.89	0.0307	0.0014	1.2526	3.1338	7.6686e-02	9.9985e-01	2.5136e-02	      	
+268	12.82	10.58	0.0341	0.0016	0.8496	4.4668	3.4561e-02	9.9985e-01	2.5136e-02	-     	
+269	8.37	6.61	0.0261	0.0013	1.1660	3.5122	6.0920e-02	9.9985e-01	2.5136e-02	      	
+270	10.50	9.51	0.0588	0.0021	1.9338	1.9632	1.6117e-01	9.9985e-01	2.5389e-02	      	
+271	8.01	7.30	0.1727	0.0210	2.4879	1.4105	2.3497e-01	9.9985e-01	2.8148e-02	      	
+272	12.43	11.89	0.1872	0.0165	3.2442	1.0735	3.0015e-01	9.9985e-01	3.4103e-02	      	
+273	8.87	7.79	0.0954	0.0101	1.7242	2.1626	1.4141e-01	9.9985e-01	2.5136e-02	      	
+274	11.38	10.29	0.0478	0.0023	1.9766	2.1951	1.3845e-01	9.9985e-01	2.5136e-02	      	
+275	11.67	11.14	0.1956	0.0196	3.2707	1.0724	3.0040e-01	9.9985e-01	3.4103e-02	      	
+276	11.37	10.25	0.0419	0.0020	1.8784	2.2545	1.3322e-01	9.9985e-01	2.5136e-02	      	
+277	14.07	12.84	0.0425	0.0020	1.6658	2.4542	1.1721e-01	9.9985e-01	2.5136e-02	      	
+278	8.79	5.24	0.0000	0.0000	0.0642	7.0900	7.7516e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+279	9.29	8.20	0.1237	0.0141	1.6800	2.1817	1.3966e-01	9.9985e-01	2.5136e-02	      	
+280	12.82	11.14	0.0347	0.0016	1.1550	3.3664	6.6538e-02	9.9985e-01	2.5136e-02	      	
+281	9.03	7.49	0.0297	0.0014	1.3064	3.0881	7.8866e-02	9.9985e-01	2.5136e-02	      	
+282	12.81	11.89	0.1484	0.0168	1.9729	1.8312	1.7599e-01	9.9985e-01	2.5886e-02	      	
+283	12.58	11.73	0.1299	0.0140	2.1462	1.7090	1.9111e-01	9.9985e-01	2.5886e-02	      	
+284	9.11	8.15	0.1429	0.0157	1.8571	1.9365	1.6405e-01	9.9985e-01	2.5389e-02	      	
+285	8.97	8.20	0.1325	0.0153	2.4067	1.5347	2.1541e-01	9.9985e-01	2.6774e-02	      	
+286	16.63	15.83	0.1096	0.0125	3.6715	1.5976	2.0625e-01	9.9985e-01	2.6063e-02	      	
+287	9.51	5.12	0.0000	0.0000	0.0583	8.7698	3.0626e-03	9.0654e-01	1.3383e-02	--    	Synonymous
+288	10.34	9.30	0.1058	0.0121	1.7891	2.0831	1.4894e-01	9.9985e-01	2.5308e-02	      	
+289	9.26	8.27	0.0436	0.0021	2.1083	1.9793	1.5946e-01	9.9985e-01	2.5389e-02	      	
+290	8.85	7.27	0.0343	0.0017	1.2794	3.1536	7.5761e-02	9.9985e-01	2.5136e-02	      	
+291	8.48	7.39	0.0428	0.0020	1.9338	2.1806	1.3976e-01	9.9985e-01	2.5136e-02	      	
+292	8.50	3.60	0.0000	0.0000	0.0414	9.8049	1.7405e-03	5.2040e-01	1.3383e-02	--    	Constant
+293	9.26	5.53	0.0000	0.0000	0.0562	7.4486	6.3484e-03	9.9985e-01	1.3383e-02	--    	Synonymous
+294	9.73	8.30	0.0731	0.0086	1.3240	2.8706	9.0210e-02	9.9985e-01	2.5136e-02	      	
+295	8.89	7.76	0.0545	0.0026	1.7732	2.2521	1.3343e-01	9.9985e-01	2.5136e-02	      	
+296	13.56	12.13	0.0737	0.0081	1.3420	2.8533	9.1188e-02	9.9985e-01	2.5136e-02	      	
+297	9.76	7.38	0.0249	0.0013	0.6956	4.7518	2.9267e-02	9.9985e-01	2.5136e-02	-     	
+298	9.85	8.71	0.0321	0.0014	1.7565	2.2968	1.2964e-01	9.9985e-01	2.5136e-02	      	
+299	13.47	12.66	0.1094	0.0127	2.3809	1.6069	2.0493e-01	9.9985e-01	2.6063e-02	      	
@@ -0,0 +1,41 @@
+#!/usr/bin/env bash
+# Run the kernel microbenchmarks on the example alignments.
+#
+#   bench.sh BENCH [BASELINE] [BATCHES]
+#
+# With one binary, print the timings of each kernel for each example. With
+# two, run both and print the mean time per call of each kernel under the
+# baseline and under BENCH, and their ratio (below one is faster).
+set -e
+BENCH=`realpath -e $1`
+BASELINE=${2:+`realpath -e $2`}
+BATCHES=${3:-10}
+FIXTURES="bglobin HIVpol Large1 Large2"
+
+run () {
+    for d in ${FIXTURES}
+    do
+        seqfile=`awk '/^seqfile:/ {print $2}' $d/slr.ctl`
+        treefile=`awk '/^treefile:/ {print $2}' $d/slr.ctl`
+        (cd $d && OPENBLAS_NUM_THREADS=1 $1 ${seqfile} ${treefile} ${BATCHES}) |
+            grep -v '^#' | grep -v '^Kernel' | sed "s/^/$d\t/"
+    done
+}
+
+if [ -z "${BASELINE}" ]
+then
+    echo -e "Example\tKernel\tCalls\tMean\tSD\tMin\tGFLOPs"
+    run ${BENCH}
+else
+    old=`mktemp`
+    new=`mktemp`
+    run ${BASELINE} > ${old}
+    run ${BENCH} > ${new}
+    echo -e "Example\tKernel\tBaseline\tNew\tRatio"
+    awk -F '\t' 'NR == FNR {base[$1 "\t" $2] = $4; next}
+        ($1 "\t" $2) in base {
+            printf "%s\t%s\t%.1f\t%.1f\t%.3f\n", $1, $2, base[$1 "\t" $2], $4,
+                   $4 / base[$1 "\t" $2]
+        }' ${old} ${new}
+    rm -f ${old} ${new}
+fi
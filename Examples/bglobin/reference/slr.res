@@ -0,0 +1,145 @@
+Site	Neutral	Optimal	Omega	Lower	Upper	LrtStat	Pvalue	AdjPvalue	Qvalue	Result	Note
+1	24.95	21.51	0.1342	0.0075	0.6554	6.8868	8.6836e-03	4.6023e-01	1.5497e-03	--    	
+2	43.77	35.06	0.1199	0.0197	0.3830	17.4143	3.0056e-05	3.3362e-03	1.2690e-03	----  	
+3	42.35	42.07	0.7089	0.2602	1.7361	0.5562	4.5579e-01	9.8822e-01	3.9166e-02	      	
+4	29.95	24.23	0.1584	0.0259	0.5132	11.4391	7.1914e-04	5.9689e-02	1.2690e-03	--    	
+5	20.18	6.99	0.0000	0.0000	0.1303	26.3847	2.7975e-07	3.5529e-05	1.2690e-03	----  	Synonymous
+6	13.70	6.03	0.0000	0.0000	0.2200	15.3471	8.9457e-05	9.0352e-03	1.2690e-03	----  	Synonymous
+7	52.49	51.26	1.8941	0.8541	4.8590	2.4606	1.1673e-01	9.8822e-01	1.1616e-02	      	
+8	37.09	37.02	0.8524	0.3541	1.8267	0.1543	6.9447e-01	9.8822e-01	5.7834e-02	      	
+9	36.70	23.25	0.0505	0.0029	0.2260	26.9147	2.1264e-07	2.7643e-05	1.2690e-03	----  	
+10	42.41	41.40	0.5682	0.2318	1.2319	2.0153	1.5572e-01	9.8822e-01	1.4746e-02	      	
+11	39.71	39.42	1.4030	0.5782	3.4053	0.5711	4.4981e-01	9.8822e-01	3.9124e-02	      	
+12	30.60	29.80	0.4664	0.1071	1.4776	1.6100	2.0450e-01	9.8822e-01	1.8614e-02	      	
+13	10.75	4.04	0.0000	0.0000	0.2727	13.4163	2.4945e-04	2.3448e-02	1.2690e-03	---   	Constant
+14	33.08	32.90	0.7300	0.2200	1.8774	0.3603	5.4835e-01	9.8822e-01	4.6323e-02	      	
+15	19.21	11.43	0.0000	0.0000	0.2155	15.5591	7.9965e-05	8.2364e-03	1.2690e-03	----  	Synonymous
+16	22.92	13.64	0.0000	0.0000	0.1761	18.5622	1.6445e-05	1.8747e-03	1.2690e-03	----  	Synonymous
+17	37.81	35.99	0.4370	0.1645	1.0230	3.6361	5.6540e-02	9.8822e-01	6.0369e-03	      	
+18	34.06	32.00	0.3330	0.0799	0.9665	4.1107	4.2613e-02	9.8822e-01	4.6418e-03	-     	
+19	32.31	28.17	0.2715	0.0820	0.6787	8.2881	3.9906e-03	2.5939e-01	1.3324e-03	--    	
+20	35.90	35.35	0.6555	0.2650	1.4171	1.0962	2.9511e-01	9.8822e-01	2.6452e-02	      	
+21	26.59	24.53	0.4267	0.1504	0.9730	4.1238	4.2284e-02	9.8822e-01	4.6418e-03	-     	
+22	26.63	15.31	0.0000	0.0000	0.1513	22.6392	1.9546e-06	2.4432e-04	1.2690e-03	----  	Synonymous
+23	33.26	31.78	0.4733	0.1629	1.1026	2.9431	8.6245e-02	9.8822e-01	8.8833e-03	      	
+24	25.82	15.96	0.0659	0.0037	0.2975	19.7256	8.9394e-06	1.0549e-03	1.2690e-03	----  	
+25	22.45	17.46	0.1076	0.0061	0.5032	9.9684	1.5925e-03	1.2103e-01	1.2690e-03	--    	
+26	19.38	13.76	0.0000	0.0000	0.2765	11.2295	8.0507e-04	6.5211e-02	1.2690e-03	--    	Synonymous
+27	19.39	18.09	0.4141	0.0987	1.1818	2.6030	1.0666e-01	9.8822e-01	1.0797e-02	      	
+28	19.15	4.70	0.0000	0.0000	0.1202	28.9041	7.6054e-08	1.0343e-05	1.2690e-03	----  	Constant
+29	15.42	13.17	0.1747	0.0095	0.8933	4.5128	3.3641e-02	9.8822e-01	3.7538e-03	-     	
+30	11.15	6.89	0.0000	0.0000	0.4048	8.5310	3.4915e-03	2.3393e-01	1.3255e-03	--    	Synonymous
+31	30.69	23.65	0.1340	0.0220	0.4333	14.0801	1.7518e-04	1.6993e-02	1.2690e-03	---   	
+32	26.24	11.89	0.0000	0.0000	0.1193	28.6935	8.4788e-08	1.1446e-05	1.2690e-03	----  	Synonymous
+33	24.87	7.79	0.0000	0.0000	0.1024	34.1642	5.0652e-09	7.1926e-07	1.2690e-03	----  	Synonymous
+34	34.53	18.04	0.0000	0.0000	0.1012	32.9731	9.3444e-09	1.3176e-06	1.2690e-03	----  	Synonymous
+35	10.75	4.04	0.0000	0.0000	0.2727	13.4163	2.4945e-04	2.3448e-02	1.2690e-03	---   	Constant
+36	26.04	11.96	0.0000	0.0000	0.1231	28.1599	1.1170e-07	1.4744e-05	1.2690e-03	----  	Synonymous
+37	22.19	16.24	0.1624	0.0267	0.5155	11.8980	5.6195e-04	4.8714e-02	1.2690e-03	---   	
+38	28.87	12.92	0.0000	0.0000	0.1025	31.9063	1.6179e-08	2.2489e-06	1.2690e-03	----  	Synonymous
+39	23.82	18.26	0.1653	0.0271	0.5315	11.1190	8.5446e-04	6.8357e-02	1.2690e-03	--    	
+40	23.03	13.83	0.0000	0.0000	0.1855	18.3997	1.7909e-05	2.0237e-03	1.2690e-03	----  	Synonymous
+41	43.86	42.87	0.5771	0.2343	1.2240	1.9840	1.5897e-01	9.8822e-01	1.4815e-02	      	
+42	41.88	41.80	0.8598	0.3773	1.7542	0.1620	6.8730e-01	9.8822e-01	5.7645e-02	      	
+43	18.04	9.11	0.0000	0.0000	0.1940	17.8443	2.3974e-05	2.6851e-03	1.2690e-03	----  	Synonymous
+44	36.43	20.50	0.0000	0.0000	0.1046	31.8478	1.6674e-08	2.2843e-06	1.2690e-03	----  	Synonymous
+45	27.22	15.97	0.0613	0.0035	0.2719	22.5021	2.0992e-06	2.6030e-04	1.2690e-03	----  	
+46	25.40	18.88	0.0000	0.0000	0.2504	13.0377	3.0528e-04	2.7781e-02	1.2690e-03	---   	Synonymous
+47	22.33	8.77	0.0000	0.0000	0.1291	27.1303	1.9020e-07	2.4916e-05	1.2690e-03	----  	Synonymous
+48	49.64	49.61	0.9091	0.4202	1.9568	0.0627	8.0230e-01	9.8822e-01	6.6283e-02	      	
+49	46.72	45.57	0.5284	0.1990	1.1985	2.2833	1.3077e-01	9.8822e-01	1.2586e-02	      	
+50	54.16	53.17	1.7129	0.8058	4.0491	1.9857	1.5879e-01	9.8822e-01	1.4815e-02	      	
+51	18.26	9.83	0.0000	0.0000	0.2008	16.8618	4.0202e-05	4.4223e-03	1.2690e-03	----  	Synonymous
+52	36.10	30.78	0.2162	0.0525	0.5813	10.6403	1.1065e-03	8.5199e-02	1.2690e-03	--    	
+53	34.79	25.14	0.1883	0.0579	0.4403	19.2923	1.1216e-05	1.3123e-03	1.2690e-03	----  	
+54	48.45	48.42	1.0990	0.5085	2.4097	0.0595	8.0721e-01	9.8822e-01	6.6283e-02	      	
+55	33.07	18.79	0.0000	0.0000	0.1163	28.5620	9.0744e-08	1.2160e-05	1.2690e-03	----  	Synonymous
+56	36.18	32.11	0.2835	0.0856	0.7004	8.1423	4.3244e-03	2.7243e-01	1.3339e-03	--    	
+57	21.40	17.83	0.2130	0.0347	0.7017	7.1323	7.5706e-03	4.2395e-01	1.5015e-03	--    	
+58	26.11	16.65	0.0000	0.0000	0.1747	18.9255	1.3593e-05	1.5767e-03	1.2690e-03	----  	Synonymous
+59	31.70	28.83	0.2525	0.0601	0.7913	5.7343	1.6636e-02	7.8191e-01	2.1888e-03	-     	
+60	19.61	11.34	0.0000	0.0000	0.2061	16.5316	4.7846e-05	5.0717e-03	1.2690e-03	----  	Synonymous
+61	25.67	14.46	0.0000	0.0000	0.1544	22.4242	2.1860e-06	2.6888e-04	1.2690e-03	----  	Synonymous
+62	18.66	10.39	0.0000	0.0000	0.2075	16.5461	4.7481e-05	5.0717e-03	1.2690e-03	----  	Synonymous
+63	24.85	23.70	0.4408	0.1068	1.2399	2.2933	1.2994e-01	9.8822e-01	1.2586e-02	      	
+64	19.17	11.24	0.0000	0.0000	0.2100	15.8755	6.7648e-05	7.1030e-03	1.2690e-03	----  	Synonymous
+65	15.84	8.21	0.0000	0.0000	0.2211	15.2554	9.3908e-05	9.2969e-03	1.2690e-03	----  	Synonymous
+66	40.33	33.77	0.0790	0.0044	0.3840	13.1194	2.9226e-04	2.6888e-02	1.2690e-03	---   	
+67	59.23	58.99	1.3271	0.6057	3.4469	0.4787	4.8902e-01	9.8822e-01	4.1610e-02	      	
+68	25.02	21.57	0.2677	0.0650	0.7405	6.9035	8.6027e-03	4.6023e-01	1.5497e-03	--    	
+69	28.88	22.94	0.0961	0.0054	0.4438	11.8831	5.6644e-04	4.8714e-02	1.2690e-03	---   	
+70	36.39	32.93	0.3107	0.0935	0.7663	6.9023	8.6085e-03	4.6023e-01	1.5497e-03	--    	
+71	41.52	38.96	0.4069	0.1561	0.8927	5.1155	2.3713e-02	9.8822e-01	2.8467e-03	-     	
+72	26.49	21.67	0.1054	0.0059	0.5033	9.6456	1.8981e-03	1.4043e-01	1.2690e-03	--    	
+73	29.59	28.58	0.4721	0.1383	1.3386	2.0177	1.5547e-01	9.8822e-01	1.4746e-02	      	
+74	38.48	38.48	0.9937	0.3960	2.2138	0.0002	9.8822e-01	9.8822e-01	8.0582e-02	      	
+75	32.33	28.71	0.2615	0.0631	0.7246	7.2427	7.1190e-03	4.0578e-01	1.4783e-03	--    	
+76	27.23	24.55	0.1511	0.0080	0.7903	5.3521	2.0697e-02	9.3136e-01	2.5560e-03	-     	
+77	27.55	10.35	0.0000	0.0000	0.0971	34.3893	4.5121e-09	6.4522e-07	1.2690e-03	----  	Synonymous
+78	26.37	20.86	0.2098	0.0514	0.5680	11.0312	8.9592e-04	7.0778e-02	1.2690e-03	--    	
+79	23.54	18.94	0.1847	0.0302	0.6003	9.1940	2.4281e-03	1.6754e-01	1.2690e-03	--    	
+80	14.93	7.29	0.0000	0.0000	0.2225	15.2881	9.2295e-05	9.2295e-03	1.2690e-03	----  	Synonymous
+81	24.66	23.73	0.4914	0.1361	1.3090	1.8673	1.7178e-01	9.8822e-01	1.5883e-02	      	
+82	27.67	23.67	0.2915	0.0884	0.7118	8.0006	4.6761e-03	2.8992e-01	1.3428e-03	--    	
+83	27.92	23.25	0.1784	0.0290	0.5873	9.3317	2.2523e-03	1.5766e-01	1.2690e-03	--    	
+84	35.19	34.82	0.6757	0.2349	1.5977	0.7388	3.9004e-01	9.8822e-01	3.4697e-02	      	
+85	59.93	58.73	1.8826	0.8425	4.6449	2.3862	1.2241e-01	9.8822e-01	1.2079e-02	      	
+86	24.85	18.57	0.0000	0.0000	0.2554	12.5660	3.9283e-04	3.4962e-02	1.2690e-03	---   	Synonymous
+87	30.51	21.21	0.1119	0.0183	0.3594	18.5893	1.6213e-05	1.8645e-03	1.2690e-03	----  	Synonymous
+88	26.51	18.17	0.0756	0.0043	0.3434	16.6720	4.4433e-05	4.7988e-03	1.2690e-03	----  	
+89	22.94	19.82	0.2121	0.0340	0.7390	6.2402	1.2488e-02	6.1191e-01	1.8265e-03	-     	
+90	27.25	16.28	0.0000	0.0000	0.1559	21.9534	2.7936e-06	3.4082e-04	1.2690e-03	----  	Synonymous
+91	26.79	18.40	0.1284	0.0211	0.4079	16.7948	4.1647e-05	4.5395e-03	1.2690e-03	----  	
+92	30.50	23.40	0.1769	0.0432	0.4790	14.2099	1.6351e-04	1.6024e-02	1.2690e-03	---   	
+93	24.99	23.82	0.4718	0.1403	1.2138	2.3422	1.2591e-01	9.8822e-01	1.2321e-02	      	
+94	16.38	11.62	0.0000	0.0000	0.3539	9.5129	2.0403e-03	1.4486e-01	1.2690e-03	--    	Synonymous
+95	32.17	27.36	0.1832	0.0305	0.5836	9.6210	1.9236e-03	1.4043e-01	1.2690e-03	--    	
+96	11.87	5.37	0.0000	0.0000	0.2663	13.0098	3.0986e-04	2.7888e-02	1.2690e-03	---   	Constant
+97	27.81	11.65	0.0000	0.0000	0.1021	32.3125	1.3127e-08	1.8377e-06	1.2690e-03	----  	Synonymous
+98	27.58	14.53	0.0000	0.0000	0.1312	26.1033	3.2363e-07	4.0777e-05	1.2690e-03	----  	Synonymous
+99	20.18	6.99	0.0000	0.0000	0.1303	26.3847	2.7975e-07	3.5529e-05	1.2690e-03	----  	Synonymous
+100	22.61	8.39	0.0000	0.0000	0.1204	28.4382	9.6737e-08	1.2866e-05	1.2690e-03	----  	Synonymous
+101	18.19	7.80	0.0000	0.0000	0.1654	20.7675	5.1855e-06	6.2226e-04	1.2690e-03	----  	Synonymous
+102	22.77	20.43	0.4070	0.1420	0.9256	4.6848	3.0430e-02	9.8822e-01	3.4432e-03	-     	
+103	30.84	22.93	0.1223	0.0199	0.3979	15.8163	6.9800e-05	7.2592e-03	1.2690e-03	----  	
+104	23.08	20.70	0.1631	0.0089	0.8573	4.7551	2.9212e-02	9.8822e-01	3.3775e-03	-     	
+105	25.35	19.21	0.0881	0.0049	0.4158	12.2824	4.5724e-04	4.0237e-02	1.2690e-03	---   	
+106	33.49	27.79	0.1631	0.0266	0.5250	11.4042	7.3277e-04	6.0087e-02	1.2690e-03	--    	
+107	31.98	28.64	0.3255	0.1133	0.7639	6.6773	9.7649e-03	4.8824e-01	1.5952e-03	--    	
+108	37.66	34.95	0.2810	0.0664	0.8295	5.4217	1.9888e-02	9.1483e-01	2.4972e-03	-     	
+109	31.42	28.43	0.2259	0.0357	0.7768	5.9673	1.4573e-02	6.9952e-01	2.0064e-03	-     	
+110	49.91	44.05	0.2801	0.1092	0.5948	11.7129	6.2069e-04	5.2759e-02	1.2690e-03	--    	
+111	31.30	27.08	0.1749	0.0283	0.5952	8.4486	3.6532e-03	2.4111e-01	1.3255e-03	--    	
+112	16.11	11.34	0.0000	0.0000	0.3411	9.5408	2.0095e-03	1.4469e-01	1.2690e-03	--    	Synonymous
+113	35.25	34.91	0.6679	0.2224	1.6796	0.6929	4.0517e-01	9.8822e-01	3.5771e-02	      	
+114	32.60	30.24	0.3634	0.1091	0.9142	4.7281	2.9674e-02	9.8822e-01	3.3947e-03	-     	
+115	36.41	34.67	0.4504	0.1562	1.0361	3.4922	6.1657e-02	9.8822e-01	6.5231e-03	      	
+116	33.49	32.79	0.5679	0.1900	1.4207	1.4037	2.3610e-01	9.8822e-01	2.1326e-02	      	
+117	23.05	19.43	0.2139	0.0349	0.6975	7.2453	7.1089e-03	4.0578e-01	1.4783e-03	--    	
+118	33.00	32.73	0.7030	0.2376	1.7092	0.5533	4.5697e-01	9.8822e-01	3.9166e-02	      	
+119	34.11	32.83	0.4915	0.1719	1.1583	2.5749	1.0857e-01	9.8822e-01	1.0896e-02	      	
+120	18.03	7.61	0.0000	0.0000	0.1647	20.8442	4.9819e-06	6.0281e-04	1.2690e-03	----  	Synonymous
+121	28.88	18.88	0.0658	0.0037	0.2970	20.0001	7.7438e-06	9.2151e-04	1.2690e-03	----  	
+122	41.04	25.10	0.0000	0.0000	0.1018	31.8726	1.6462e-08	2.2718e-06	1.2690e-03	----  	Synonymous
+123	57.46	56.04	1.9155	0.8982	4.1963	2.8419	9.1837e-02	9.8822e-01	9.3770e-03	      	
+124	43.96	43.63	0.7020	0.2722	1.6153	0.6645	4.1496e-01	9.8822e-01	3.6362e-02	      	
+125	20.32	6.98	0.0000	0.0000	0.1312	26.6645	2.4203e-07	3.1222e-05	1.2690e-03	----  	Synonymous
+126	25.61	23.62	0.3398	0.0811	0.9831	3.9775	4.6111e-02	9.8822e-01	4.9730e-03	-     	
+127	24.66	21.29	0.2176	0.0353	0.7221	6.7511	9.3691e-03	4.8073e-01	1.5820e-03	--    	
+128	27.41	24.04	0.2936	0.0725	0.7735	6.7403	9.4260e-03	4.8073e-01	1.5820e-03	--    	
+129	20.57	13.80	0.1479	0.0243	0.4705	13.5367	2.3394e-04	2.2458e-02	1.2690e-03	---   	
+130	16.92	9.22	0.0000	0.0000	0.2181	15.4067	8.6682e-05	8.8416e-03	1.2690e-03	----  	Synonymous
+131	19.11	17.44	0.3069	0.0483	1.0774	3.3371	6.7735e-02	9.8822e-01	7.1017e-03	      	
+132	25.63	21.66	0.1823	0.0293	0.6266	7.9514	4.8050e-03	2.9311e-01	1.3428e-03	--    	
+133	25.90	21.97	0.1953	0.0316	0.6526	7.8626	5.0469e-03	3.0281e-01	1.3475e-03	--    	
+134	30.86	28.34	0.3248	0.0804	0.8819	5.0317	2.4888e-02	9.8822e-01	2.9432e-03	-     	
+135	24.19	20.07	0.1218	0.0068	0.5811	8.2314	4.1171e-03	2.6349e-01	1.3324e-03	--    	
+136	24.64	19.31	0.1033	0.0058	0.4796	10.6767	1.0850e-03	8.4627e-02	1.2690e-03	--    	
+137	37.62	36.75	0.5976	0.2459	1.2681	1.7317	1.8819e-01	9.8822e-01	1.7264e-02	      	
+138	20.10	15.57	0.1154	0.0065	0.5443	9.0626	2.6089e-03	1.7741e-01	1.2690e-03	--    	
+139	22.84	16.23	0.0000	0.0000	0.2424	13.2239	2.7640e-04	2.5705e-02	1.2690e-03	---   	Synonymous
+140	28.56	23.74	0.1761	0.0288	0.5735	9.6494	1.8942e-03	1.4043e-01	1.2690e-03	--    	
+141	22.14	16.34	0.1708	0.0286	0.5314	11.5922	6.6229e-04	5.5632e-02	1.2690e-03	--    	
+142	27.40	25.76	0.3941	0.0972	1.0704	3.2769	7.0263e-02	9.8822e-01	7.3015e-03	      	
+143	33.84	15.62	0.0000	0.0000	0.0951	36.4376	1.5763e-09	2.2699e-07	1.2690e-03	----  	Synonymous
+144	24.14	20.43	0.2608	0.0632	0.7170	7.4335	6.4019e-03	3.7771e-01	1.4486e-03	--    	
@@ -1,13 +1,178 @@
 #!/usr/bin/env bash
+# Run every example in full and check the results against references.
+#
+#   run_all.sh [-u] [-p] [-t tol] [-s slowdown] [-j parallel] [prefix]
+#
+# Each example (directory without a SKIP_RUN file) is run with its slr.ctl,
+# a fixed seed and output under prefix (default "run"). The log, results
+# and profile written by timemem are compared with those in the example's
+# "reference" directory:
+#   lnL, kappa and omega and every numeric field of the .res file must
+#   agree to within tol (relative, or absolute for values below one);
+#   a field of the .res file may also differ by one in its last printed
+#   digit, since rounding can make a tiny difference that large;
+#   the text fields of the .res file must be identical;
+#   the total wall time must not exceed that of the reference profile by
+#   more than the fraction slowdown.
+# Timings depend on the machine, so the reference profile is not part of
+# the distribution: create one with -p before starting work on speed.
+#
+#   -u  Replace the references with the results of this run.
+#   -p  Replace only the reference profile with that of this run.
+#   -t  Tolerance for numerical differences [1e-3].
+#   -s  Fraction by which a run may be slower than the reference [0.2].
+#   -j  Number of examples to run at once [1].
+#
+# Examples without reference results are reported as NOREF and skipped.
+# Exits with non-zero status if any example fails, drifts or is slow.
 SLR=`realpath -e ../bin/Slr`
-prefix=$1
+UPDATE=0
+PROFILE=0
+TOL=1e-3
+SLOWDOWN=0.2
 NPARALLEL=1
+while getopts "upt:s:j:" opt
+do
+    case ${opt} in
+        u) UPDATE=1 ;;
+        p) PROFILE=1 ;;
+        t) TOL=${OPTARG} ;;
+        s) SLOWDOWN=${OPTARG} ;;
+        j) NPARALLEL=${OPTARG} ;;
+        *) exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+prefix=${1:-run}
 
-ls -d -p * | grep '/$' | xargs -n 1 -I %% -P ${NPARALLEL} sh -c "
-        echo '* Running %%'
-	cd %%
-	if [ ! -e 'SKIP_RUN' ]
-	then 
-	    OPENBLAS_NUM_THREADS=1 time -p stdbuf -o 0 ${SLR} -seed 123 -skipsitewise 1 > ${prefix}.log
-	fi
-"
+# Fitted lnL, kappa and omega from a log
+fit () {
+    awk '/^# lnL = / {lnl = $4}
+         /lnL = / && /Not reoptimising/ {lnl = $NF}
+         /^# Kappa = / {kappa = $4; omega = $7}
+         END {print lnl, kappa, omega}' $1
+}
+
+# Value of a field from a timemem profile
+profile_value () {
+    sed -n "s/.*\"$2\": \([0-9.]*\).*/\1/p" $1 | head -n 1
+}
+
+# Compare results in files $1 and $2, tab separated with a header line.
+# Prints the number of fields that differ.
+compare_res () {
+    awk -F '\t' -v tol=${TOL} '
+        # One unit in the last printed digit of a number
+        function unit(a,    m, e) {
+            m = a; e = 0
+            if (match(a, /e[-+]?[0-9]+$/)) {
+                m = substr(a, 1, RSTART - 1); e = substr(a, RSTART + 1) + 0
+            }
+            return (index(m, ".") ? 10 ^ -(length(m) - index(m, ".")) : 1) * 10 ^ e
+        }
+        function differ(a, b,    d, s, u) {
+            if (a == b) return 0
+            if (a !~ /^-?[0-9.]+(e[-+]?[0-9]+)?$/ ||
+                b !~ /^-?[0-9.]+(e[-+]?[0-9]+)?$/) return 1
+            d = a - b; if (d < 0) d = -d
+            s = (b < 0) ? -b : b; if (s < 1) s = 1
+            u = unit(b); if (unit(a) > u) u = unit(a)
+            return d > tol * s && d > u * (1 + 1e-9)
+        }
+        NR == FNR {ref[FNR] = $0; nref = FNR; next}
+        FNR > 1 {
+            n = split(ref[FNR], r, "\t")
+            if (n != NF) {ndiff++; next}
+            for (i = 1; i <= NF; i++) ndiff += differ($i, r[i])
+        }
+        END {if (FNR != nref) ndiff++; print ndiff + 0}' $2 $1
+}
+
+check () {
+    d=$1
+    cd ${d}
+    if [ -e 'SKIP_RUN' ]
+    then
+        echo "${d}: skipped"
+        return 0
+    fi
+    if [ ${UPDATE} -eq 0 -a ! \( -e reference/fit -a -e reference/slr.res \) ]
+    then
+        echo "${d}: NOREF (skipped, no reference results; create with -u)"
+        return 0
+    fi
+    start=`date +%s.%N`
+    OPENBLAS_NUM_THREADS=1 stdbuf -o 0 ${SLR} -seed 123 -timemem 1 \
+        -outprefix ${prefix} > ${prefix}.log 2>&1
+    status=$?
+    wall=`awk -v s=${start} -v e=$(date +%s.%N) 'BEGIN {print e - s}'`
+    if [ ${status} -ne 0 ]
+    then
+        echo "${d}: FAIL (exit status ${status}, see ${d}/${prefix}.log)"
+        return 1
+    fi
+
+    prof=${prefix}.profile.json
+    printf "%s: wall %.1fs, cpu %ss, peak rss %s kB; phases (ms)" ${d} \
+        ${wall} `profile_value ${prof} user_seconds` \
+        `profile_value ${prof} peak_rss_kb`
+    grep '"name"' ${prof} |
+        sed 's/.*"name": "\([a-z]*\)", "ns": \([0-9]*\).*/\1 \2/' |
+        awk '{printf " %s %.0f", $1, $2 / 1e6} END {print ""}'
+
+    mkdir -p reference
+    if [ ${UPDATE} -eq 1 ]
+    then
+        fit ${prefix}.log > reference/fit
+        cp ${prefix}.res reference/slr.res
+    fi
+    if [ ${UPDATE} -eq 1 -o ${PROFILE} -eq 1 ]
+    then
+        cp ${prof} reference/profile.json
+        echo "${d}: reference updated"
+        return 0
+    fi
+
+    result=0
+    ndiff=`echo $(fit ${prefix}.log) $(cat reference/fit) |
+        awk -v tol=${TOL} '{
+            n = 0
+            for (i = 1; i <= 3; i++) {
+                d = $i - $(i + 3); if (d < 0) d = -d
+                s = $(i + 3); if (s < 0) s = -s; if (s < 1) s = 1
+                if (d > tol * s) n++
+            }
+            print n}'`
+    if [ ${ndiff} -ne 0 ]
+    then
+        echo "${d}: DRIFT in fit: $(fit ${prefix}.log) vs reference $(cat reference/fit)"
+        result=1
+    fi
+    ndiff=`compare_res ${prefix}.res reference/slr.res`
+    if [ ${ndiff} -ne 0 ]
+    then
+        echo "${d}: DRIFT in ${ndiff} fields of sitewise results"
+        result=1
+    fi
+    if [ -e reference/profile.json ]
+    then
+        new=`profile_value ${prof} total_ns`
+        old=`profile_value reference/profile.json total_ns`
+        ratio=`awk -v n=${new} -v o=${old} 'BEGIN {print n / o}'`
+        if awk -v r=${ratio} -v s=${SLOWDOWN} 'BEGIN {exit !(r > 1 + s)}'
+        then
+            printf "%s: SLOW (%.2f times reference)\n" ${d} ${ratio}
+            result=1
+        fi
+    fi
+    if [ ${result} -eq 0 ]
+    then
+        echo "${d}: OK"
+    fi
+    return ${result}
+}
+
+export SLR UPDATE PROFILE TOL SLOWDOWN prefix
+export -f fit profile_value compare_res check
+ls -d -p * | grep '/$' | sed 's,/$,,' |
+    xargs -n 1 -P ${NPARALLEL} bash -c 'check $0'
@@ -0,0 +1,109 @@
+#!/usr/bin/env bash
+# Measure how the time and memory used by Slr scale with the number of
+# species, the number of codons and the proportion of gaps.
+#
+#   scaling.sh [-n species] [-l codons] [-g gaps] [-t shapes] [-s seed] [out]
+#
+# Synthetic alignments and trees are made by SlrSim. The number of species
+# is swept with the number of codons fixed at the first value of -l, and
+# the number of codons is swept with the species fixed at the first value
+# of -n. Every point is repeated for each shape of tree and gap fraction.
+# Lists are quoted and space separated, for example -n "10 100 1000".
+#
+#   -n  Numbers of species [10 20 50 100 200 500 1000 2000 5000]
+#   -l  Numbers of codons [100 200 500 1000 2000 5000 10000 20000 50000 100000]
+#   -g  Proportions of codons that are gaps [0 0.2]
+#   -t  Shapes of tree [balanced caterpillar]
+#   -s  Seed for the simulations [1]
+#
+# One line is appended to the tab separated file out (default scaling.tsv)
+# for each run, giving the version of Slr, the parameters and the time (ms)
+# spent fitting the model (optimise and grid phases) and in the sitewise
+# tests, the total time and the peak memory. Plotting the times against
+# species or codons for two versions gives complexity curves to compare.
+SLR=`realpath -e ../bin/Slr`
+SLRSIM=`realpath -e ../bin/SlrSim`
+SPECIES="10 20 50 100 200 500 1000 2000 5000"
+CODONS="100 200 500 1000 2000 5000 10000 20000 50000 100000"
+GAPS="0 0.2"
+SHAPES="balanced caterpillar"
+SEED=1
+while getopts "n:l:g:t:s:" opt
+do
+    case ${opt} in
+        n) SPECIES=${OPTARG} ;;
+        l) CODONS=${OPTARG} ;;
+        g) GAPS=${OPTARG} ;;
+        t) SHAPES=${OPTARG} ;;
+        s) SEED=${OPTARG} ;;
+        *) exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+OUT=`realpath ${1:-scaling.tsv}`
+VERSION=`git -C .. describe --always --dirty 2>/dev/null || echo unknown`
+
+# Value of a field from a timemem profile
+profile_value () {
+    sed -n "s/.*\"$2\": \([0-9.]*\).*/\1/p" $1 | head -n 1
+}
+
+# Time (ns) spent in a phase, from a timemem profile
+phase_ns () {
+    sed -n "s/.*\"name\": \"$2\", \"ns\": \([0-9]*\).*/\1/p" $1
+}
+
+run () {
+    n_sp=$1
+    n_pts=$2
+    shape=$3
+    gaps=$4
+    ${SLRSIM} -n ${n_sp} -l ${n_pts} -t ${shape} -g ${gaps} -s ${SEED} sim ||
+        exit 1
+    OPENBLAS_NUM_THREADS=1 ${SLR} -seqfile sim.paml -treefile sim.trees \
+        -seed ${SEED} -timemem 1 -outprefix run > run.log 2>&1
+    if [ $? -ne 0 ]
+    then
+        echo "Slr failed for ${n_sp} species, ${n_pts} codons, ${shape}, gaps ${gaps}" >&2
+        return
+    fi
+    prof=run.profile.json
+    awk -v v=${VERSION} -v n=${n_sp} -v l=${n_pts} -v t=${shape} \
+        -v g=${gaps} -v opt=`phase_ns ${prof} optimise` \
+        -v grid=`phase_ns ${prof} grid` -v site=`phase_ns ${prof} sitewise` \
+        -v tot=`profile_value ${prof} total_ns` \
+        -v rss=`profile_value ${prof} peak_rss_kb` 'BEGIN {
+            printf "%s\t%d\t%d\t%s\t%s\t%.1f\t%.1f\t%.1f\t%d\n", v, n, l, t, g,
+                   (opt + grid) / 1e6, site / 1e6, tot / 1e6, rss
+        }' | tee -a ${OUT}
+}
+
+if [ ! -s ${OUT} ]
+then
+    echo -e "Version\tSpecies\tCodons\tShape\tGaps\tFit\tSitewise\tTotal\tPeakRSS" > ${OUT}
+fi
+WORK=`mktemp -d`
+cd ${WORK}
+set -- ${SPECIES}
+first_sp=$1
+set -- ${CODONS}
+first_pts=$1
+for shape in ${SHAPES}
+do
+    for gaps in ${GAPS}
+    do
+        for n_sp in ${SPECIES}
+        do
+            run ${n_sp} ${first_pts} ${shape} ${gaps}
+        done
+        for n_pts in ${CODONS}
+        do
+            if [ ${n_pts} -ne ${first_pts} ]
+            then
+                run ${first_sp} ${n_pts} ${shape} ${gaps}
+            fi
+        done
+    done
+done
+cd - > /dev/null
+rm -rf ${WORK}
@@ -267,3 +267,165 @@ double *  ConvertCodonFreqsToQcoord ( const double * freqs, const int gencode){
 
   return qfreqs;
 }
+
+
+/*  Set of nucleotides compatible with an IUPAC character, as a bit mask with
+ * bit i set for nucleotide i. Zero if the character is not a nucleotide.
+ */
+int NucleoSet (char c)
+{
+  switch (toupper (c)) {
+  case 'A': return 1;
+  case 'C': return 2;
+  case 'G': return 4;
+  case 'T':
+  case 'U': return 8;
+  case 'M': return 1 | 2;
+  case 'R': return 1 | 4;
+  case 'W': return 1 | 8;
+  case 'S': return 2 | 4;
+  case 'Y': return 2 | 8;
+  case 'K': return 4 | 8;
+  case 'V': return 1 | 2 | 4;
+  case 'H': return 1 | 2 | 8;
+  case 'D': return 1 | 4 | 8;
+  case 'B': return 2 | 4 | 8;
+  case 'N': return 1 | 2 | 4 | 8;
+  }
+
+  return 0;
+}
+
+
+/*  Set of codons compatible with the nucleotide sets at its three positions
+ */
+uint64_t CodonSet (const int * nucleo_set)
+{
+  uint64_t set = 0;
+
+  assert (NULL != nucleo_set);
+  for (int codon = 0; codon < 64; codon++)
+    if ((nucleo_set[0] >> (codon / 16) & 1)
+        && (nucleo_set[1] >> (codon / 4 % 4) & 1)
+        && (nucleo_set[2] >> (codon % 4) & 1))
+      set |= UINT64_C (1) << codon;
+
+  return set;
+}
+
+
+struct ambiguity_table * NewAmbiguityTable (void)
+{
+  struct ambiguity_table *table = calloc (1, sizeof (struct ambiguity_table));
+  if (NULL == table)
+    {
+      fputs ("Out of memory\n", stderr);
+      exit (EXIT_FAILURE);
+    }
+  table->refs = 1;
+
+  return table;
+}
+
+
+/*  Another reference to a table, which may be NULL
+ */
+struct ambiguity_table * ShareAmbiguityTable (struct ambiguity_table * table)
+{
+  if (NULL != table)
+    table->refs++;
+
+  return table;
+}
+
+
+void FreeAmbiguityTable (struct ambiguity_table * table)
+{
+  if (NULL == table || --table->refs > 0)
+    return;
+  free (table->amb);
+  free (table);
+}
+
+
+/*  Code for an observation compatible with a set of bases. A single base
+ * is returned as itself and a set containing every base (or none) as a gap.
+ * Other sets are added to the table if new; having more distinct sets than
+ * can be coded is a fatal error, since dropping them would silently change
+ * the data.
+ */
+int AmbiguityCode (struct ambiguity_table * table, uint64_t set,
+                   const int seqtype, const int nbase)
+{
+  assert (NULL != table);
+  assert (IsSeqtype (seqtype));
+  assert (nbase > 0 && nbase <= 64);
+
+  const uint64_t all = (64 == nbase) ? ~UINT64_C (0)
+                                     : (UINT64_C (1) << nbase) - 1;
+  set &= all;
+  if (0 == set || all == set)
+    return GapChar (seqtype);
+  if (0 == (set & (set - 1)))
+    return __builtin_ctzll (set);
+
+  for (int i = 0; i < table->n; i++)
+    if (table->amb[i].set == set && table->amb[i].seqtype == seqtype)
+      return AMBIG_FIRST + i;
+
+  if (MAX_AMBIG == table->n)
+    {
+      fprintf (stderr, "More than %d distinct ambiguous observations in one "
+               "data set. Read the alignment in smaller blocks (blocksize) "
+               "or treat ambiguous codons as gaps (cleandata = 0).\n",
+               MAX_AMBIG);
+      exit (EXIT_FAILURE);
+    }
+  if (table->n == table->max)
+    {
+      table->max = (0 == table->max) ? 8 : 2 * table->max;
+      if (table->max > MAX_AMBIG)
+        table->max = MAX_AMBIG;
+      table->amb = realloc (table->amb, table->max * sizeof (struct ambiguity));
+      if (NULL == table->amb)
+        {
+          fputs ("Out of memory\n", stderr);
+          exit (EXIT_FAILURE);
+        }
+    }
+
+  struct ambiguity *amb = table->amb + table->n;
+  amb->set = set;
+  amb->seqtype = seqtype;
+  amb->n = 0;
+  for (int base = 0; base < nbase; base++)
+    if (set >> base & 1)
+      amb->base[amb->n++] = base;
+
+  return AMBIG_FIRST + table->n++;
+}
+
+
+/*  Set of bases an ambiguity code stands for
+ */
+const struct ambiguity * Ambiguity (const struct ambiguity_table * table,
+                                    const int code)
+{
+  assert (NULL != table);
+  assert (IsAmbiguous (code));
+  assert (code - AMBIG_FIRST < table->n);
+
+  return table->amb + code - AMBIG_FIRST;
+}
+
+
+int NumberAmbiguities (const struct ambiguity_table * table)
+{
+  return (NULL == table) ? 0 : table->n;
+}
+
+
+int IsAmbiguous (const int base)
+{
+  return base >= AMBIG_FIRST;
+}
@@ -22,6 +22,8 @@
 #ifndef _BASES_H_
 #define _BASES_H_
 
+#include <stdint.h>
+
 int NumberPossibleBases ( const int seq_type, const int gencode);
 int CodonAsQcoord (int base, int seqtype, int gencode);
 int GapChar(int seqtype);
@@ -41,4 +43,38 @@ double *  ConvertCodonFreqsToQcoord ( const double * freqs, const int gencode);
 #define SEQTYPE_CODON		2
 #define SEQTYPE_CODONQ		3
 
+/*  Ambiguous observations are sets of compatible bases, numbered from
+ * AMBIG_FIRST upwards so that they fit in a byte above every gap character.
+ * The sets are kept in a table belonging to the data, so one data set can
+ * hold at most MAX_AMBIG distinct sets.
+ */
+#define AMBIG_FIRST		65
+#define MAX_AMBIG		(256 - AMBIG_FIRST)
+
+struct ambiguity {
+  uint64_t set;
+  int seqtype;
+  int n;
+  uint8_t base[64];
+};
+
+/*  Codes are only ever added to a table, so it may be shared by data sets
+ * derived from one another. It is freed with the last of them.
+ */
+struct ambiguity_table {
+  int refs;
+  int n, max;
+  struct ambiguity *amb;
+};
+
+int NucleoSet ( char c);
+uint64_t CodonSet ( const int * nucleo_set);
+struct ambiguity_table * NewAmbiguityTable ( void);
+struct ambiguity_table * ShareAmbiguityTable ( struct ambiguity_table * table);
+void FreeAmbiguityTable ( struct ambiguity_table * table);
+int AmbiguityCode ( struct ambiguity_table * table, uint64_t set, const int seqtype, const int nbase);
+const struct ambiguity * Ambiguity ( const struct ambiguity_table * table, const int code);
+int NumberAmbiguities ( const struct ambiguity_table * table);
+int IsAmbiguous ( const int base);
+
 #endif
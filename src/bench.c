@@ -0,0 +1,281 @@
+/*
+ *  Copyright 2003-2008 Tim Massingham (tim.massingham@ebi.ac.uk)
+ *  Funded by EMBL - European Bioinformatics Institute
+ */
+/*
+ *  This file is part of SLR ("Sitewise Likelihood Ratio")
+ *
+ *  SLR is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SLR is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SLR.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*  Microbenchmarks for the kernels that dominate the run time of Slr.
+ *
+ *  Usage: SlrBench seqfile treefile [batches]
+ *
+ *  Each kernel is timed in batches of calls, long enough to be well above
+ * the resolution of the clock. One tab-separated line is written per
+ * kernel: name, calls per batch, mean, standard deviation and minimum of
+ * the time per call over batches (nanoseconds), and an estimate of the
+ * floating point rate (GFLOP/s) where the operation count is known.
+ */
+
+#include <assert.h>
+#include <err.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bases.h"
+#include "codonmodel.h"
+#include "data.h"
+#include "like.h"
+#include "linemin.h"
+#include "matrix.h"
+#include "model.h"
+#include "profile.h"
+#include "tree.h"
+#include "tree_data.h"
+#include "utility.h"
+
+#define BENCH_BATCH_NS  20000000ULL
+#define BENCH_KAPPA     2.0
+#define BENCH_OMEGA     0.1
+
+struct bench_state {
+    DATA_SET *codons;           /* Uncompressed, for sort and compress */
+    DATA_SET *data;
+    DATA_SET *data_single;
+    TREE *tree;
+    MODEL *model;
+    MODEL *model_single;
+    struct single_fun info;
+    struct single_fun info_single;
+    double *mat;
+    double *grad;
+    int site;
+};
+
+typedef void (*bench_fun) (struct bench_state *);
+
+static void bench_prune(struct bench_state *s)
+{
+    LikeVector(s->tree, s->model, s->info.p);
+}
+
+static void bench_backwards(struct bench_state *s)
+{
+    Backwards(s->tree->tree, NULL, s->tree, s->model);
+}
+
+static void bench_model_derivatives(struct bench_state *s)
+{
+    DoModelDerviatives(s->model, s->tree, s->grad, s->info.p,
+                       s->tree->tree->scalefactor);
+}
+
+static void bench_getp(struct bench_state *s)
+{
+    GetP(s->model, 0.1, s->mat);
+}
+
+static void bench_factorize(struct bench_state *s)
+{
+    MODEL *model = s->model;
+    const int n = model->nbase;
+    CopyMatrix(model->q, s->mat, n);
+    MakeSym_From_Q(s->mat, model->pi, n);
+    FactorizeMatrix(s->mat, n, model->ev, model->v, model->space);
+}
+
+static void bench_getq(struct bench_state *s)
+{
+    s->model->Getq(s->model);
+}
+
+static void bench_sort_compress(struct bench_state *s)
+{
+    DATA_SET *copy = CopyDataSet(s->codons);
+    OOM(copy);
+    sort_data(copy);
+    DATA_SET *compressed = compress_data(copy);
+    FreeDataSet(compressed);
+    FreeDataSet(copy);
+}
+
+/*  Sitewise optimisation of omega, as done for each unique site pattern */
+static void bench_site(struct bench_state *s)
+{
+    const DATA_SET *data = s->data;
+    do {
+        s->site = (s->site + 1) % data->n_pts;
+    } while (data->index[s->site] < 0);
+    CopySiteToDataSet(data, s->data_single, s->site);
+    add_data_to_tree(s->data_single, s->tree, s->model_single);
+    double x[1] = { BENCH_OMEGA };
+    int neval = 0;
+    linemin_1d(CalcLike_Single, x, &s->info_single, 0., 99., 1e-5, &neval);
+}
+
+/*  Put the full data on the tree and do a pruning pass, which Backwards
+ * and the model derivatives start from.
+ */
+static void bench_setup(struct bench_state *s)
+{
+    add_data_to_tree(s->data, s->tree, s->model);
+    LikeVector(s->tree, s->model, s->info.p);
+}
+
+static void run_bench(const char *name, bench_fun fun, struct bench_state *s,
+                      const int nbatch, const double flops)
+{
+    /*  Calibrate number of calls per batch, which also warms up */
+    uint64_t t = ProfileClock();
+    fun(s);
+    t = ProfileClock() - t;
+    int ncall = 1;
+    if (t < BENCH_BATCH_NS) {
+        ncall = (int)(BENCH_BATCH_NS / ((t > 0) ? t : 1));
+    }
+
+    double sum = 0., sumsq = 0., min = HUGE_VAL;
+    for (int b = 0; b < nbatch; b++) {
+        t = ProfileClock();
+        for (int i = 0; i < ncall; i++) {
+            fun(s);
+        }
+        const double ns = (double)(ProfileClock() - t) / ncall;
+        sum += ns;
+        sumsq += ns * ns;
+        min = (ns < min) ? ns : min;
+    }
+    const double mean = sum / nbatch;
+    const double var = (nbatch > 1) ?
+        (sumsq - nbatch * mean * mean) / (nbatch - 1) : 0.;
+    printf("%s\t%d\t%.1f\t%.1f\t%.1f\t", name, ncall, mean,
+           sqrt((var > 0.) ? var : 0.), min);
+    if (flops > 0.) {
+        printf("%.3f\n", flops / mean);
+    } else {
+        puts("-");
+    }
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3) {
+        fputs("Usage: SlrBench seqfile treefile [batches]\n", stderr);
+        return EXIT_FAILURE;
+    }
+    const int nbatch = (argc > 3) ? atoi(argv[3]) : 10;
+    if (nbatch < 1) {
+        errx(EXIT_FAILURE, "Number of batches must be positive");
+    }
+    const int gencode = 0;
+    struct bench_state s;
+    memset(&s, 0, sizeof(s));
+
+    /*  Data prepared as by Slr */
+    DATA_SET *nuc = read_data(argv[1], SEQTYPE_NUCLEO);
+    if (NULL == nuc) {
+        errx(EXIT_FAILURE, "Failed to read %s", argv[1]);
+    }
+    s.codons = ConvertNucToCodon(nuc, gencode);
+    OOM(s.codons);
+    FreeDataSet(nuc);
+    DATA_SET *tmp = CopyDataSet(s.codons);
+    OOM(tmp);
+    sort_data(tmp);
+    DATA_SET *compressed = compress_data(tmp);
+    OOM(compressed);
+    FreeDataSet(tmp);
+    s.data = RemoveTrivialObs(compressed);
+    OOM(s.data);
+    FreeDataSet(compressed);
+    double *freqs = GetBaseFreqs(s.data, 0);
+    OOM(freqs);
+    ConvertCodonToQcoord(s.data);
+
+    TREE **trees = read_tree_strings(argv[2]);
+    if (NULL == trees || NULL == trees[0]) {
+        errx(EXIT_FAILURE, "Failed to read tree from %s", argv[2]);
+    }
+    s.tree = trees[0];
+    create_tree(s.tree);
+    for (int b = 0; b < s.tree->n_br; b++) {
+        NODE *node = s.tree->branches[b];
+        if (node->blength[0] < 0.) {
+            node->blength[0] = 0.1;
+            const int a = find_connection(node->branch[0], node);
+            node->branch[0]->blength[a] = 0.1;
+        }
+    }
+
+    s.model = NewCodonModel_full(s.data->gencode, BENCH_KAPPA, BENCH_OMEGA,
+                                 freqs, 0, 1, Branches_Fixed, NULL);
+    OOM(s.model);
+    s.model->exact_obs = 1;
+    s.model_single = NewCodonModel_single(s.data->gencode, BENCH_KAPPA,
+                                          BENCH_OMEGA, freqs, 0, 1, NULL);
+    OOM(s.model_single);
+    s.model_single->exact_obs = 1;
+
+    s.info.tree = s.tree;
+    s.info.model = s.model;
+    s.info.p = calloc(2 * s.data->n_pts, sizeof(double));
+    OOM(s.info.p);
+    s.info_single.tree = s.tree;
+    s.info_single.model = s.model_single;
+    s.info_single.p = calloc(2 * s.data->n_pts, sizeof(double));
+    OOM(s.info_single.p);
+
+    s.data_single = CreateDataSet(1, s.data->n_sp);
+    OOM(s.data_single);
+    for (int sp = 0; sp < s.data->n_sp; sp++) {
+        s.data_single->sp_name[sp] = malloc(strlen(s.data->sp_name[sp]) + 1);
+        OOM(s.data_single->sp_name[sp]);
+        strcpy(s.data_single->sp_name[sp], s.data->sp_name[sp]);
+    }
+
+    const int n = s.model->nbase;
+    const int npts = s.data->n_unique_pts;
+    s.mat = calloc(n * n, sizeof(double));
+    s.grad = calloc(s.model->nparam * npts, sizeof(double));
+    OOM(s.mat);
+    OOM(s.grad);
+
+    bench_setup(&s);
+    printf("# %s: %d species, %d sites, %d unique patterns, %d branches\n",
+           argv[1], s.data->n_sp, s.data->n_pts, npts, s.tree->n_br);
+    puts("Kernel\tCalls\tMean\tSD\tMin\tGFLOPs");
+
+    /*  Operation counts: a transition matrix is one product of n by n
+     * matrices, and each branch of a pruning pass applies one to every
+     * pattern.
+     */
+    const double nbr = s.tree->n_br;
+    const double flops_getp = 2. * n * n * n;
+    const double flops_prune = nbr * (flops_getp + 2. * npts * n * n);
+
+    run_bench("CalcLike_Sub", bench_prune, &s, nbatch, flops_prune);
+    run_bench("Backwards", bench_backwards, &s, nbatch, 0.);
+    run_bench("DoModelDerviatives", bench_model_derivatives, &s, nbatch, 0.);
+    run_bench("GetP", bench_getp, &s, nbatch, flops_getp);
+    run_bench("Factorize", bench_factorize, &s, nbatch, 9. * n * n * n);
+    run_bench("GetQ_Codon", bench_getq, &s, nbatch, 0.);
+    run_bench("sort_compress", bench_sort_compress, &s, nbatch, 0.);
+    run_bench("Site", bench_site, &s, nbatch, 0.);
+
+    return EXIT_SUCCESS;
+}
@@ -46,35 +46,32 @@ double          GetParam_Codon_singleDnDs(MODEL * model, int i);
 double          GetParam_Codon_single(MODEL * model, int i);
 double          GetParam_Codon_full(MODEL * model, int i);
 void            GetQ_Codon(MODEL * model);
-double         *GetS_Codon(double *mat, double kappa, double omega, int gencode);
-double          CodonOmegaFunc_GY(int i, int j, int gencode, double omega);
-double          CodonOmegaFunc_YN(int i, int j, int gencode, double omega);
-double          CodonOmegaFunc_Trad(int i, int j, int gencode, double omega);
-double          CodonOmegaDFunc_GY(int i, int j, int gencode, double omega);
-double          CodonOmegaDFunc_YN(int i, int j, int gencode, double omega);
-double          CodonOmegaDFunc_Trad(int i, int j, int gencode, double omega);
-double          NucleoFunc_Trad(int i, int j);
-double          NucleoFunc_Empirical(int i, int j);
+double         *GetS_Codon(double *mat, double kappa, double omega, int gencode, const CODONFUNCS * cf);
+double          CodonOmegaFunc_GY(const double *aparam, int i, int j, int gencode, double omega);
+double          CodonOmegaFunc_YN(const double *aparam, int i, int j, int gencode, double omega);
+double          CodonOmegaFunc_Trad(const double *aparam, int i, int j, int gencode, double omega);
+double          CodonOmegaDFunc_GY(const double *aparam, int i, int j, int gencode, double omega);
+double          CodonOmegaDFunc_YN(const double *aparam, int i, int j, int gencode, double omega);
+double          CodonOmegaDFunc_Trad(const double *aparam, int i, int j, int gencode, double omega);
+double          NucleoFunc_Trad(const double *nparam, int i, int j);
+double          NucleoFunc_Empirical(const double *nparam, int i, int j);
 int             FindAmino(int a);
 void            GetdQ_Codon(MODEL * model, int n, double *q);
 void            GetdQ_Codon_single(MODEL * model, int n, double *q);
 void            GetdQ_Codon_singleDnDs(MODEL * model, int n, double *q);
 
-double          CodonNeutScale = -1.;
+/* Traditional model, used when no substitution functions are given */
+static const CODONFUNCS CodonFuncs_Trad = {
+	CodonOmegaFunc_Trad, CodonOmegaDFunc_Trad, NucleoFunc_Trad, NULL, NULL, 0, 0
+};
 
-double          (*CodonOmegaFunc) (int, int, int, double) = CodonOmegaFunc_Trad;
-double          (*CodonOmegaDFunc) (int, int, int, double) = CodonOmegaDFunc_Trad;
-double          (*NucleoFunc) (int, int) = NucleoFunc_Trad;
-double         *AminoParam;
-double         *NucleoParam;
 
 
 
-
-double          NucleoParam_GY_Nov2003[6] =
+const double    NucleoParam_GY_Nov2003[6] =
 {1.430297e+00, 1.098538e+00, 8.583175e-01, 1.356069e+00, 8.964170e-01,
 1.0};
-double          AminoParam_YN_Aug2003[75] =
+const double    AminoParam_YN_Aug2003[75] =
 {7.246981e-01, 1.172268e+00, 9.984862e-01, 6.918285e-01, 1.119923e+00,
 	7.342144e-01, 1.093398e+00, 9.163887e-01, 9.258153e-01, 3.689281e-01, 1.117877e+00, 9.666899e-01,
 	8.665321e-01, 7.172281e-01, 1.036078e+00, 7.999008e-01, 8.178675e-01, 1.175573e+00, 1.101923e+00,
@@ -86,7 +83,7 @@ double          AminoParam_YN_Aug2003[75] =
 	1.149040e+00, 1.068516e+00, 1.405100e+00, 9.940865e-01, 8.231903e-01, 1.448649e+00, 2.091072e+00,
 	7.927921e-01, 1.161951e+00, 6.347661e-01, 8.120879e-01, 1.178658e+00, 1.482881e+00, 1.262502e+00,
 7.766948e-01, 1.728667e+00, 1.347645e+00, 8.128504e-01, 1.151783e+00, 1.017869e+00, 1.073362e+00};
-double          AminoParam_GY_Jul2003[75] =
+const double    AminoParam_GY_Jul2003[75] =
 {6.835927e-01, 1.209163e+00, 9.952726e-01, 6.380563e-01, 1.147592e+00,
 	6.916782e-01, 1.110758e+00, 8.949536e-01, 9.215446e-01, 3.098561e-01, 1.139620e+00, 9.515103e-01,
 	8.349999e-01, 6.606077e-01, 1.041374e+00, 7.547796e-01, 7.866363e-01, 1.206560e+00, 1.123561e+00,
@@ -98,7 +95,7 @@ double          AminoParam_GY_Jul2003[75] =
 	1.187643e+00, 1.077477e+00, 1.494502e+00, 9.920281e-01, 7.984678e-01, 1.563178e+00, 2.370527e+00,
 	7.582842e-01, 1.191066e+00, 5.778130e-01, 7.737373e-01, 1.209538e+00, 1.598847e+00, 1.313805e+00,
 7.414139e-01, 1.902686e+00, 1.423158e+00, 7.801932e-01, 1.194610e+00, 1.020845e+00, 1.094042e+00};
-double          AminoParam_GYemp_Nov2003[75] =
+const double    AminoParam_GYemp_Nov2003[75] =
 {7.737833e-01, 1.220770e+00, 1.035662e+00, 7.042135e-01, 1.086157e+00,
 	7.680027e-01, 1.175832e+00, 9.352375e-01, 9.984958e-01, 3.007928e-01, 1.076708e+00, 1.092336e+00,
 	8.174411e-01, 6.994509e-01, 1.088471e+00, 8.128131e-01, 8.024236e-01, 1.437222e+00, 1.065822e+00,
@@ -116,20 +113,26 @@ int             AminoMap[75] =
 	20, 15, 18, 5, 3, 22, 27, 21, 24, 25, 180, 177, 181, 171, 178, 174, 184, 183, 155, 161,
 168, 156, 157, 166, 119, 105, 115, 118, 7, 137, 151, 140, 143, 146, 87, 88, 82};
 
-void
-SetAminoAndCodonFuncs(const int nucleo_type, const int amino_type, const char *nucleofile, const char *aminofile)
+CODONFUNCS     *
+NewCodonFuncs(const int nucleo_type, const int amino_type, const char *nucleofile, const char *aminofile)
 {
 	FILE           *fp;
 	int             Err = 0, i;
 	double         *aminos = NULL, *nucleos = NULL;
+	CODONFUNCS     *cf;
+
+	cf = malloc(sizeof(CODONFUNCS));
+	if (NULL == cf)
+		return NULL;
+	*cf = CodonFuncs_Trad;
 
 	/* Dealt with Nucleotide */
 	switch (nucleo_type) {
 	case 0:
-		NucleoFunc = NucleoFunc_Trad;
+		cf->nucleo = NucleoFunc_Trad;
 		break;
 	case 1:
-		NucleoFunc = NucleoFunc_Empirical;
+		cf->nucleo = NucleoFunc_Empirical;
 
 		if (NULL != nucleofile) {
 			printf("# Reading nucleotide substitution parameters from %s\n", nucleofile);
@@ -146,6 +149,7 @@ SetAminoAndCodonFuncs(const int nucleo_type, const int amino_type, const char *n
 		if (NULL != fp) {
 			nucleos = malloc(6 * sizeof(double));
 			Err = ReadVectorFromOpenFile(nucleos, 5, fp);
+			fclose(fp);
 			nucleos[5] = 1.;
 			for (i = 0; i < 5; i++)
 				if (nucleos[i] < 0.) {
@@ -156,37 +160,41 @@ SetAminoAndCodonFuncs(const int nucleo_type, const int amino_type, const char *n
 				}
 			if (EOF == Err)
 				free(nucleos);
+			else {
+				cf->nucleoparam = nucleos;
+				cf->own_nucleoparam = 1;
+			}
 		}
 		if (NULL == fp || EOF == Err) {
 			printf("# Reading failed. Falling back to default values\n");
-			NucleoParam = NucleoParam_GY_Nov2003;
+			cf->nucleoparam = NucleoParam_GY_Nov2003;
 		}
 		break;
 	default:
 		printf("# Unrecognised nucleo_type. Using traditional model.\n");
-		NucleoFunc = NucleoFunc_Trad;
+		cf->nucleo = NucleoFunc_Trad;
 	}
 
 	Err = 0;
 	/* Deal with amino acids */
 	switch (amino_type) {
 	case 0:
-		CodonOmegaFunc = CodonOmegaFunc_Trad;
-		CodonOmegaDFunc = CodonOmegaDFunc_Trad;
-		return;
+		cf->omega = CodonOmegaFunc_Trad;
+		cf->domega = CodonOmegaDFunc_Trad;
+		return cf;
 	case 1:
-		CodonOmegaFunc = CodonOmegaFunc_GY;
-		CodonOmegaDFunc = CodonOmegaDFunc_GY;
+		cf->omega = CodonOmegaFunc_GY;
+		cf->domega = CodonOmegaDFunc_GY;
 		break;
 	case 2:
-		CodonOmegaFunc = CodonOmegaFunc_YN;
-		CodonOmegaDFunc = CodonOmegaDFunc_YN;
+		cf->omega = CodonOmegaFunc_YN;
+		cf->domega = CodonOmegaDFunc_YN;
 		break;
 	default:
 		printf("# Unrecogonised amino_type. Using traditional model.\n");
-		CodonOmegaFunc = CodonOmegaFunc_Trad;
-		CodonOmegaDFunc = CodonOmegaDFunc_Trad;
-		return;
+		cf->omega = CodonOmegaFunc_Trad;
+		cf->domega = CodonOmegaDFunc_Trad;
+		return cf;
 	}
 
 	if (NULL != aminofile) {
@@ -212,6 +220,7 @@ SetAminoAndCodonFuncs(const int nucleo_type, const int amino_type, const char *n
 	if (NULL != fp) {
 		aminos = malloc(75 * sizeof(double));
 		Err = ReadVectorFromOpenFile(aminos, 75, fp);
+		fclose(fp);
 		for (i = 0; i < 75; i++)
 			if (aminos[i] < 0.) {
 				Err = EOF;
@@ -221,23 +230,41 @@ SetAminoAndCodonFuncs(const int nucleo_type, const int amino_type, const char *n
 			}
 		if (EOF == Err)
 			free(aminos);
+		else {
+			cf->aminoparam = aminos;
+			cf->own_aminoparam = 1;
+		}
 	}
 	if (NULL == fp || EOF == Err) {
 		printf("# Reading failed. Falling back to default values\n");
 		if (2 == amino_type)
-			AminoParam = AminoParam_YN_Aug2003;
+			cf->aminoparam = AminoParam_YN_Aug2003;
 		else if (1 == amino_type) {
 			if (1 == nucleo_type)
-				AminoParam = AminoParam_GYemp_Nov2003;
+				cf->aminoparam = AminoParam_GYemp_Nov2003;
 			else
-				AminoParam = AminoParam_GY_Jul2003;
+				cf->aminoparam = AminoParam_GY_Jul2003;
 		}
 	}
+
+	return cf;
+}
+
+void
+FreeCodonFuncs(CODONFUNCS * cf)
+{
+	if (NULL == cf)
+		return;
+	if (cf->own_nucleoparam)
+		free((double *)cf->nucleoparam);
+	if (cf->own_aminoparam)
+		free((double *)cf->aminoparam);
+	free(cf);
 }
 
 
 double
-CodonOmegaFunc_GY(int i, int j, int gencode, double omega)
+CodonOmegaFunc_GY(const double *aparam, int i, int j, int gencode, double omega)
 {
 	int             ai, aj, t;
 
@@ -251,11 +278,11 @@ CodonOmegaFunc_GY(int i, int j, int gencode, double omega)
 	t = FindAmino(t);
 
 	omega = (omega > 0.) ? omega : 1e-16;
-	return pow(omega, AminoParam[t]);
+	return pow(omega, aparam[t]);
 }
 
 double
-CodonOmegaDFunc_GY(int i, int j, int gencode, double omega)
+CodonOmegaDFunc_GY(const double *aparam, int i, int j, int gencode, double omega)
 {
 	int             ai, aj, t;
 
@@ -270,11 +297,11 @@ CodonOmegaDFunc_GY(int i, int j, int gencode, double omega)
 
 	omega = (omega > 0.) ? omega : 1e-16;
 
-	return (AminoParam[t] * pow(omega, (AminoParam[t] - 1.)));
+	return (aparam[t] * pow(omega, (aparam[t] - 1.)));
 }
 
 double
-CodonOmegaFunc_YN(int i, int j, int gencode, double omega)
+CodonOmegaFunc_YN(const double *aparam, int i, int j, int gencode, double omega)
 {
 	int             ai, aj, t;
 
@@ -290,12 +317,12 @@ CodonOmegaFunc_YN(int i, int j, int gencode, double omega)
 
 	omega = (omega > 0.) ? omega : 1e-16;
 
-	return (log(omega) * AminoParam[t] /
-		(-expm1(-log(omega) * AminoParam[t])));
+	return (log(omega) * aparam[t] /
+		(-expm1(-log(omega) * aparam[t])));
 }
 
 double
-CodonOmegaDFunc_YN(int i, int j, int gencode, double omega)
+CodonOmegaDFunc_YN(const double *aparam, int i, int j, int gencode, double omega)
 {
 	int             ai, aj, t;
 
@@ -311,40 +338,40 @@ CodonOmegaDFunc_YN(int i, int j, int gencode, double omega)
 
 	omega = (omega > 0.) ? omega : 1e-16;
 
-	return (AminoParam[t] *
-		((1. - pow(omega, -AminoParam[t])) / omega -
-		 AminoParam[t] * log(omega) * pow(omega,
-					      -AminoParam[t] - 1.)) / ((1. -
+	return (aparam[t] *
+		((1. - pow(omega, -aparam[t])) / omega -
+		 aparam[t] * log(omega) * pow(omega,
+					      -aparam[t] - 1.)) / ((1. -
 									pow
 								     (omega,
-								  AminoParam
+								  aparam
 								      [t]))
 								     * (1. -
 									pow
 								     (omega,
-								  AminoParam
+								  aparam
 								    [t]))));
 }
 double
-CodonOmegaFunc_Trad(int i, int j, int gencode, double omega)
+CodonOmegaFunc_Trad(const double *aparam, int i, int j, int gencode, double omega)
 {
 	return omega;
 }
 
 double
-CodonOmegaDFunc_Trad(int i, int j, int gencode, double omega)
+CodonOmegaDFunc_Trad(const double *aparam, int i, int j, int gencode, double omega)
 {
 	return 1.;
 }
 
 double
-NucleoFunc_Trad(int i, int j)
+NucleoFunc_Trad(const double *nparam, int i, int j)
 {
 	return 1.;
 }
 
 double
-NucleoFunc_Empirical(int i, int j)
+NucleoFunc_Empirical(const double *nparam, int i, int j)
 {
 	int             t = 0;
 
@@ -356,13 +383,13 @@ NucleoFunc_Empirical(int i, int j)
 	t = UpperTriangularCoordinate((i & 3), (j & 3), 4);
 
 
-	return NucleoParam[t];
+	return nparam[t];
 }
 
 
 
 double         *
-GetS_Codon(double *mat, double kappa, double omega, int gencode)
+GetS_Codon(double *mat, double kappa, double omega, int gencode, const CODONFUNCS * cf)
 {
 	int             nbase;
 	int             i, j, ib, jb;
@@ -396,11 +423,11 @@ GetS_Codon(double *mat, double kappa, double omega, int gencode)
 					} else if (NumberNucChanges(i,j) == 0)
 						printf("Error!\n");
 					else {
-						mat[ib * nbase + jb] = NucleoFunc(i, j);
+						mat[ib * nbase + jb] = cf->nucleo(cf->nucleoparam, i, j);
 						if (HasTransition(i, j))
 							mat[ib * nbase + jb] *= kappa;
 						if (IsNonSynonymous(i, j, gencode)) {
-							mat[ib * nbase + jb] *= CodonOmegaFunc(i, j, gencode, omega);
+							mat[ib * nbase + jb] *= cf->omega(cf->aminoparam, i, j, gencode, omega);
 						}
 					}
 					mat[jb * nbase + ib] = mat[ib * nbase + jb];
@@ -427,7 +454,7 @@ GetQ_Codon(MODEL * model)
 	const double kappa = model->param[0+paramoffset];
 	const double omega = model->param[1+paramoffset];
 
-	mat = GetS_Codon(mat, kappa, omega, model->gencode);
+	mat = GetS_Codon(mat, kappa, omega, model->gencode, model->cfuncs);
 	if (NULL == mat)
 		return;
 
@@ -495,7 +522,7 @@ Update_Codon(MODEL * model, double p, int i)
 }
 
 MODEL          *
-NewCodonModel(const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type, const enum model_branches branopt)
+NewCodonModel(const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type, const enum model_branches branopt, const CODONFUNCS * cf)
 {
 	int             n;
 	MODEL          *model;
@@ -505,6 +532,7 @@ NewCodonModel(const int gencode, const double kappa, const double omega, const d
 	model = NewModel(n, nparam);
 	if (NULL != model) {
 		model->gencode = gencode;
+		model->cfuncs = (NULL != cf) ? cf : &CodonFuncs_Trad;
 		model->Getq = GetQ_Codon;
 		model->Scale = Scale_Codon;
 		model->Rate = Rate_Codon;
@@ -531,11 +559,11 @@ NewCodonModel(const int gencode, const double kappa, const double omega, const d
 
 
 MODEL          *
-NewCodonModel_single(const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type)
+NewCodonModel_single(const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type, const CODONFUNCS * cf)
 {
 	MODEL          *model;
 
-	model = NewCodonModel(gencode, kappa, omega, pi, codonf, freq_type, Branches_Fixed);
+	model = NewCodonModel(gencode, kappa, omega, pi, codonf, freq_type, Branches_Fixed, cf);
 
 	model->nparam = 1;
 	model->Scale = Scale_Codon_single;
@@ -547,11 +575,11 @@ NewCodonModel_single(const int gencode, const double kappa, const double omega,
 }
 
 MODEL          *
-NewCodonModel_singleDnDs(const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type)
+NewCodonModel_singleDnDs(const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type, const CODONFUNCS * cf)
 {
 	MODEL          *model;
 
-	model = NewCodonModel(gencode, kappa, omega, pi, codonf, freq_type, Branches_Fixed);
+	model = NewCodonModel(gencode, kappa, omega, pi, codonf, freq_type, Branches_Fixed, cf);
 
 	model->nparam = 2;
 	model->Scale = Scale_Codon_single;
@@ -590,15 +618,15 @@ double
 Scale_Codon_single(MODEL * model)
 {
 	double          omega;
-	if (CodonNeutScale < 0) {
+	if (model->neutscale < 0) {
 		omega = model->param[1];
 		model->param[1] = 1.0;
 		model->Getq(model);
-		CodonNeutScale = model->scale;
+		model->neutscale = model->scale;
 		model->param[1] = omega;
 		model->updated = 1;
 	}
-	return CodonNeutScale;
+	return model->neutscale;
 }
 
 
@@ -701,6 +729,7 @@ GetdQ_Codon(MODEL * model, int param, double *q)
 	const unsigned int nbase = model->nbase;
 	const unsigned int nparam = model->nparam;
 	const unsigned int gencode = model->gencode;
+	const CODONFUNCS *cf = model->cfuncs;
 	mat = model->dq;
 	s = Scale(model);
 
@@ -741,12 +770,12 @@ GetdQ_Codon(MODEL * model, int param, double *q)
 						nonsyn = 1;
 					}
 					if (param == 0 && tran == 1) {
-						mat[ai * nbase + aj] = NucleoFunc(i, j);
+						mat[ai * nbase + aj] = cf->nucleo(cf->nucleoparam, i, j);
 						if (nonsyn == 1)
-							mat[ai * nbase + aj] *= CodonOmegaFunc(i, j, gencode, omega);
+							mat[ai * nbase + aj] *= cf->omega(cf->aminoparam, i, j, gencode, omega);
 					} else if (param == 1 && nonsyn == 1) {
 						mat[ai * nbase + aj] =
-							NucleoFunc(i, j) * CodonOmegaDFunc(i, j, gencode, omega);
+							cf->nucleo(cf->nucleoparam, i, j) * cf->domega(cf->aminoparam, i, j, gencode, omega);
 						if (tran == 1)
 							mat[ai * nbase + aj] *= kappa;
 					}
@@ -835,7 +864,7 @@ GetdQ_Codon(MODEL * model, int param, double *q)
 
 
 MODEL          *
-NewCodonModel_full(const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type, const enum model_branches branopt)
+NewCodonModel_full(const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type, const enum model_branches branopt, const CODONFUNCS * cf)
 {
 	int             n;
 	MODEL          *model;
@@ -845,6 +874,7 @@ NewCodonModel_full(const int gencode, const double kappa, const double omega, co
 	model = NewModel(n, nparam);
 	if (NULL != model) {
 		model->gencode = gencode;
+		model->cfuncs = (NULL != cf) ? cf : &CodonFuncs_Trad;
 		model->Getq = GetQ_Codon;
 		model->Scale = Scale_Codon;
 		model->Rate = Rate_Codon;
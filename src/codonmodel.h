@@ -26,12 +26,25 @@
 #include "model.h"
 #endif
 
-MODEL * NewCodonModel ( const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type, const enum model_branches branopt);
-MODEL *NewCodonModel_singleDnDs (const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type);
-MODEL * NewCodonModel_single ( const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type);
-MODEL * NewCodonModel_full ( const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type, const enum model_branches branopt);
+/*  Substitution functions and their parameters, shared read-only by every
+ * model built from them. A NULL pointer means the traditional model.
+ */
+typedef struct codonfuncs {
+	double (*omega)(const double *, int, int, int, double);
+	double (*domega)(const double *, int, int, int, double);
+	double (*nucleo)(const double *, int, int);
+	const double * aminoparam;
+	const double * nucleoparam;
+	int own_aminoparam, own_nucleoparam;
+} CODONFUNCS;
+
+MODEL * NewCodonModel ( const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type, const enum model_branches branopt, const CODONFUNCS * cf);
+MODEL *NewCodonModel_singleDnDs (const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type, const CODONFUNCS * cf);
+MODEL * NewCodonModel_single ( const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type, const CODONFUNCS * cf);
+MODEL * NewCodonModel_full ( const int gencode, const double kappa, const double omega, const double *pi, const int codonf, const int freq_type, const enum model_branches branopt, const CODONFUNCS * cf);
 double GetScale_single ( MODEL * model, const double f);
-void SetAminoAndCodonFuncs ( const int nucleo_type, const int amino_type, const char * nucleofile, const char * aminofile);
+CODONFUNCS * NewCodonFuncs ( const int nucleo_type, const int amino_type, const char * nucleofile, const char * aminofile);
+void FreeCodonFuncs ( CODONFUNCS * cf);
 double *  GetEquilibriumDistCodon (const double * pi,const int codonf, const int gencode);
 
 #endif
@@ -33,6 +33,12 @@
 #include <limits.h>
 #include <float.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #define Free(A) if( A != NULL){ free( A );  A = NULL;}
 #ifndef OOM
@@ -41,15 +47,23 @@
                   exit (EXIT_FAILURE); }
 #endif
 
+/* Codon with some but not all positions gapped, while reading */
+#define ODD_GAP -2
+/*
+ * Ambiguous codon held by a reader, the sets of nucleotides at its three
+ * positions packed four bits apiece. It is given a code when taken into a
+ * data set, since codes belong to the data.
+ */
+#define READ_AMBIG 0x1000
+
 
 
-static int      lexo(const int **seq, const int i, const int j, const int n);
-static int      lexo2(const int *seq1, const int **seq, const int i, const int n);
-static void     UpdateIndex(DATA_SET * data, const int a, const int b);
+static int      compare_columns(const DATA_SET * data, const int i, const int j);
+static void     RemapIndex(DATA_SET * data, const int *map);
 static int     *ReadNucleo(FILE * fp, int n_pts, const char * name);
 static int     *ReadAmino (FILE * fp, int n_pts, const char * name);
-static void     SaveNucleoSeq(FILE * fp, int *seq, int length);
-static void     save_amino_seq(FILE * fp, int *seq, int length);
+static void     SaveNucleoSeq(FILE * fp, const DATA_SET * data, int sp);
+static void     save_amino_seq(FILE * fp, const DATA_SET * data, int sp);
 
 
 
@@ -67,7 +81,8 @@ CheckIsDataSet(const DATA_SET * data)
 
 	//Check that number of data points in correct
 		assert(data->n_pts > 0);
-	assert(data->n_unique_pts > 0);
+	//Every site may be trivial, leaving no patterns
+	assert(data->n_unique_pts >= 0);
 	assert(data->n_unique_pts <= data->n_pts);
 	assert(data->compressed == 0 || data->compressed == 1);
 	assert(data->compressed || data->n_unique_pts == data->n_pts);
@@ -82,10 +97,11 @@ CheckIsDataSet(const DATA_SET * data)
 	/*Check that sequence information is valid*/
 	for (int i = 0; i < data->n_sp; i++) {
 		int gapchar = GapChar(data->seq_type);
-		assert(NULL != data->seq[i]);
 		for (int j = 0; j < data->n_unique_pts; j++) {
-			assert((0 <= data->seq[i][j] && data->seq[i][j] < Nbases )
-		       		|| data->seq[i][j] == gapchar);
+			assert((0 <= DATA_SEQ(data, i, j) && DATA_SEQ(data, i, j) < Nbases )
+		       		|| DATA_SEQ(data, i, j) == gapchar
+				|| (IsAmbiguous(DATA_SEQ(data, i, j))
+				    && DATA_SEQ(data, i, j) - AMBIG_FIRST < NumberAmbiguities(data->ambig)));
 		}
 	}
 
@@ -115,7 +131,7 @@ CheckIsSorted_DS(const DATA_SET * data)
 #endif
 
 	for (i = 1; i < data->n_unique_pts; i++) {
-		assert(lexo((const int **) data->seq, i - 1, i, data->n_sp) <= 0);
+		assert(compare_columns(data, i - 1, i) <= 0);
 	}
 }
 
@@ -147,15 +163,15 @@ ConvertNucToCodon(const DATA_SET * data, const int gencode)
         bool odd_gap_in_sequence = false;
 		for (j = 0; j < data_new->n_pts; j++) {
 			ngaps = 0;
-			tmp = data->seq[i][3 * j] * 16;
+			tmp = DATA_SEQ(data, i, 3 * j) * 16;
 			if (tmp == 64)
 				ngaps++;
 			base = tmp;
-			tmp = data->seq[i][3 * j + 1] * 4;
+			tmp = DATA_SEQ(data, i, 3 * j + 1) * 4;
 			if (tmp == 16)
 				ngaps++;
 			base += tmp;
-			tmp = data->seq[i][3 * j + 2];
+			tmp = DATA_SEQ(data, i, 3 * j + 2);
 			if (tmp == 4)
 				ngaps++;
 			base += tmp;
@@ -176,8 +192,8 @@ ConvertNucToCodon(const DATA_SET * data, const int gencode)
 			case 3:
 				base = GapChar(SEQTYPE_CODON);
 			}
-			data_new->seq[i][j] = base;
-			if (-1 == data_new->seq[i][j])
+			DATA_SEQ(data_new, i, j) = base;
+			if (-1 == DATA_SEQ(data_new, i, j))
 				printf("Got -1 on %d\n", base);
 		}
         if ( odd_gap_in_sequence ){fputc('\n',stdout);}
@@ -192,20 +208,48 @@ ConvertNucToCodon(const DATA_SET * data, const int gencode)
 	return data_new;
 }
 
+/*
+ * Ambiguous codon as the set of sense codons compatible with it, in Q
+ * coordinates.
+ */
+static int 
+ambiguity_as_qcoord(const struct ambiguity_table * from,
+		    struct ambiguity_table * to, const int code, const int gencode)
+{
+	const struct ambiguity *amb = Ambiguity(from, code);
+	uint64_t        set = 0;
+
+	for (int k = 0; k < amb->n; k++) {
+		const int       q = CodonToQcoord(amb->base[k], gencode);
+		if (-1 != q)
+			set |= UINT64_C(1) << q;
+	}
+	return AmbiguityCode(to, set, SEQTYPE_CODONQ,
+			     NumberPossibleBases(SEQTYPE_CODONQ, gencode));
+}
+
 DATA_SET *
 ConvertCodonToQcoord(DATA_SET * data)
 {
 	int             seqtype;
+	struct ambiguity_table *qambig = NULL;
 
 	if (NULL==data){return NULL;}
 	CheckIsDataSet(data);
 	assert(data->seq_type == SEQTYPE_CODON);
 
 	seqtype = data->seq_type;
+	if (NULL != data->ambig)
+		qambig = NewAmbiguityTable();
 	for (int i = 0; i < data->n_sp; i++)
-		for (int j = 0 ; j < data->n_unique_pts; j++)
-			data->seq[i][j] =
-				CodonAsQcoord(data->seq[i][j], seqtype, data->gencode);
+		for (int j = 0 ; j < data->n_unique_pts; j++) {
+			const int       c = DATA_SEQ(data, i, j);
+			DATA_SEQ(data, i, j) = IsAmbiguous(c) ?
+				ambiguity_as_qcoord(data->ambig, qambig, c, data->gencode) :
+				CodonAsQcoord(c, seqtype, data->gencode);
+		}
+	FreeAmbiguityTable(data->ambig);
+	data->ambig = qambig;
 	for (int i = 0 ; i < data->n_pts; i++)
 		if (data->index[i] < 0 && data->index[i] != -INT_MAX) {
 			int j = -data->index[i] - 1;
@@ -218,6 +262,68 @@ ConvertCodonToQcoord(DATA_SET * data)
 	return data;
 }
 
+/*
+ * Split each informative codon pattern of Q-coordinate data into three
+ * nucleotide columns, carrying the pattern frequency. Trivial observations
+ * of the codon data are dropped. Returns sorted and compressed data.
+ */
+DATA_SET       *
+ConvertQcoordToNuc(const DATA_SET * data)
+{
+	DATA_SET       *data_new, *tmp;
+	int             i, j, k, codon, cgap, ngap;
+
+	CheckIsDataSet(data);
+	assert(data->seq_type == SEQTYPE_CODONQ);
+
+	data_new = CreateDataSet(3 * data->n_unique_pts, data->n_sp);
+	data_new->seq_type = SEQTYPE_NUCLEO;
+	data_new->n_bases = NumberPossibleBases(SEQTYPE_NUCLEO, data->gencode);
+	data_new->gencode = data->gencode;
+
+	cgap = GapChar(SEQTYPE_CODONQ);
+	ngap = GapChar(SEQTYPE_NUCLEO);
+	for (i = 0; i < data->n_sp; i++) {
+		for (j = 0; j < data->n_unique_pts; j++) {
+			codon = DATA_SEQ(data, i, j);
+			if (IsAmbiguous(codon)) {
+				/* Set of nucleotides found at each position */
+				const struct ambiguity *amb = Ambiguity(data->ambig, codon);
+				if (NULL == data_new->ambig)
+					data_new->ambig = NewAmbiguityTable();
+				for (k = 0; k < 3; k++) {
+					uint64_t        set = 0;
+					for (int l = 0; l < amb->n; l++) {
+						const int       c = QcoordToCodon(amb->base[l], data->gencode);
+						set |= UINT64_C(1) << ((c >> (2 * (2 - k))) & 3);
+					}
+					DATA_SEQ(data_new, i, 3 * j + k) =
+						AmbiguityCode(data_new->ambig, set, SEQTYPE_NUCLEO, 4);
+				}
+				continue;
+			}
+			if (codon != cgap)
+				codon = QcoordToCodon(codon, data->gencode);
+			for (k = 0; k < 3; k++)
+				DATA_SEQ(data_new, i, 3 * j + k) = (codon == cgap) ? ngap :
+					(codon >> (2 * (2 - k))) & 3;
+		}
+		data_new->sp_name[i] = calloc(MAX_SP_NAME + 1, sizeof(char));
+		OOM(data_new->sp_name[i]);
+		strcpy(data_new->sp_name[i], data->sp_name[i]);
+	}
+	for (j = 0; j < data->n_unique_pts; j++)
+		for (k = 0; k < 3; k++)
+			data_new->freq[3 * j + k] = data->freq[j];
+
+	sort_data(data_new);
+	tmp = compress_data(data_new);
+	FreeDataSet(data_new);
+
+	CheckIsDataSet(tmp);
+	return tmp;
+}
+
 
 double         *
 GetBaseFreqs(const DATA_SET * data, const int perspecies)
@@ -236,10 +342,12 @@ GetBaseFreqs(const DATA_SET * data, const int perspecies)
 	freq = calloc(data->n_bases, sizeof(double));
 	OOM(freq);
 
+	/* Ambiguous observations are not counted */
 	for (sp = 0; sp < data->n_sp; sp++) {
 		for (pos = 0; pos < data->n_unique_pts; pos++) {
-			if (data->seq[sp][pos] != gapchar) {
-				freq[data->seq[sp][pos]] += data->freq[pos];
+			if (DATA_SEQ(data, sp, pos) != gapchar
+			    && !IsAmbiguous(DATA_SEQ(data, sp, pos))) {
+				freq[DATA_SEQ(data, sp, pos)] += data->freq[pos];
 				n += data->freq[pos];
 			}
 		}
@@ -293,14 +401,14 @@ CodonBaseFreqs(const DATA_SET * data, const int method,
 
 		for (i = 0; i < data->n_sp; i++)
 			for (j = 0; j < data->n_unique_pts; j++)
-				if (data->seq[i][j] != 64) {
-					b64[data->seq[i][j]] += data->freq[j];
+				if (DATA_SEQ(data, i, j) < 64) {
+					b64[DATA_SEQ(data, i, j)] += data->freq[j];
 					n += data->freq[j];
-					b = (data->seq[i][j] >> 4) & 3;
+					b = (DATA_SEQ(data, i, j) >> 4) & 3;
 					speciesf[i * 13 + b] += data->freq[j];
-					b = (data->seq[i][j] >> 2) & 3;
+					b = (DATA_SEQ(data, i, j) >> 2) & 3;
 					speciesf[i * 13 + b + 4] += data->freq[j];
-					b = (data->seq[i][j]) & 3;
+					b = (DATA_SEQ(data, i, j)) & 3;
 					speciesf[i * 13 + b + 8] += data->freq[j];
 					speciesf[i * 13 + 12] += data->freq[j];
 				}
@@ -320,13 +428,13 @@ CodonBaseFreqs(const DATA_SET * data, const int method,
 	} else {
 		for (i = 0; i < data->n_sp; i++)
 			for (j = 0; j < data->n_unique_pts; j++)
-				if (data->seq[i][j] != 64) {
-					b64[data->seq[i][j]] += data->freq[j];
-					b = (data->seq[i][j] >> 4) & 3;
+				if (DATA_SEQ(data, i, j) < 64) {
+					b64[DATA_SEQ(data, i, j)] += data->freq[j];
+					b = (DATA_SEQ(data, i, j) >> 4) & 3;
 					b3x4[b] += data->freq[j];
-					b = (data->seq[i][j] >> 2) & 3;
+					b = (DATA_SEQ(data, i, j) >> 2) & 3;
 					b3x4[b + 4] += data->freq[j];
-					b = (data->seq[i][j]) & 3;
+					b = (DATA_SEQ(data, i, j)) & 3;
 					b3x4[b + 8] += data->freq[j];
 					n += data->freq[j];
 				}
@@ -468,6 +576,8 @@ CombineDatasets(const DATA_SET * data1, const DATA_SET * data2)
 	data->n_pts = data1->n_pts + data2->n_pts;
 	data->seq_type = data1->seq_type;
 	data->n_bases = data1->n_bases;
+	data->gencode = data1->gencode;
+	data->ambig = ShareAmbiguityTable(data1->ambig);
 	free(data->index);
 	data->index = malloc(data->n_pts * sizeof(int));
 	if (NULL == data->index) {
@@ -476,10 +586,7 @@ CombineDatasets(const DATA_SET * data1, const DATA_SET * data2)
 	}
 	for (species = 0; species < data1->n_sp; species++) {
 		for (site = 0; site < data1->n_unique_pts; site++) {
-			data->seq[species][site] = data1->seq[species][site];
-		}
-		for (site2 = 0; site2 < data2->n_unique_pts; site++, site2++) {
-			data->seq[species][site] = data2->seq[species][site2];
+			DATA_SEQ(data, species, site) = DATA_SEQ(data1, species, site);
 		}
 		data->sp_name[species] =
 			calloc((size_t) (MAX_SP_NAME + 1), sizeof(char));
@@ -487,6 +594,11 @@ CombineDatasets(const DATA_SET * data1, const DATA_SET * data2)
 		sscanf(data1->sp_name[species], "%s", data->sp_name[species]);
 	}
 
+	/* Codes from the second data set are recoded into the table of the first */
+	for (site2 = 0; site2 < data2->n_unique_pts; site2++) {
+		CopySiteByIndex(data2, site2, data, data1->n_unique_pts + site2);
+	}
+
 	for (site = 0; site < data1->n_unique_pts; site++) {
 		data->freq[site] = data1->freq[site];
 	}
@@ -549,8 +661,8 @@ AminoFreqs(const DATA_SET * data, const int perspecies)
 				speciesf[j] = 0.;
 			nongap = 0;
 			for (j = 0; j < data->n_unique_pts; j++)
-				if (0 <= data->seq[i][j] && data->seq[i][j] < 20) {
-					speciesf[data->seq[i][j]] += data->freq[j];
+				if (0 <= DATA_SEQ(data, i, j) && DATA_SEQ(data, i, j) < 20) {
+					speciesf[DATA_SEQ(data, i, j)] += data->freq[j];
 					nongap += data->freq[j];
 				}
 			for (j = 0; j < 20; j++)
@@ -563,8 +675,8 @@ AminoFreqs(const DATA_SET * data, const int perspecies)
 	} else {
 		for (i = 0; i < data->n_sp; i++)
 			for (j = 0; j < data->n_unique_pts; j++)
-				if (0 <= data->seq[i][j] && data->seq[i][j] < 20) {
-					f[data->seq[i][j]] += data->freq[j];
+				if (0 <= DATA_SEQ(data, i, j) && DATA_SEQ(data, i, j) < 20) {
+					f[DATA_SEQ(data, i, j)] += data->freq[j];
 					nongap += data->freq[j];
 				}
 		for (i = 0; i < data->n_pts; i++)
@@ -597,7 +709,7 @@ ExtractSequences(int *seqs, int n_seq, DATA_SET * data)
 	data_new->n_unique_pts = data->n_unique_pts;
 	for (i = 0; i < n_seq; i++) {
 		for (k = 0; k < data->n_unique_pts; k++) {
-			data_new->seq[i][k] = data->seq[seqs[i]][k];
+			DATA_SEQ(data_new, i, k) = DATA_SEQ(data, seqs[i], k);
 			data_new->freq[k] = data->freq[k];
 		}
 		data->sp_name[i] = calloc((size_t) (17), sizeof(char));
@@ -606,6 +718,7 @@ ExtractSequences(int *seqs, int n_seq, DATA_SET * data)
 	data_new->seq_type = data->seq_type;
 	data_new->n_bases = data->n_bases;
 	data_new->compressed = data->compressed;
+	data_new->ambig = ShareAmbiguityTable(data->ambig);
 
 	CheckIsDataSet(data_new);
 	return data_new;
@@ -627,14 +740,16 @@ CreateDataSet(const int n_size, const int n_sp)
 
 	data->seq_type = -1;
 	data->n_bases = -1;
+	data->ambig = NULL;
 
-	data->seq = calloc(n_sp, sizeof(int *));
+	data->stride = ((n_sp + DATA_ALIGN - 1) / DATA_ALIGN) * DATA_ALIGN;
+	if (0 != posix_memalign((void **) &data->seq, DATA_ALIGN, (size_t) n_size * data->stride))
+		data->seq = NULL;
+	OOM(data->seq);
+	memset(data->seq, 0, (size_t) n_size * data->stride);
 	data->sp_name = calloc(n_sp, sizeof(char *));
-	for (a = 0; a < n_sp; a++) {
+	for (a = 0; a < n_sp; a++)
 		data->sp_name[a] = NULL;
-		data->seq[a] = calloc((size_t) n_size, sizeof(int));
-		OOM(data->seq[a]);
-	}
 
 	data->freq = calloc((size_t) n_size, sizeof(double));
 	OOM(data->freq);
@@ -649,13 +764,31 @@ CreateDataSet(const int n_size, const int n_sp)
 	return data;
 }
 
+/*
+ * Context for qsort, which takes no argument for the comparison function.
+ */
+static const DATA_SET *sort_context;
+
+static int 
+compare_sort_columns(const void *a, const void *b)
+{
+	const int       i = *(const int *) a, j = *(const int *) b;
+	const int       c = compare_columns(sort_context, i, j);
+
+	return (0 != c) ? c : (i > j) - (i < j);
+}
+
+/*
+ * Sort the unique patterns into lexicographic order, keeping the index of
+ * each site and the frequency of each pattern with it.
+ */
 DATA_SET *
 sort_data(DATA_SET * data)
 {
-	int             n_pts, l, ir, a, i, j;
-	double          tmp = 1.0;
-	int            *seq1;
-	int            **seq;
+	int             n_pts, a;
+	int            *order, *map;
+	uint8_t        *seq;
+	double         *freq;
 
 	if (NULL==data){return NULL;}
 	CheckIsDataSet(data);
@@ -663,71 +796,34 @@ sort_data(DATA_SET * data)
 	n_pts = data->n_unique_pts;
 	if (n_pts < 2)
 		return data;
-	seq = calloc((size_t)data->n_sp,sizeof(int *));
-	seq1 = calloc((size_t) data->n_sp, sizeof(int));
-	OOM(seq1);
-	for (a = 0; a < data->n_sp; a++)
-		seq[a] = data->seq[a];
-
-	l = ((n_pts) >> 1);
-	ir = n_pts - 1;
-
-	for (;;) {
-		if (l > 0) {
-			l--;
-			for (a = 0; a < data->n_sp; a++)
-				seq1[a] = seq[a][l];
-			tmp = data->freq[l];
-			UpdateIndex(data, l, -1);
-		} else {
-			for (a = 0; a < data->n_sp; a++)
-				seq1[a] = seq[a][ir];
-			tmp = data->freq[ir];
-			UpdateIndex(data, ir, -1);
-			for (a = 0; a < data->n_sp; a++)
-				seq[a][ir] = seq[a][0];
-			data->freq[ir] = data->freq[0];
-			UpdateIndex(data, 0, ir);
-			if (--ir == 0) {
-				for (a = 0; a < data->n_sp; a++)
-					seq[a][0] = seq1[a];
-				data->freq[0] = tmp;
-				UpdateIndex(data, -1, 0);
-				break;
-			}
-		}
 
-		i = l;
-		j = l + l + 1;
-		while (j <= ir) {
-			if (j < ir && lexo((const int **) seq, j, j + 1, data->n_sp) < 0)
-				j++;
-
-			if (lexo2((const int *) seq1, (const int **) seq, j, data->n_sp) < 0) {
-				for (a = 0; a < data->n_sp; a++)
-					seq[a][i] = seq[a][j];
-				data->freq[i] = data->freq[j];
-				UpdateIndex(data, j, i);
-				i = j;
-				j++;
-				j <<= 1;
-				j--;
-			} else
-				break;
-		}
-		for (a = 0; a < data->n_sp; a++)
-			seq[a][i] = seq1[a];
-		data->freq[i] = tmp;
-		UpdateIndex(data, -1, i);
-	}
-
-	for (a = 1; a < data->n_unique_pts; a++) {
-		assert(lexo((const int **) seq, a - 1, a, data->n_sp) <= 0);
+	order = malloc(n_pts * sizeof(int));
+	map = malloc(n_pts * sizeof(int));
+	freq = malloc(n_pts * sizeof(double));
+	OOM(order);
+	OOM(map);
+	OOM(freq);
+	for (a = 0; a < n_pts; a++)
+		order[a] = a;
+	sort_context = data;
+	qsort(order, n_pts, sizeof(int), compare_sort_columns);
+	sort_context = NULL;
+
+	if (0 != posix_memalign((void **) &seq, DATA_ALIGN, (size_t) n_pts * data->stride))
+		seq = NULL;
+	OOM(seq);
+	for (a = 0; a < n_pts; a++) {
+		memcpy(seq + (size_t) a * data->stride, DATA_COLUMN(data, order[a]), data->stride);
+		freq[a] = data->freq[order[a]];
+		map[order[a]] = a;
 	}
-	for (a = 0; a < data->n_pts; a++)
-		assert(data->index[a] < data->n_unique_pts);
-	free(seq1);
-	free(seq);
+	free(data->seq);
+	free(data->freq);
+	data->seq = seq;
+	data->freq = freq;
+	RemapIndex(data, map);
+	free(map);
+	free(order);
 
 	CheckIsDataSet(data);
 	CheckIsSorted_DS(data);
@@ -735,48 +831,34 @@ sort_data(DATA_SET * data)
 }
 
 static int 
-lexo(const int **seq, const int i, const int j, const int n)
+compare_columns(const DATA_SET * data, const int i, const int j)
 {
-	int             a = 0;
-
-	while (a < n && seq[a][i] == seq[a][j])
-		a++;
-
-	if (a == n)
-		return 0;
-	else if (seq[a][i] < seq[a][j])
-		return -1;
-	else if (seq[a][i] > seq[a][j])
-		return 1;
-
-	abort();
+	return memcmp(DATA_COLUMN(data, i), DATA_COLUMN(data, j), data->n_sp);
 }
 
-
-static int 
-lexo2(const int *seq1, const int **seq, const int i, const int n)
+/*
+ * Replace the index of each site that refers to pattern i with map[i]. Sites
+ * with trivial observations are left alone.
+ */
+static void 
+RemapIndex(DATA_SET * data, const int *map)
 {
-	int             a = 0;
-
-	while (a < n && seq1[a] == seq[a][i])
-		a++;
+	int             i;
 
-	if (a == n)
-		return 0;
-	else if (seq1[a] < seq[a][i])
-		return -1;
-	else if (seq1[a] > seq[a][i])
-		return 1;
+	assert(NULL != data);
+	assert(NULL != map);
 
-	abort();
+	for (i = 0; i < data->n_pts; i++)
+		if (data->index[i] >= 0)
+			data->index[i] = map[data->index[i]];
 }
 
 
 DATA_SET       *
 compress_data(const DATA_SET * data)
 {
-	int             a, b, total = 1;
-	int             n_pts;
+	int             a, total = 1;
+	int             n_pts, *map;
 	DATA_SET       *new;
 
 	CheckIsDataSet(data);
@@ -788,8 +870,8 @@ compress_data(const DATA_SET * data)
 
 	n_pts = data->n_unique_pts;
 	for (a = 1; a < n_pts; a++) {
-		assert(lexo((const int **) data->seq, a - 1, a, data->n_sp) <= 0);
-		if (lexo((const int **) data->seq, a - 1, a, data->n_sp) != 0)
+		assert(compare_columns(data, a - 1, a) <= 0);
+		if (compare_columns(data, a - 1, a) != 0)
 			total++;
 	}
 
@@ -801,6 +883,7 @@ compress_data(const DATA_SET * data)
 	new->n_sp = data->n_sp;
 	new->n_bases = data->n_bases;
 	new->gencode = data->gencode;
+	new->ambig = ShareAmbiguityTable(data->ambig);
 	for (a = 0; a < data->n_sp; a++) {
 		if (data->sp_name[a] != NULL) {
 			new->sp_name[a] = calloc(MAX_SP_NAME + 1, sizeof(int));
@@ -815,21 +898,24 @@ compress_data(const DATA_SET * data)
 	for (a = 0; a < data->n_pts; a++)
 		new->index[a] = data->index[a];
 
-	for (a = 0; a < data->n_sp; a++)
-		new->seq[a][0] = data->seq[a][0];
+	map = malloc(n_pts * sizeof(int));
+	OOM(map);
+	memcpy(DATA_COLUMN(new, 0), DATA_COLUMN(data, 0), data->stride);
 	new->freq[0] = data->freq[0];
+	map[0] = 0;
 	total = 0;
-	for (a = 1; a < n_pts; a++)
-		if (lexo((const int **) data->seq, a - 1, a, data->n_sp) != 0) {
+	for (a = 1; a < n_pts; a++) {
+		if (compare_columns(data, a - 1, a) != 0) {
 			total++;
-			for (b = 0; b < data->n_sp; b++)
-				new->seq[b][total] = data->seq[b][a];
-			UpdateIndex(new, a, total);
+			memcpy(DATA_COLUMN(new, total), DATA_COLUMN(data, a), data->stride);
 			new->freq[total] = data->freq[a];
 		} else {
 			new->freq[total] += data->freq[a];
-			UpdateIndex(new, a, total);
 		}
+		map[a] = total;
+	}
+	RemapIndex(new, map);
+	free(map);
 
 	new->compressed = 1;
 
@@ -837,23 +923,11 @@ compress_data(const DATA_SET * data)
 	return new;
 }
 
-static void 
-UpdateIndex(DATA_SET * data, const int a, const int b)
-{
-	int             i;
-
-	assert(NULL != data);
-
-	for (i = 0; i < data->n_pts; i++)
-		if (data->index[i] == a)
-			data->index[i] = b;
-}
-
 DATA_SET       *
 RemoveTrivialObs(const DATA_SET * data)
 {
 	int             total = 0;
-	int             gapchar, n_upts;
+	int             gapchar, n_upts, *map;
 	int             a, b, i;
 	DATA_SET       *new;
 
@@ -861,7 +935,7 @@ RemoveTrivialObs(const DATA_SET * data)
 
 	n_upts = data->n_unique_pts;
 	for (i = 0; i < n_upts; i++)
-		if (NumNongaps(data, i) >= 2)
+		if (NumNongaps(data, i) >= 2 || HasAmbiguity(data, i))
 			total++;
 
 	new = CreateDataSet(total, data->n_sp);
@@ -876,6 +950,7 @@ RemoveTrivialObs(const DATA_SET * data)
 	new->n_bases = data->n_bases;
 	new->compressed = data->compressed;
 	new->gencode = data->gencode;
+	new->ambig = ShareAmbiguityTable(data->ambig);
 	for (a = 0; a < data->n_sp; a++) {
 		if (data->sp_name[a] != NULL) {
 			new->sp_name[a] = calloc(MAX_SP_NAME + 1, sizeof(int));
@@ -885,32 +960,39 @@ RemoveTrivialObs(const DATA_SET * data)
 	}
 
 
+	map = malloc(n_upts * sizeof(int));
+	OOM(map);
 	total = 0;
 	gapchar = GapChar(data->seq_type);
 	for (a = 0; a < n_upts; a++)
 		switch (NumNongaps(data, a)) {
 		case 0:
-			UpdateIndex(new, a, -INT_MAX);
+			map[a] = -INT_MAX;
 			break;
 		case 1:{
 				int             singlechar = gapchar;
 				for (b = 0; b < data->n_sp; b++)
-					if (data->seq[b][a] != gapchar)
-						singlechar = data->seq[b][a];
+					if (DATA_SEQ(data, b, a) != gapchar)
+						singlechar = DATA_SEQ(data, b, a);
 				if (singlechar == gapchar) {
 					printf("Something fishy -- all gaps\n");
 					exit(EXIT_FAILURE);
 				}
-				UpdateIndex(new, a, -(singlechar + 1));
-				break;
+				if (!IsAmbiguous(singlechar)) {
+					map[a] = -(singlechar + 1);
+					break;
+				}
+				/* A single ambiguous observation is kept as a pattern */
 			}
 		default:
 			CopySiteByIndex(data, a, new, total);
 			new->freq[total] = data->freq[a];
-			UpdateIndex(new, a, total);
+			map[a] = total;
 			total++;
 			break;
 		}
+	RemapIndex(new, map);
+	free(map);
 
 	CheckIsDataSet(new);
 	return new;
@@ -920,7 +1002,6 @@ RemoveTrivialObs(const DATA_SET * data)
 void 
 CopySiteByIndex(const DATA_SET * old, const int old_idx, DATA_SET * new, const int new_idx)
 {
-	int             i;
 	CheckIsDataSet(old);
 	assert(old->n_sp == new->n_sp);
 	assert(old_idx >= 0 && old_idx < old->n_unique_pts);
@@ -933,10 +1014,21 @@ CopySiteByIndex(const DATA_SET * old, const int old_idx, DATA_SET * new, const i
 		 */
 		assert(old->gencode == new->gencode);
 	}
-	for (i = 0; i < old->n_sp; i++) {
-		new->seq[i][new_idx] = old->seq[i][old_idx];
-	}
+	memcpy(DATA_COLUMN(new, new_idx), DATA_COLUMN(old, old_idx), old->n_sp);
 	new->freq[new_idx] = 1.;
+	if (old->ambig == new->ambig)
+		return;
+	/* Ambiguous observations are recoded into the table of the new data */
+	for (int sp = 0; sp < new->n_sp; sp++) {
+		const int       c = DATA_SEQ(new, sp, new_idx);
+		if (IsAmbiguous(c)) {
+			const struct ambiguity *amb = Ambiguity(old->ambig, c);
+			if (NULL == new->ambig)
+				new->ambig = NewAmbiguityTable();
+			DATA_SEQ(new, sp, new_idx) =
+				AmbiguityCode(new->ambig, amb->set, amb->seqtype, new->n_bases);
+		}
+	}
 }
 
 void 
@@ -967,12 +1059,26 @@ NumNongaps(const DATA_SET * data, const int site)
 	gapchar = GapChar(data->seq_type);
 	Nchar = 0;
 	for (i = 0; i < data->n_sp; i++)
-		if (data->seq[i][site] < gapchar)
+		if (DATA_SEQ(data, i, site) != gapchar)
 			Nchar++;
 
 	return (Nchar);
 }
 
+/* Does the pattern at site contain an ambiguous observation? */
+int 
+HasAmbiguity(const DATA_SET * data, const int site)
+{
+	assert(NULL != data);
+	assert(site >= 0 && site < data->n_unique_pts);
+
+	for (int i = 0; i < data->n_sp; i++)
+		if (IsAmbiguous(DATA_SEQ(data, i, site)))
+			return 1;
+
+	return 0;
+}
+
 
 
 void 
@@ -985,13 +1091,13 @@ FreeDataSet(DATA_SET * data)
 	for (a = 0; a < data->n_sp; a++) {
 		if (data->sp_name[a] != NULL)
 			free(data->sp_name[a]);
-		free(data->seq[a]);
 	}
 
 	free(data->seq);
 	free(data->sp_name);
 	free(data->freq);
 	free(data->index);
+	FreeAmbiguityTable(data->ambig);
 	free(data);
 }
 
@@ -1020,7 +1126,7 @@ PrintData(const DATA_SET * data)
 	}
 	for (a = 0; a < data->n_sp; a++) {
 		for (b = 0; b < data->n_unique_pts; b++)
-			printf("%c", (*printfun) (data->seq[a][b]));
+			printf("%c", (*printfun) (DATA_SEQ(data, a, b)));
 		printf("\n");
 	}
 }
@@ -1033,7 +1139,7 @@ PrintSite(const DATA_SET * data, const int i)
 	CheckIsDataSet(data);
 
 	for (j = 0; j < data->n_sp; j++)
-		printf("%2.2d ", data->seq[j][i]);
+		printf("%2.2d ", DATA_SEQ(data, j, i));
 	printf("\n");
 }
 
@@ -1057,12 +1163,14 @@ CopyDataSet(const DATA_SET * data)
 	data_new->n_bases = data->n_bases;
 	data_new->compressed = data->compressed;
 	data_new->n_sp = data->n_sp;
+	data_new->gencode = data->gencode;
+	data_new->ambig = ShareAmbiguityTable(data->ambig);
 	for (i = 0; i < data->n_sp; i++) {
 		data_new->sp_name[i] =
 			malloc((1 + strlen(data->sp_name[i])) * sizeof(char));
 		strcpy(data_new->sp_name[i], data->sp_name[i]);
 		for (j = 0; j < data->n_unique_pts; j++)
-			data_new->seq[i][j] = data->seq[i][j];
+			DATA_SEQ(data_new, i, j) = DATA_SEQ(data, i, j);
 	}
 	for (i = 0; i < data->n_unique_pts; i++)
 		data_new->freq[i] = data->freq[i];
@@ -1093,6 +1201,10 @@ CopySiteToDataSet(const DATA_SET * data, DATA_SET * data_single,
 	data_single->n_unique_pts = 1;
 	data_single->n_bases = data->n_bases;
 	data_single->compressed = 0;
+	if (data_single->ambig != data->ambig) {
+		FreeAmbiguityTable(data_single->ambig);
+		data_single->ambig = ShareAmbiguityTable(data->ambig);
+	}
 
 	CopySite(data, site, data_single, 0);
 	data_single->index[0] = 0;
@@ -1116,7 +1228,7 @@ CountGapsAtSite(const DATA_SET * data, const int i)
 		return (data->n_sp - 1);
 	gapchar = GapChar(data->seq_type);
 	for (a = 0; a < data->n_sp; a++)
-		if (data->seq[a][idx] == gapchar)
+		if (DATA_SEQ(data, a, idx) == gapchar)
 			gaps++;
 
 	return gaps;
@@ -1136,10 +1248,12 @@ IsSiteSynonymous(const DATA_SET * data, const int i, const int gencode)
 	if (idx < 0)
 		//Case of all gaps or single character
 			return 1;
+	if (HasAmbiguity(data, idx))
+		return 0;
 
 	/* Find first non-gap character. */
 	last = 0;
-	while (last < data->n_sp && data->seq[last][idx] == gapchar) {
+	while (last < data->n_sp && DATA_SEQ(data, last, idx) == gapchar) {
 		last++;
 	}
 	/* Case there are no sites, or on last site */
@@ -1147,9 +1261,9 @@ IsSiteSynonymous(const DATA_SET * data, const int i, const int gencode)
 		return 1;
 	/* Check against rest of sequence */
 	for (a = last + 1; a < data->n_sp; a++) {
-		if (data->seq[a][idx] != gapchar
-		    && IsNonSynonymous(QcoordToCodon(data->seq[last][idx], gencode),
-				  QcoordToCodon(data->seq[a][idx], gencode),
+		if (DATA_SEQ(data, a, idx) != gapchar
+		    && IsNonSynonymous(QcoordToCodon(DATA_SEQ(data, last, idx), gencode),
+				  QcoordToCodon(DATA_SEQ(data, a, idx), gencode),
 				       gencode)) {
 			return 0;
 		}
@@ -1177,9 +1291,17 @@ SiteEntropy(const DATA_SET * data, const int site, const double *pi)
 			return (-log(pi[-siteidx - 1]));
 
 	gapchar = GapChar(data->seq_type);
-	for (i = 0; i < data->n_sp; i++)
-		if (data->seq[i][siteidx] != gapchar)
-			e -= log(pi[data->seq[i][siteidx]]);
+	for (i = 0; i < data->n_sp; i++) {
+		const int       c = DATA_SEQ(data, i, siteidx);
+		if (IsAmbiguous(c)) {
+			const struct ambiguity *amb = Ambiguity(data->ambig, c);
+			double          p = 0.;
+			for (int k = 0; k < amb->n; k++)
+				p += pi[amb->base[k]];
+			e -= log(p);
+		} else if (c != gapchar)
+			e -= log(pi[c]);
+	}
 
 	return e;
 }
@@ -1198,17 +1320,19 @@ IsConserved(const DATA_SET * data, const int i)
 	if (idx < 0)
 		//Case of all gaps or single character
 			return 1;
+	if (HasAmbiguity(data, idx))
+		return 0;
 
 	last = 0;
-	while (last < data->n_sp && data->seq[last][idx] == gapchar) {
+	while (last < data->n_sp && DATA_SEQ(data, last, idx) == gapchar) {
 		last++;
 	}
 
 	if (last >= data->n_sp)
 		return 1;
 	for (a = last; a < data->n_sp; a++)
-		if (data->seq[a][idx] != gapchar
-		    && data->seq[a][idx] != data->seq[last][idx])
+		if (DATA_SEQ(data, a, idx) != gapchar
+		    && DATA_SEQ(data, a, idx) != DATA_SEQ(data, last, idx))
 			return 0;
 
 	return 1;
@@ -1234,6 +1358,8 @@ SelectFromData(const DATA_SET * data, const int *idx, const int n)
 	data_new->seq_type = data->seq_type;
 	data_new->n_pts = data->n_pts;
 	data_new->n_bases = data->n_bases;
+	data_new->gencode = data->gencode;
+	data_new->ambig = ShareAmbiguityTable(data->ambig);
 
 	//Frequencies of observation same as original site
 		// (at least for the moment.Could compress further.)
@@ -1251,7 +1377,7 @@ SelectFromData(const DATA_SET * data, const int *idx, const int n)
 		for (new_sp = 0; new_sp < n; new_sp++) {
 		sp = idx[new_sp];
 		for (site = 0; site < data->n_unique_pts; site++) {
-			data_new->seq[new_sp][site] = data->seq[sp][site];
+			DATA_SEQ(data_new, new_sp, site) = DATA_SEQ(data, sp, site);
 		}
 	}
 
@@ -1269,6 +1395,73 @@ SelectFromData(const DATA_SET * data, const int *idx, const int n)
 	return data_new;
 }
 
+/*
+ * Select unique site patterns from a compressed data set. Patterns for which
+ * keep is zero are removed and the sites that had them are marked as all gaps,
+ * so the new data set still describes every site of the original. Trivial
+ * sites (single characters) are left as they are.
+ */
+DATA_SET       *
+SelectPatternsFromData(const DATA_SET * data, const int *keep)
+{
+	int             site, pt, total;
+	int            *newidx;
+	DATA_SET       *data_new;
+
+	CheckIsDataSet(data);
+	assert(NULL != keep);
+
+	total = 0;
+	for (pt = 0; pt < data->n_unique_pts; pt++) {
+		if (keep[pt]) {
+			total++;
+		}
+	}
+	if (0 == total) {
+		return NULL;
+	}
+
+	data_new = CreateDataSet(total, data->n_sp);
+	data_new->seq_type = data->seq_type;
+	data_new->n_bases = data->n_bases;
+	data_new->gencode = data->gencode;
+	data_new->compressed = 1;
+	data_new->ambig = ShareAmbiguityTable(data->ambig);
+	for (int sp = 0; sp < data->n_sp; sp++) {
+		if (data->sp_name[sp] != NULL) {
+			data_new->sp_name[sp] =
+				malloc((1 + strlen(data->sp_name[sp])) * sizeof(char));
+			OOM(data_new->sp_name[sp]);
+			strcpy(data_new->sp_name[sp], data->sp_name[sp]);
+		}
+	}
+
+	newidx = malloc(data->n_unique_pts * sizeof(int));
+	OOM(newidx);
+	total = 0;
+	for (pt = 0; pt < data->n_unique_pts; pt++) {
+		newidx[pt] = -INT_MAX;
+		if (keep[pt]) {
+			CopySiteByIndex(data, pt, data_new, total);
+			data_new->freq[total] = data->freq[pt];
+			newidx[pt] = total++;
+		}
+	}
+
+	free(data_new->index);
+	data_new->n_pts = data->n_pts;
+	data_new->index = malloc(data->n_pts * sizeof(int));
+	OOM(data_new->index);
+	for (site = 0; site < data->n_pts; site++) {
+		data_new->index[site] = (data->index[site] >= 0) ?
+			newidx[data->index[site]] : data->index[site];
+	}
+	free(newidx);
+
+	CheckIsDataSet(data_new);
+	return data_new;
+}
+
 /*
  * Reads sequence data out of file. Returns struct containing data, else
  * returns NULL is io error
@@ -1279,7 +1472,7 @@ read_data(const char *filename, const int seqtype)
 	FILE           *fp;
 	int             i, j;
 	int n_sp, n_pts;
-	int ret;
+	int ret, *seq;
 
 	/* Attempt to open data file */
 	fp = fopen(filename, "r");
@@ -1317,17 +1510,18 @@ read_data(const char *filename, const int seqtype)
 		    exit(EXIT_FAILURE);
 		}
 		if (data->seq_type == SEQTYPE_NUCLEO)
-			data->seq[i] = ReadNucleo(fp, data->n_pts, data->sp_name[i]);
-		else if (data->seq_type == SEQTYPE_AMINO)
-			data->seq[i] = ReadAmino (fp, data->n_pts, data->sp_name[i]);
+			seq = ReadNucleo(fp, data->n_pts, data->sp_name[i]);
+		else
+			seq = ReadAmino (fp, data->n_pts, data->sp_name[i]);
 
-		if (data->seq[i] == NULL) {
+		if (seq == NULL) {
 			printf("Problems reading data, aborting\n");
-			for (j = 0; j < i; j++)
-				free(data->seq[j]);
-			free(data);
+			FreeDataSet(data);
 			return NULL;
 		}
+		for (j = 0; j < data->n_pts; j++)
+			DATA_SEQ(data, i, j) = seq[j];
+		free(seq);
 	}
 	data->freq = calloc((size_t) data->n_pts, sizeof(double));
 	OOM(data->freq);
@@ -1344,6 +1538,804 @@ read_data(const char *filename, const int seqtype)
 	return data;
 }
 
+/*
+ * State of one sequence while reading an alignment directly into codons.
+ * Unrecognised characters are remembered rather than reported, so warnings
+ * are only printed once the layout of the file has been found. When the
+ * alignment is streamed, seq holds only the codons not yet taken.
+ */
+struct codon_reader {
+	char            name[MAX_SP_NAME + 1];
+	int            *seq;
+	int             len, max;	/* Nucleotides read, codons allocated */
+	int             done;	/* Codons already taken from seq */
+	int             codon, ngap;
+	int             nbad;
+	int            *badpos;
+	char           *badc;
+	const char     *p;	/* Position in sequential or FASTA sequence */
+	bool            count;	/* Only count nucleotides, storing no codons */
+	bool            ambiguity;	/* Keep IUPAC codes as sets of codons */
+	int             nset[3], namb;	/* Nucleotide sets of codon so far */
+};
+
+struct aln_parser {
+	const char     *p, *end;
+	int             n_sp, n_pts;	/* n_pts in nucleotides */
+	struct codon_reader *sp;
+	const char     *start;	/* First line after PHYLIP header */
+	bool            interleaved;
+	int             line;	/* Lines of interleaved alignment read */
+	bool            count;
+	bool            ambiguity;
+};
+
+static bool 
+IsSeqChar(const char c)
+{
+	return isalpha((unsigned char) c) || '-' == c;
+}
+
+static void 
+skip_space(struct aln_parser * ap)
+{
+	while (ap->p < ap->end && isspace((unsigned char) *ap->p))
+		ap->p++;
+}
+
+static bool 
+read_int(struct aln_parser * ap, int *val)
+{
+	skip_space(ap);
+	if (ap->p == ap->end || !isdigit((unsigned char) *ap->p))
+		return false;
+	*val = 0;
+	while (ap->p < ap->end && isdigit((unsigned char) *ap->p))
+		*val = 10 * *val + (*ap->p++ - '0');
+	return true;
+}
+
+/* Whitespace delimited name, truncated to MAX_SP_NAME characters */
+static bool 
+read_name(struct aln_parser * ap, char *name)
+{
+	int             n = 0;
+
+	skip_space(ap);
+	if (ap->p == ap->end)
+		return false;
+	while (ap->p < ap->end && !isspace((unsigned char) *ap->p)) {
+		if (n < MAX_SP_NAME)
+			name[n++] = *ap->p;
+		ap->p++;
+	}
+	name[n] = '\0';
+	return true;
+}
+
+static void 
+add_nucleotide(struct codon_reader * r, const char c)
+{
+	int             nuc, nset = 0;
+
+	nuc = ToNucleo(c);
+	if (-1 == nuc && r->ambiguity)
+		nset = NucleoSet(c);
+	if (-1 == nuc && 0 == nset) {
+		if (0 == r->nbad % 16) {
+			r->badpos = realloc(r->badpos, (r->nbad + 16) * sizeof(int));
+			r->badc = realloc(r->badc, (r->nbad + 16) * sizeof(char));
+			OOM(r->badpos);
+			OOM(r->badc);
+		}
+		r->badpos[r->nbad] = r->len;
+		r->badc[r->nbad] = c;
+		r->nbad++;
+		nuc = GapChar(SEQTYPE_NUCLEO);
+	}
+	if (0 != nset)
+		r->namb++;
+	else if (GapChar(SEQTYPE_NUCLEO) == nuc)
+		r->ngap++;
+	else {
+		r->codon = 4 * r->codon + nuc;
+		nset = 1 << nuc;
+	}
+	r->nset[r->len % 3] = nset;
+
+	if (2 == r->len % 3 && !r->count) {
+		const int       i = r->len / 3 - r->done;
+		if (i >= r->max) {
+			r->max = 2 * r->max + 64;
+			r->seq = realloc(r->seq, r->max * sizeof(int));
+			OOM(r->seq);
+		}
+		if (0 == r->ngap && 0 == r->namb)
+			r->seq[i] = r->codon;
+		else if (0 == r->ngap)
+			r->seq[i] = READ_AMBIG | r->nset[0] << 8 | r->nset[1] << 4 | r->nset[2];
+		else if (3 == r->ngap)
+			r->seq[i] = GapChar(SEQTYPE_CODON);
+		else
+			r->seq[i] = ODD_GAP;
+	}
+	if (2 == r->len % 3) {
+		r->codon = 0;
+		r->ngap = 0;
+		r->namb = 0;
+	}
+	r->len++;
+}
+
+static void 
+reset_readers(struct aln_parser * ap, const char *start)
+{
+	ap->p = start;
+	for (int i = 0; i < ap->n_sp; i++) {
+		ap->sp[i].len = 0;
+		ap->sp[i].done = 0;
+		ap->sp[i].codon = 0;
+		ap->sp[i].ngap = 0;
+		ap->sp[i].namb = 0;
+		ap->sp[i].nbad = 0;
+	}
+}
+
+/* PAML or sequential PHYLIP: each name followed by the whole sequence */
+static bool 
+parse_sequential(struct aln_parser * ap)
+{
+	for (int i = 0; i < ap->n_sp; i++) {
+		struct codon_reader *r = ap->sp + i;
+		if (!read_name(ap, r->name))
+			return false;
+		r->p = ap->p;
+		while (r->len < ap->n_pts && ap->p < ap->end) {
+			const char      c = *ap->p++;
+			if (IsSeqChar(c))
+				add_nucleotide(r, c);
+		}
+		if (r->len < ap->n_pts)
+			return false;
+	}
+	return true;
+}
+
+/*
+ * Next line of an interleaved alignment, the first line of the file being
+ * the one at ap->start. Returns false if a sequence is too long.
+ */
+static bool 
+read_interleaved_line(struct aln_parser * ap)
+{
+	struct codon_reader *r = ap->sp + ap->line % ap->n_sp;
+
+	if (ap->line < ap->n_sp && !read_name(ap, r->name))
+		return false;
+	ap->line++;
+	while (ap->p < ap->end && '\n' != *ap->p) {
+		const char      c = *ap->p++;
+		if (IsSeqChar(c)) {
+			if (r->len == ap->n_pts)
+				return false;
+			add_nucleotide(r, c);
+		}
+	}
+	return true;
+}
+
+/*
+ * Interleaved PHYLIP: a first block of lines giving each name and the start
+ * of its sequence, then blocks of lines continuing the sequences in turn.
+ */
+static bool 
+parse_interleaved(struct aln_parser * ap)
+{
+	for (ap->line = 0;;) {
+		skip_space(ap);
+		if (ap->p == ap->end)
+			break;
+		if (!read_interleaved_line(ap))
+			return false;
+	}
+	if (0 != ap->line % ap->n_sp)
+		return false;
+	for (int i = 0; i < ap->n_sp; i++)
+		if (ap->sp[i].len != ap->n_pts)
+			return false;
+	return true;
+}
+
+/* FASTA: sequences of equal length, each after a line starting with '>' */
+static bool 
+parse_fasta(struct aln_parser * ap)
+{
+	for (skip_space(ap); ap->p < ap->end; skip_space(ap)) {
+		if ('>' != *ap->p)
+			return false;
+		ap->p++;
+		ap->sp = realloc(ap->sp, (ap->n_sp + 1) * sizeof(struct codon_reader));
+		OOM(ap->sp);
+		struct codon_reader *r = ap->sp + ap->n_sp++;
+		memset(r, 0, sizeof(struct codon_reader));
+		r->count = ap->count;
+		r->ambiguity = ap->ambiguity;
+		if (!read_name(ap, r->name))
+			return false;
+		while (ap->p < ap->end && '\n' != *ap->p)
+			ap->p++;
+		r->p = ap->p;
+		for (skip_space(ap); ap->p < ap->end && '>' != *ap->p; skip_space(ap)) {
+			while (ap->p < ap->end && '\n' != *ap->p) {
+				const char      c = *ap->p++;
+				if (IsSeqChar(c))
+					add_nucleotide(r, c);
+			}
+		}
+	}
+	if (0 == ap->n_sp)
+		return false;
+	ap->n_pts = ap->sp[0].len;
+	for (int i = 1; i < ap->n_sp; i++)
+		if (ap->sp[i].len != ap->n_pts) {
+			printf("Sequence %s has %d nucleotides but %s has %d\n",
+			       ap->sp[i].name, ap->sp[i].len, ap->sp[0].name, ap->n_pts);
+			return false;
+		}
+	return true;
+}
+
+/*
+ * Find the layout of an alignment mapped between ap->p and ap->end, and parse
+ * it. Returns the name of the layout, or NULL if there is too little data to
+ * be worth reporting, and sets ok if the alignment was read.
+ */
+static const char *
+parse_alignment(struct aln_parser * ap, const char *filename, bool * ok)
+{
+	skip_space(ap);
+	if (ap->p < ap->end && '>' == *ap->p) {
+		*ok = parse_fasta(ap);
+		return "FASTA";
+	}
+
+	if (!read_int(ap, &ap->n_sp) || !read_int(ap, &ap->n_pts)) {
+		printf("Data file \"%s\" must start with number of species and number of codons\n", filename);
+		exit(EXIT_FAILURE);
+	}
+	if (ap->n_sp <= 0 || ap->n_pts <= 0) {
+		printf("Suspiciously little data, can't do much with %d points!\n", ap->n_pts);
+		*ok = false;
+		return NULL;
+	}
+	for (; ap->p < ap->end && '\n' != *ap->p; ap->p++)
+		if ('I' == toupper((unsigned char) *ap->p))
+			ap->interleaved = true;
+	ap->sp = calloc(ap->n_sp, sizeof(struct codon_reader));
+	OOM(ap->sp);
+	for (int i = 0; i < ap->n_sp; i++) {
+		ap->sp[i].count = ap->count;
+		ap->sp[i].ambiguity = ap->ambiguity;
+	}
+	ap->start = ap->p;
+
+	*ok = false;
+	if (!ap->interleaved) {
+		*ok = parse_sequential(ap);
+		skip_space(ap);
+		ap->interleaved = !*ok || ap->p != ap->end;
+	}
+	if (ap->interleaved) {
+		/*
+		 * Text after a complete sequential alignment was always ignored,
+		 * so fall back to that if not interleaved.
+		 */
+		const bool      sequential_ok = *ok;
+		reset_readers(ap, ap->start);
+		*ok = parse_interleaved(ap);
+		if (!*ok && sequential_ok) {
+			reset_readers(ap, ap->start);
+			*ok = parse_sequential(ap);
+			ap->interleaved = false;
+		}
+	}
+	return ap->interleaved ? "interleaved" : "sequential";
+}
+
+static void 
+free_readers(struct aln_parser * ap)
+{
+	for (int i = 0; i < ap->n_sp; i++) {
+		free(ap->sp[i].seq);
+		free(ap->sp[i].badpos);
+		free(ap->sp[i].badc);
+	}
+	free(ap->sp);
+	ap->sp = NULL;
+}
+
+/*
+ * Map an alignment file into memory, setting ap to its extent. Returns the
+ * start of the mapping, or NULL on failure.
+ */
+static const char *
+map_alignment(const char *filename, struct aln_parser * ap, size_t * size)
+{
+	struct stat     st;
+	const char     *map;
+	int             fd;
+
+	fd = open(filename, O_RDONLY);
+	if (-1 == fd || 0 != fstat(fd, &st) || 0 == st.st_size) {
+		printf("Can't open data file %s for input!\n", filename);
+		if (-1 != fd)
+			close(fd);
+		return NULL;
+	}
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (MAP_FAILED == map) {
+		printf("Can't open data file %s for input!\n", filename);
+		return NULL;
+	}
+	*size = st.st_size;
+	ap->p = map;
+	ap->end = map + st.st_size;
+	return map;
+}
+
+/*
+ * Take the first ncodons codons held by the readers as a data set, codon j
+ * being site offset + j of the alignment. Warnings about unrecognised
+ * nucleotides and odd gaps found so far are printed, the first odd gap of
+ * the alignment with an explanation.
+ */
+static DATA_SET *
+take_codons(struct aln_parser * ap, const int ncodons, const int offset,
+	    const int gencode, bool * odd_gap_anywhere)
+{
+	DATA_SET       *data = CreateDataSet(ncodons, ap->n_sp);
+	int             i, j;
+
+	OOM(data);
+	for (i = 0; i < ap->n_sp; i++) {
+		struct codon_reader *r = ap->sp + i;
+		if (r->nbad > 0) {
+			printf("#  Warning: Found unrecognised nucleotide in sequence %s: ", r->name);
+			for (j = 0; j < r->nbad; j++)
+				printf("%c(%d) ", r->badc[j], r->badpos[j]);
+			fputc('\n', stdout);
+			r->nbad = 0;
+		}
+		bool            odd_gap_in_sequence = false;
+		for (j = 0; j < ncodons; j++) {
+			if (ODD_GAP != r->seq[j])
+				continue;
+			if (!*odd_gap_anywhere) {
+				puts("#  Warning: Odd gapping found. Treating entire codon as gap. This may\n"
+				     "# be the result of ambiguous nucleotides being translated into gaps.");
+				*odd_gap_anywhere = true;
+			}
+			if (!odd_gap_in_sequence) {
+				printf("#  Warning: Odd gapping in sequence %s,\tcodon sites: ", r->name);
+				odd_gap_in_sequence = true;
+			}
+			printf("%d ", offset + j);
+			r->seq[j] = GapChar(SEQTYPE_CODON);
+		}
+		if (odd_gap_in_sequence)
+			fputc('\n', stdout);
+
+		for (j = 0; j < ncodons; j++) {
+			const int       c = r->seq[j];
+			if (c >= READ_AMBIG) {
+				const int       nset[3] = {c >> 8 & 15, c >> 4 & 15, c & 15};
+				if (NULL == data->ambig)
+					data->ambig = NewAmbiguityTable();
+				DATA_SEQ(data, i, j) = AmbiguityCode(data->ambig, CodonSet(nset), SEQTYPE_CODON, 64);
+			} else
+				DATA_SEQ(data, i, j) = c;
+		}
+		const int       pending = r->len / 3 - r->done - ncodons;
+		if (pending > 0)
+			memmove(r->seq, r->seq + ncodons, pending * sizeof(int));
+		r->done += ncodons;
+		data->sp_name[i] = calloc(MAX_SP_NAME + 1, sizeof(char));
+		OOM(data->sp_name[i]);
+		strcpy(data->sp_name[i], r->name);
+	}
+	data->n_bases = 64;
+	data->seq_type = SEQTYPE_CODON;
+	data->gencode = gencode;
+
+	CheckIsDataSet(data);
+	return data;
+}
+
+/*
+ * Read an alignment of nucleotides directly into codons. The file is mapped
+ * into memory and may be in PAML format, sequential or interleaved PHYLIP
+ * (with names not containing spaces), or FASTA. The layout is found from
+ * the file: FASTA if it starts with '>', otherwise interleaved if the header
+ * contains 'I' or the sequences do not fit the sequential layout. Characters
+ * other than letters and '-' within sequences are ignored. If ambiguity is
+ * set, a codon containing IUPAC ambiguity codes is read as the set of codons
+ * compatible with it, otherwise as a gap.
+ */
+DATA_SET       *
+read_codon_data(const char *filename, const int gencode, const bool ambiguity)
+{
+	struct aln_parser ap = {0};
+	const char     *map, *format;
+	size_t          size;
+	bool            ok;
+
+	ap.ambiguity = ambiguity;
+	map = map_alignment(filename, &ap, &size);
+	if (NULL == map)
+		return NULL;
+	format = parse_alignment(&ap, filename, &ok);
+	munmap((void *) map, size);
+
+	const int       ncodons = ap.n_pts / 3;
+	if (!ok || ncodons < 1) {
+		if (NULL != format)
+			printf("Problems reading %s alignment from %s, aborting\n", format, filename);
+		free_readers(&ap);
+		return NULL;
+	}
+	printf("# Read %s alignment of %d sequences and %d nucleotides\n", format, ap.n_sp, ap.n_pts);
+	if (0 != ap.n_pts % 3) {
+		fprintf(stderr,
+			"#  Warning: sequence length is not divisible by three and so cannot have\n"
+			"# coding structure. It will be trunctated to %d sites (%d codons).\n", 3 * ncodons, ncodons);
+	}
+
+	bool            odd_gap_anywhere = false;
+	DATA_SET       *data = take_codons(&ap, ncodons, 0, gencode, &odd_gap_anywhere);
+	free_readers(&ap);
+	return data;
+}
+
+/*
+ * Alignment read in blocks of codons, so that only a block need be held in
+ * memory. The layout is found, and the alignment checked, by counting the
+ * nucleotides of each sequence when the stream is opened. Each sequence of a
+ * sequential or FASTA alignment is then read from its own position in the
+ * file, while the lines of an interleaved alignment are read in turn.
+ */
+struct codon_stream {
+	const char     *map;
+	size_t          size;
+	struct aln_parser ap;
+	int             ncodons, next;	/* Codons in alignment, next to read */
+	int             gencode;
+	bool            odd_gap;
+};
+
+struct codon_stream *
+OpenCodonStream(const char *filename, const int gencode, const bool ambiguity)
+{
+	struct codon_stream *stream = calloc(1, sizeof(struct codon_stream));
+	const char     *format;
+	bool            ok;
+
+	OOM(stream);
+	stream->ap.count = true;
+	stream->ap.ambiguity = ambiguity;
+	stream->map = map_alignment(filename, &stream->ap, &stream->size);
+	if (NULL == stream->map) {
+		free(stream);
+		return NULL;
+	}
+	format = parse_alignment(&stream->ap, filename, &ok);
+	stream->ncodons = stream->ap.n_pts / 3;
+	if (!ok || stream->ncodons < 1) {
+		if (NULL != format)
+			printf("Problems reading %s alignment from %s, aborting\n", format, filename);
+		CloseCodonStream(stream);
+		return NULL;
+	}
+	printf("# Streaming %s alignment of %d sequences and %d nucleotides\n", format, stream->ap.n_sp, stream->ap.n_pts);
+	if (0 != stream->ap.n_pts % 3) {
+		fprintf(stderr,
+			"#  Warning: sequence length is not divisible by three and so cannot have\n"
+			"# coding structure. It will be trunctated to %d sites (%d codons).\n", 3 * stream->ncodons, stream->ncodons);
+	}
+
+	/* Read again from the start, now keeping codons */
+	reset_readers(&stream->ap, stream->ap.start);
+	stream->ap.line = 0;
+	for (int i = 0; i < stream->ap.n_sp; i++)
+		stream->ap.sp[i].count = false;
+	stream->gencode = gencode;
+	return stream;
+}
+
+int 
+CodonStreamLength(const struct codon_stream * stream)
+{
+	assert(NULL != stream);
+	return stream->ncodons;
+}
+
+/*
+ * Next block of at most ncodons codons from the alignment, or NULL once the
+ * whole alignment has been read.
+ */
+DATA_SET       *
+ReadCodonBlock(struct codon_stream * stream, const int ncodons)
+{
+	struct aln_parser *ap;
+	int             i, n;
+
+	assert(NULL != stream);
+	assert(ncodons > 0);
+
+	ap = &stream->ap;
+	n = stream->ncodons - stream->next;
+	if (n <= 0)
+		return NULL;
+	if (n > ncodons)
+		n = ncodons;
+
+	if (ap->interleaved) {
+		for (i = 0; i < ap->n_sp;) {
+			const struct codon_reader *r = ap->sp + i;
+			if (r->len / 3 - r->done >= n) {
+				i++;
+				continue;
+			}
+			skip_space(ap);
+			if (ap->p == ap->end || !read_interleaved_line(ap))
+				break;
+		}
+	} else {
+		for (i = 0; i < ap->n_sp; i++) {
+			struct codon_reader *r = ap->sp + i;
+			while (r->len / 3 - r->done < n && r->p < ap->end) {
+				const char      c = *r->p++;
+				if (IsSeqChar(c))
+					add_nucleotide(r, c);
+			}
+		}
+	}
+	for (i = 0; i < ap->n_sp; i++)
+		if (ap->sp[i].len / 3 - ap->sp[i].done < n)
+			errx(EXIT_FAILURE, "Alignment changed while being read");
+
+	DATA_SET       *data = take_codons(ap, n, stream->next, stream->gencode, &stream->odd_gap);
+	stream->next += n;
+	return data;
+}
+
+void
+CloseCodonStream(struct codon_stream * stream)
+{
+	if (NULL == stream)
+		return;
+	if (NULL != stream->map)
+		munmap((void *) stream->map, stream->size);
+	free_readers(&stream->ap);
+	free(stream);
+}
+
+/*
+ * Preprocessed alignment cache. Holds compressed data in Q-coordinates and
+ * its empirical codon frequencies so that later runs need not read and
+ * compress the alignment again. Values are in native byte order; a file
+ * of another version, byte order or key is ignored. After the header come
+ * the 64 codon frequencies, the weight of each pattern, the index of each
+ * site, the species names (MAX_SP_NAME + 1 characters each), the patterns,
+ * one byte per codon with all species of a pattern together, and finally the
+ * set and sequence type of each ambiguity code of the data, in order.
+ */
+#define DATA_CACHE_MAGIC	"SLRDATA"
+#define DATA_CACHE_VERSION	2
+#define DATA_CACHE_BYTEORDER	0x01020304
+
+struct data_cache_header {
+	char            magic[8];
+	uint32_t        version, byteorder;
+	uint64_t        key;
+	int32_t         n_sp, n_pts, n_unique_pts, gencode;
+	int32_t         n_ambig;
+};
+
+struct data_cache_ambiguity {
+	uint64_t        set;
+	int32_t         seqtype, pad;
+};
+
+static size_t 
+data_cache_size(const struct data_cache_header * hdr)
+{
+	return sizeof(struct data_cache_header) + 64 * sizeof(double)
+		+ hdr->n_unique_pts * sizeof(double) + hdr->n_pts * sizeof(int32_t)
+		+ hdr->n_sp * (MAX_SP_NAME + 1)
+		+ (size_t) hdr->n_unique_pts * hdr->n_sp
+		+ hdr->n_ambig * sizeof(struct data_cache_ambiguity);
+}
+
+/*
+ * Written under a temporary name first, so concurrent runs never see a
+ * partially written file. Returns zero on success.
+ */
+int 
+WriteDataCache(const char *file, const uint64_t key, const DATA_SET * data,
+	       const double *freqs)
+{
+	struct data_cache_header hdr;
+	char           *tmpname, name[MAX_SP_NAME + 1];
+	FILE           *fp;
+	int             i, sp, ok;
+
+	CheckIsDataSet(data);
+	assert(data->seq_type == SEQTYPE_CODONQ);
+	assert(NULL != freqs);
+
+	memset(&hdr, 0, sizeof(hdr));
+	strcpy(hdr.magic, DATA_CACHE_MAGIC);
+	hdr.version = DATA_CACHE_VERSION;
+	hdr.byteorder = DATA_CACHE_BYTEORDER;
+	hdr.key = key;
+	hdr.n_sp = data->n_sp;
+	hdr.n_pts = data->n_pts;
+	hdr.n_unique_pts = data->n_unique_pts;
+	hdr.gencode = data->gencode;
+	hdr.n_ambig = NumberAmbiguities(data->ambig);
+
+	tmpname = malloc(strlen(file) + 32);
+	OOM(tmpname);
+	sprintf(tmpname, "%s.%ld.tmp", file, (long) getpid());
+	fp = fopen(tmpname, "wb");
+	if (NULL == fp) {
+		free(tmpname);
+		return -1;
+	}
+	ok = (1 == fwrite(&hdr, sizeof(hdr), 1, fp));
+	ok = ok && (64 == fwrite(freqs, sizeof(double), 64, fp));
+	ok = ok && (data->n_unique_pts == fwrite(data->freq, sizeof(double), data->n_unique_pts, fp));
+	for (i = 0; ok && i < data->n_pts; i++) {
+		const int32_t   idx = data->index[i];
+		ok = (1 == fwrite(&idx, sizeof(int32_t), 1, fp));
+	}
+	for (sp = 0; ok && sp < data->n_sp; sp++) {
+		memset(name, 0, sizeof(name));
+		strncpy(name, data->sp_name[sp], MAX_SP_NAME);
+		ok = (1 == fwrite(name, sizeof(name), 1, fp));
+	}
+	for (i = 0; ok && i < data->n_unique_pts; i++)
+		ok = (1 == fwrite(DATA_COLUMN(data, i), data->n_sp, 1, fp));
+	for (i = 0; ok && i < hdr.n_ambig; i++) {
+		const struct ambiguity *amb = Ambiguity(data->ambig, AMBIG_FIRST + i);
+		struct data_cache_ambiguity rec = {amb->set, amb->seqtype, 0};
+		ok = (1 == fwrite(&rec, sizeof(rec), 1, fp));
+	}
+
+	ok = (0 == fclose(fp)) && ok;
+	ok = ok && (0 == rename(tmpname, file));
+	if (!ok)
+		remove(tmpname);
+	free(tmpname);
+	return ok ? 0 : -1;
+}
+
+/*
+ * Data from the cache file, with the codon frequencies stored alongside it
+ * returned in freqs. Returns NULL if the file does not exist or is not a
+ * cache for this key.
+ */
+DATA_SET       *
+ReadDataCache(const char *file, const uint64_t key, double **freqs)
+{
+	const struct data_cache_header *hdr;
+	struct stat     st;
+	const char     *map, *pos;
+	DATA_SET       *data;
+	int             fd, i, sp;
+
+	assert(NULL != freqs);
+	fd = open(file, O_RDONLY);
+	if (-1 == fd)
+		return NULL;
+	if (0 != fstat(fd, &st) || st.st_size < sizeof(struct data_cache_header)) {
+		close(fd);
+		return NULL;
+	}
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (MAP_FAILED == map)
+		return NULL;
+
+	hdr = (const struct data_cache_header *) map;
+	if (0 != strcmp(hdr->magic, DATA_CACHE_MAGIC)
+	    || DATA_CACHE_VERSION != hdr->version
+	    || DATA_CACHE_BYTEORDER != hdr->byteorder || key != hdr->key
+	    || hdr->n_sp <= 0 || hdr->n_unique_pts <= 0
+	    || hdr->n_pts < hdr->n_unique_pts || !IsValidGencode(hdr->gencode)
+	    || hdr->n_ambig < 0 || hdr->n_ambig > MAX_AMBIG
+	    || data_cache_size(hdr) != st.st_size) {
+		warnx("Ignoring %s, which is not a cache of this alignment", file);
+		munmap((void *) map, st.st_size);
+		return NULL;
+	}
+
+	data = CreateDataSet(hdr->n_unique_pts, hdr->n_sp);
+	data->n_pts = hdr->n_pts;
+	data->compressed = 1;
+	data->seq_type = SEQTYPE_CODONQ;
+	data->gencode = hdr->gencode;
+	data->n_bases = NumberPossibleBases(SEQTYPE_CODONQ, hdr->gencode);
+
+	pos = map + sizeof(struct data_cache_header);
+	*freqs = malloc(64 * sizeof(double));
+	OOM(*freqs);
+	memcpy(*freqs, pos, 64 * sizeof(double));
+	pos += 64 * sizeof(double);
+	memcpy(data->freq, pos, hdr->n_unique_pts * sizeof(double));
+	pos += hdr->n_unique_pts * sizeof(double);
+	/*
+	 * Nothing beyond the size of the file is trusted: every index, base and
+	 * code is checked, and only valid values are stored, before the data
+	 * are used.
+	 */
+	bool            valid = true;
+	free(data->index);
+	data->index = malloc(hdr->n_pts * sizeof(int));
+	OOM(data->index);
+	for (i = 0; i < hdr->n_pts; i++, pos += sizeof(int32_t)) {
+		int32_t         idx;
+		memcpy(&idx, pos, sizeof(int32_t));
+		if (idx >= hdr->n_unique_pts
+		    || (idx < -data->n_bases && -INT_MAX != idx)) {
+			valid = false;
+			idx = -INT_MAX;
+		}
+		data->index[i] = idx;
+	}
+	for (sp = 0; sp < hdr->n_sp; sp++, pos += MAX_SP_NAME + 1) {
+		data->sp_name[sp] = calloc(MAX_SP_NAME + 1, sizeof(char));
+		OOM(data->sp_name[sp]);
+		memcpy(data->sp_name[sp], pos, MAX_SP_NAME);
+	}
+
+	/* Codes are registered again in order, so must come back the same */
+	const char     *amb = pos + (size_t) hdr->n_unique_pts * hdr->n_sp;
+	if (hdr->n_ambig > 0)
+		data->ambig = NewAmbiguityTable();
+	for (i = 0; valid && i < hdr->n_ambig; i++, amb += sizeof(struct data_cache_ambiguity)) {
+		struct data_cache_ambiguity rec;
+		memcpy(&rec, amb, sizeof(rec));
+		valid = IsSeqtype(rec.seqtype)
+			&& AMBIG_FIRST + i == AmbiguityCode(data->ambig, rec.set, rec.seqtype,
+					    NumberPossibleBases(rec.seqtype, hdr->gencode));
+	}
+	const int       gapchar = GapChar(SEQTYPE_CODONQ);
+	for (i = 0; valid && i < hdr->n_unique_pts; i++, pos += hdr->n_sp) {
+		for (sp = 0; sp < hdr->n_sp; sp++) {
+			const int       c = (uint8_t) pos[sp];
+			if (IsAmbiguous(c) ? c - AMBIG_FIRST >= hdr->n_ambig
+			    : c >= data->n_bases && c != gapchar)
+				valid = false;
+		}
+		if (valid)
+			memcpy(DATA_COLUMN(data, i), pos, hdr->n_sp);
+	}
+	if (!valid) {
+		warnx("Ignoring %s, which is not a cache of this alignment", file);
+		munmap((void *) map, st.st_size);
+		free(*freqs);
+		*freqs = NULL;
+		FreeDataSet(data);
+		return NULL;
+	}
+
+	munmap((void *) map, st.st_size);
+	CheckIsDataSet(data);
+	return data;
+}
+
 /* Save sequence data to file */
 int 
 save_data(char *filename, DATA_SET * data)
@@ -1375,9 +2367,9 @@ save_data(char *filename, DATA_SET * data)
 			fprintf(fp, "%s\n", data->sp_name[i]);
 
 		if (data->seq_type == SEQTYPE_NUCLEO)
-			(void) SaveNucleoSeq(fp, data->seq[i], data->n_pts);
+			(void) SaveNucleoSeq(fp, data, i);
 		else if (data->seq_type == SEQTYPE_AMINO)
-			(void) save_amino_seq(fp, data->seq[i], data->n_pts);
+			(void) save_amino_seq(fp, data, i);
 
 		fprintf(fp, "\n");
 	}
@@ -1457,24 +2449,24 @@ ReadAmino(FILE * fp, int n_pts, const char * name)
 
 
 static void 
-SaveNucleoSeq(FILE * fp, int *seq, int length)
+SaveNucleoSeq(FILE * fp, const DATA_SET * data, int sp)
 {
 	int             i;
 
-	for (i = 0; i < length; i++) {
-		fprintf(fp, "%c", NucleoAsChar(seq[i]));
+	for (i = 0; i < data->n_unique_pts; i++) {
+		fprintf(fp, "%c", NucleoAsChar(DATA_SEQ(data, sp, i)));
 		if (i % 60 == 59)
 			fprintf(fp, "\n");
 	}
 }
 
 static void 
-save_amino_seq(FILE * fp, int *seq, int length)
+save_amino_seq(FILE * fp, const DATA_SET * data, int sp)
 {
 	int             i;
 
-	for (i = 0; i < length; i++) {
-		fprintf(fp, "%c", AminoAsChar(seq[i]));
+	for (i = 0; i < data->n_unique_pts; i++) {
+		fprintf(fp, "%c", AminoAsChar(DATA_SEQ(data, sp, i)));
 		if (i % 60 == 59)
 			fprintf(fp, "\n");
 	}
@@ -1498,8 +2490,19 @@ int count_alignment_stops ( const DATA_SET * data){
 	CheckIsDataSet(data);
 
 	int nstop = 0;
-	for ( int sp=0 ; sp<data->n_sp ; sp++){
-		nstop += count_sequence_stops (data->seq[sp],data->n_unique_pts,data->gencode);
+	for ( int i=0 ; i<data->n_unique_pts ; i++){
+		const uint8_t * col = DATA_COLUMN(data,i);
+		for ( int sp=0 ; sp<data->n_sp ; sp++){
+			if (IsAmbiguous(col[sp])){
+				/* Stop only if every compatible codon is */
+				const struct ambiguity * amb = Ambiguity(data->ambig, col[sp]);
+				int k = 0;
+				while ( k<amb->n && IsStop(amb->base[k],data->gencode)){ k++; }
+				if ( k==amb->n ){ nstop++; }
+			} else if (IsStop(col[sp],data->gencode)){
+				nstop++;
+			}
+		}
 	}
 	return nstop;
 }
@@ -22,9 +22,23 @@
 #ifndef _DATA_H_
 #define _DATA_H_
 
+#ifndef _STDINT_H_
+#include <stdint.h>
+#endif
+#include <stdbool.h>
+
 #define MAX_SP_NAME 80
 
+/*  Alignment of the columns of a DATA_SET, in bytes */
+#define DATA_ALIGN 64
+
+struct ambiguity_table;
 
+/*
+ *  Sequences are stored pattern-major, one byte per character: all species
+ * for a pattern are contiguous and each pattern starts a new block of
+ * stride bytes, a multiple of DATA_ALIGN.
+ */
 typedef struct {
         char    seq_type;
         int     n_pts;
@@ -33,12 +47,20 @@ typedef struct {
         int     n_bases;
         int     compressed;
         char  ** sp_name;
-        int ** seq;
+        uint8_t * seq;
+        size_t  stride;
         double  * freq;
         int * index;
 	int gencode;
+	/*  Sets of bases for ambiguous observations, NULL if there are none */
+	struct ambiguity_table * ambig;
 } DATA_SET;
 
+/*  Character of species SP at pattern SITE, usable as an lvalue */
+#define DATA_SEQ(D, SP, SITE) ((D)->seq[(size_t)(SITE) * (D)->stride + (SP)])
+/*  All species at pattern SITE */
+#define DATA_COLUMN(D, SITE) ((D)->seq + (size_t)(SITE) * (D)->stride)
+
 void CheckIsDataSet ( const DATA_SET * data);
 void CheckIsSorted_DS ( const DATA_SET * data);
 
@@ -56,10 +78,12 @@ void CopySiteByIndex (const DATA_SET * old, const int old_idx, DATA_SET * new, c
 DATA_SET * CopyDataSet ( const DATA_SET * data);
 void CopySiteToDataSet ( const DATA_SET * data, DATA_SET * data_single, const int site);
 DATA_SET * SelectFromData ( const DATA_SET * data, const int * idx, const int n);
+DATA_SET * SelectPatternsFromData ( const DATA_SET * data, const int * keep);
 DATA_SET * ExtractSequences ( int * seqs, int n_seq, DATA_SET * data);
 
 DATA_SET * ConvertNucToCodon ( const DATA_SET * data, const int gencode);
 DATA_SET * ConvertCodonToQcoord (DATA_SET * data);
+DATA_SET * ConvertQcoordToNuc ( const DATA_SET * data);
 
 
 double * CodonBaseFreqs ( const DATA_SET * data, const int method, const int species, double * bf);
@@ -70,6 +94,13 @@ double SiteEntropy ( const DATA_SET * data, const int site, const double *pi);
 
 
 DATA_SET * read_data ( const char * filename, const int seqtype);
+DATA_SET * read_codon_data ( const char * filename, const int gencode, const bool ambiguity);
+struct codon_stream * OpenCodonStream ( const char * filename, const int gencode, const bool ambiguity);
+int CodonStreamLength ( const struct codon_stream * stream);
+DATA_SET * ReadCodonBlock ( struct codon_stream * stream, const int ncodons);
+void CloseCodonStream ( struct codon_stream * stream);
+int WriteDataCache ( const char * file, const uint64_t key, const DATA_SET * data, const double * freqs);
+DATA_SET * ReadDataCache ( const char * file, const uint64_t key, double ** freqs);
 int save_data ( char * filename, DATA_SET * data);
 void PrintData ( const DATA_SET * data);
 void PrintSite ( const DATA_SET * data, const int i);
@@ -79,6 +110,7 @@ int CountGapsAtSite ( const DATA_SET * data, const int i);
 int IsSiteSynonymous ( const DATA_SET * data, const int i, const int gencode);
 int IsConserved ( const DATA_SET * data, const int i);
 int NumNongaps ( const DATA_SET * data, const int site);
+int HasAmbiguity ( const DATA_SET * data, const int site);
 int count_sequence_stops ( const int * seq, const int n, const int gencode);
 int count_alignment_stops ( const DATA_SET * data);
 
@@ -63,13 +63,15 @@ static double GetParam(MODEL * model, TREE * tree, int i);
 
 int CalcLike_Sub(NODE * node, NODE * parent, TREE * tree, MODEL * model)
 {
-    double *result;
     double *tmp1;
     double *tmp2;
     double max;
 
     memset(node->scalefactor, 0, model->n_unique_pts * sizeof(*node->scalefactor));
     node->scale = 0;
+    if (NULL == parent) {
+        model->count.prune++;
+    }
 
     if (ISLEAF(node)) {
         /*
@@ -84,10 +86,23 @@ int CalcLike_Sub(NODE * node, NODE * parent, TREE * tree, MODEL * model)
             tmp2 = parent->plik;
             tmp1 = node->mid;
             for (int a = 0; a < model->n_unique_pts; a++) {
-                if (node->seq[a] != GapChar(model->seqtype)){
+                const int base = node->seq[a];
+                if (IsAmbiguous(base)) {
+                    /* Sum over the few bases compatible with observation */
+                    const struct ambiguity *amb = Ambiguity(tree->ambig, base);
+                    for (int b = 0; b < model->nbase; b++) {
+                        const double *row = node->mat + b * model->nbase;
+                        double p = 0.;
+                        for (int k = 0; k < amb->n; k++) {
+                            p += row[amb->base[k]];
+                        }
+                        *tmp1++ = p;
+                        *tmp2++ *= p;
+                    }
+                } else if (base != GapChar(model->seqtype)){
                     for (int b = 0; b < model->nbase; b++) {
-                        *tmp1++ = node->mat[node->seq[a] + b * model->nbase];
-                        *tmp2++ *= node->mat[node->seq[a] + b * model->nbase];
+                        *tmp1++ = node->mat[base + b * model->nbase];
+                        *tmp2++ *= node->mat[base + b * model->nbase];
                     }
                 } else {
                     for (int b = 0; b < model->nbase; b++){
@@ -97,26 +112,14 @@ int CalcLike_Sub(NODE * node, NODE * parent, TREE * tree, MODEL * model)
                 }
             }
         } else {
-            for (int a = 0; a < model->n_unique_pts; a++) {
-                result = node->mid + a * model->nbase;
-                /* Zero results array */
-                memset(result, 0, model->nbase * sizeof(*result));
-                /*
-                 * Main loop, using pointer addition to keep
-                 * track of indices
-                 */
-                tmp2 = node->mat;
-                for (int b = 0; b < model->nbase; b++) {
-                    tmp1 = node->plik;
-                    for (int c = 0; c < model->nbase; c++)
-                        result[b] += tmp1[a * model->nbase + c] * tmp2[c];
-                }
-                /* Multiply parent like by result */
-                tmp1 = parent->plik;
-                for (int b = 0; b < model->nbase; b++) {
-                    tmp1[a * model->nbase + b] *= result[b];
-                }
-            }
+            /* Distribution over bases at tip, as for an internal node */
+            Matrix_MatrixT_Mult(node->plik, model->n_unique_pts, model->nbase,
+                                node->mat, model->nbase, model->nbase,
+                                node->mid);
+            tmp1 = parent->plik;
+            tmp2 = node->mid;
+            for (int b = 0; b < model->nbase * model->n_unique_pts; b++)
+                tmp1[b] *= tmp2[b];
         }
 
         parent->scale += 1;
@@ -164,6 +167,7 @@ int CalcLike_Sub(NODE * node, NODE * parent, TREE * tree, MODEL * model)
             node->scalefactor[a] += log(max);
         }
         node->scale = 0;
+        model->count.rescale++;
     }
     int br = find_connection(node, parent);
     GetP(model, node->blength[br], node->mat);
@@ -184,16 +188,6 @@ int CalcLike_Sub(NODE * node, NODE * parent, TREE * tree, MODEL * model)
 
 int LikeVector(TREE * tree, MODEL * model, double *p)
 {
-    static double *p_tmp = NULL;
-    static int last_nupts = 0;
-
-    if (model->n_unique_pts > last_nupts) {
-        if (p_tmp != NULL)
-            free(p_tmp);
-        p_tmp = malloc(model->n_unique_pts * sizeof(double));
-        OOM(p_tmp);
-        last_nupts = model->n_unique_pts;
-    }
     (void)LikeVectorSub(tree, model, p);
 
     return 0;
@@ -305,19 +299,14 @@ int GradLike(TREE * tree, MODEL * model, double p[], double grad[])
 /* Returns the (i,j) 2nd partial derivative of the likelihood function */
 double Partial2Deriv(TREE * tree, MODEL * model, double p[], int a, int b)
 {
-    static double *space = NULL;
-    static int size = 0;
+    double *space;
     int i;
     double d, *freq, loglike, e;
     double *scale, *scalepm, *scalemp;
     double *scalepp, *scalemm;
 
-    if (space == NULL || size < model->n_unique_pts) {
-        size = model->n_unique_pts;
-        if (space != NULL)
-            free(space);
-        space = malloc(size * sizeof(double));
-    }
+    space = malloc(model->n_unique_pts * sizeof(double));
+    OOM(space);
     if (a == b) {
         d = GetParam(model, tree, a);
         UpdateParam(model, tree, d + DELTA, a);
@@ -325,16 +314,20 @@ double Partial2Deriv(TREE * tree, MODEL * model, double p[], int a, int b)
         for (i = 0; i < model->n_unique_pts; i++)
             if (p[i] > DBL_MIN)
                 space[i] = log(p[i]);
-            else
-                return -DBL_MAX;
+            else {
+                loglike = -DBL_MAX;
+                goto end;
+            }
         scalepp = (tree->tree)->scalefactor;
         UpdateParam(model, tree, (d > DELTA) ? (d - DELTA) : DBL_EPSILON, a);
         LikeVector(tree, model, p);
         for (i = 0; i < model->n_unique_pts; i++)
             if (p[i] > DBL_MIN)
                 space[i] += log(p[i]);
-            else
-                return -DBL_MAX;
+            else {
+                loglike = -DBL_MAX;
+                goto end;
+            }
         scalemm = (tree->tree)->scalefactor;
         UpdateParam(model, tree, d, a);
         LikeVector(tree, model, p);
@@ -345,8 +338,10 @@ double Partial2Deriv(TREE * tree, MODEL * model, double p[], int a, int b)
         for (i = 0; i < model->n_unique_pts; i++) {
             if (p[i] > DBL_MIN)
                 loglike += freq[i] * (space[i] - 2.0 * log(p[i]));
-            else
-                return DBL_MAX;
+            else {
+                loglike = DBL_MAX;
+                goto end;
+            }
             loglike +=
                 freq[i] * (scalepp[i] + scalemm[i] - scale[i] - scale[i]);
         }
@@ -354,8 +349,6 @@ double Partial2Deriv(TREE * tree, MODEL * model, double p[], int a, int b)
         loglike /= DELTA * DELTA;
 
         UpdateParam(model, tree, d, a);
-
-        return loglike;
     } else {
         d = GetParam(model, tree, a);
         e = GetParam(model, tree, b);
@@ -396,10 +389,11 @@ double Partial2Deriv(TREE * tree, MODEL * model, double p[], int a, int b)
 
         UpdateParam(model, tree, d, a);
         UpdateParam(model, tree, e, b);
-        return loglike;
     }
 
-    return 0.0;
+  end:
+    free(space);
+    return loglike;
 }
 
 int HessianLike(TREE * tree, MODEL * model, double p[], double hess[])
@@ -434,6 +428,7 @@ double CalcLike_Single(const double *param, void *data)
     info = (struct single_fun *)data;
     UpdateAllParams(info->model, info->tree, param);
     like = -LikeFun_Single(info->tree, info->model, info->p);
+    info->model->count.like++;
 
     return like;
 }
@@ -726,7 +721,13 @@ DoBranchDerivatives(MODEL * model, const TREE * tree, double *grad,
             } else {
                 for (j = 0; j < model->n_unique_pts; j++) {
                     base = (tree->branches[i])->seq[j];
-                    if (GapChar(model->seqtype) != base) {
+                    if (IsAmbiguous(base)) {
+                        const struct ambiguity *amb = Ambiguity(tree->ambig, base);
+                        tmp = 0.;
+                        for (k = 0; k < amb->n; k++)
+                            tmp += model->pi[amb->base[k]]
+                                 * model->tmp_plik[j * n + amb->base[k]];
+                    } else if (GapChar(model->seqtype) != base) {
                         tmp = model->pi[base] * model->tmp_plik[j * n + base];
                     } else {
                         tmp = 0.;
@@ -796,7 +797,17 @@ DoModelDerviatives(MODEL * model, TREE * tree, double *grad,
             } else {
                 for (unsigned int j = 0; j < npts; j++) {
                     unsigned int base = node->seq[j];
-                    if (GapChar(model->seqtype) != base) {
+                    if (IsAmbiguous(base)) {
+                        // Leaf has set of compatible bases
+                        const struct ambiguity *amb = Ambiguity(tree->ambig, base);
+                        for (int k = 0; k < amb->n; k++) {
+                            for (unsigned int l = 0; l < n; l++) {
+                                bgrad[j] += model->pi[l]
+                                          * dP[l * n + amb->base[k]]
+                                          * B[j * n + l];
+                            }
+                        }
+                    } else if (GapChar(model->seqtype) != base) {
                         // Leaf has ordinary base
                         for (unsigned int l = 0; l < n; l++) {
                             bgrad[j] += model->pi[l] 
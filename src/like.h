@@ -35,6 +35,9 @@
 
 
 int CalcLike_Sub ( NODE * node, NODE * parent, TREE * tree, MODEL * model);
+double CalcLike_Single ( const double * param, void * data);
+void Backwards ( NODE * node, NODE * parent, TREE * tree, MODEL * model);
+void DoModelDerviatives ( MODEL * model, TREE * tree, double * grad, double * lvec, double * lscale);
 int LikeVector ( TREE * tree, MODEL * model, double p[]);
 int LikeVectorSub ( TREE * tree, MODEL * model, double p[]);
 double Like ( double *scale, double like[], double freq[], int usize, double * pi , int nsize, int * index);
@@ -28,13 +28,15 @@ double brentmin(double lb, const double *flbp, double ub, const double *fubp,
                 double x, double *fxp, double (*fun) (const double, void *),
                 const double tol, void *info, int *neval);
 
-static double (*linemin_function) (const double *, void *) = NULL;
-static void *linemin_info;
+/*  Function of a vector and its information, to be minimised along one
+ * dimension. Passed through brentmin so no state is kept between calls.
+ */
+struct linemin_fun1d {
+    double (*fun) (const double *, void *);
+    void *info;
+};
 
-static void setf1d(double (*f) (const double *, void *), void *info);
-static void unsetf1d(void);
 static double fun_wrapper1d(double x, void *info);
-static int CheckLinemin1D(void);
 
 /**  Back-tracking approximate line search
 
@@ -114,45 +116,19 @@ double linemin_1d(double (*fun) (const double *, void *), double *x, void *info,
     assert(min < max);
     assert(tol > 0.);
 
-    setf1d(fun, info);
+    struct linemin_fun1d f1d = { fun, info };
     res =
-        brentmin(min, NULL, max, NULL, x[0], NULL, fun_wrapper1d, 1e-5, info,
+        brentmin(min, NULL, max, NULL, x[0], NULL, fun_wrapper1d, tol, &f1d,
                  neval);
-    fx = fun_wrapper1d(res, info);
+    fx = fun_wrapper1d(res, &f1d);
     *neval = *neval + 1;
     x[0] = res;
-    unsetf1d();
 
     return fx;
 }
 
-static void setf1d(double (*fun) (const double *, void *), void *info)
-{
-    assert(NULL != fun);
-    assert(NULL != info);
-
-    linemin_info = info;
-    linemin_function = fun;
-
-    assert(CheckLinemin1D());
-}
-
-static void unsetf1d(void)
-{
-    assert(CheckLinemin1D());
-
-    linemin_info = NULL;
-    linemin_function = NULL;
-}
-
 static double fun_wrapper1d(double x, void *info)
 {
-    return linemin_function(&x, info);
-}
-
-static int CheckLinemin1D(void)
-{
-    assert(NULL != linemin_function);
-    assert(NULL != linemin_info);
-    return 1;
+    const struct linemin_fun1d *f1d = (const struct linemin_fun1d *)info;
+    return f1d->fun(&x, f1d->info);
 }
@@ -319,8 +319,10 @@ double *GetP(MODEL * model, const double length, double *mat)
                               nbase);
         model->Getq(model);
         model->factorized = 1;
+        model->count.factorize++;
 
     }
+    model->count.getp++;
     const double lenfact =
         (Branches_Proportional == model->has_branches) ? model->param[0] : 1.0;
     MakeP_From_FactQ(model->v, model->ev, model->inv_ev, lenfact * length,
@@ -369,6 +371,9 @@ MODEL *NewModel(const int n, const int nparam)
 
     model->has_branches = Branches_Fixed;
     model->alternate_scaling = 0;
+    model->cfuncs = NULL;
+    model->neutscale = -1.;
+    memset(&model->count, 0, sizeof(struct model_counters));
 
     return model;
 }
@@ -26,6 +26,11 @@
 enum model_branches { Branches_Fixed, Branches_Variable, Branches_Proportional };
 extern const char * model_branches_string[];
 
+/*  Work done with a model, for profiling */
+struct model_counters {
+	unsigned long getp, factorize, prune, rescale, like;
+};
+
 typedef struct md {
         double * q;
         double * p;
@@ -59,6 +64,12 @@ typedef struct md {
 
         int alternate_scaling;
 	enum model_branches has_branches;
+
+	/* Codon models only */
+	const struct codonfuncs * cfuncs;
+	double neutscale;
+
+	struct model_counters count;
 } MODEL;
 
 
@@ -72,6 +72,8 @@ typedef struct {
     int n;
     int neval;
     double trust;
+    int step;
+    int errn;
 } OPTOBJ;
 
 struct scaleinfo {
@@ -86,7 +88,7 @@ struct scaleinfo {
 void
 UpdateH_BFGS(double *H, const double *x, double *xn, const double *dx,
              double *dxn, double *scale, const int n, double *space,
-             const int *onbound);
+             const int *onbound, int *errn);
 double TakeStep(OPTOBJ * opt, const double tol, double *factor, int *newbound);
 
 void
@@ -104,7 +106,7 @@ double TrimAtBoundaries(const double *x, const double *direct,
                         const double *ub, const int *onbound, int *idx);
 int UpdateActiveSet(const double *x, double *grad, const double *scale,
                     double *InvHess, const double *lb, const double *ub,
-                    int *onbound, const int n, int *newbound);
+                    int *onbound, const int n, int *newbound, int *errn);
 double GetNewtonStep(double *direct, const double *InvHess,
                      const double *grad, const int n, const int *onbound);
 void ScaledStep(const double factor, const double *x, double *xn,
@@ -117,8 +119,6 @@ void Rescale(double *x, double *dx, double *H, int n, double *scale);
 void AnalyseOptima(double *x, double *dx, int n, int *onbound, double *lb,
                    double *ub);
 void check_grad(const char *str, OPTOBJ * opt);
-int step, reset;
-int errn = 0;
 
 /** Read optimisation parameters from a file
 
@@ -176,10 +176,41 @@ double calcerr(const double x, const double y)
     return x - y;               /* For absolute errors */
 }
 
+static void
+optimize_sub(double *x, int n, void (*df) (const double *, double *, void *),
+             double (*f) (const double *, void *), double *fx, void *data,
+             double *bd, const bool writeTemp, const bool readTemp,
+             double *warmH, double *warmscale, const bool warm);
+
 void
 Optimize(double *x, int n, void (*df) (const double *, double *, void *),
          double (*f) (const double *, void *), double *fx, void *data,
          double *bd, const bool writeTemp, const bool readTemp)
+{
+    optimize_sub(x, n, df, f, fx, data, bd, writeTemp, readTemp, NULL, NULL,
+                 false);
+}
+
+/*  Optimise starting from the (scaled) inverse Hessian H and scaling of the
+ * parameters left by an earlier optimisation of a similar function, if warm
+ * is true, rather than from the identity. H (n x n) and scale (n) are
+ * replaced by those at the optimum found, so can be used to start another.
+ */
+void
+Optimize_Warm(double *x, int n, void (*df) (const double *, double *, void *),
+              double (*f) (const double *, void *), double *fx, void *data,
+              double *bd, double *H, double *scale, const bool warm)
+{
+    assert(NULL != H);
+    assert(NULL != scale);
+    optimize_sub(x, n, df, f, fx, data, bd, false, false, H, scale, warm);
+}
+
+static void
+optimize_sub(double *x, int n, void (*df) (const double *, double *, void *),
+             double (*f) (const double *, void *), double *fx, void *data,
+             double *bd, const bool writeTemp, const bool readTemp,
+             double *warmH, double *warmscale, const bool warm)
 {
     OPTOBJ *opt;
     double fo, fn, tol, md;
@@ -198,6 +229,14 @@ Optimize(double *x, int n, void (*df) (const double *, double *, void *),
     if (readTemp) {
         read_opt_parameters(TEMPFILE, opt);
     }
+    scale = ((struct scaleinfo *)opt->state)->scale;
+    if (warm) {
+        for (int i = 0; i < n; i++) {
+            scale[i] = warmscale[i];
+            opt->x[i] /= scale[i];
+            opt->dx[i] *= scale[i];
+        }
+    }
 
     tol = 3e-8;
     max_restart = 20;
@@ -208,15 +247,19 @@ Optimize(double *x, int n, void (*df) (const double *, double *, void *),
     printf("Initial\tf: %8.6f\nStep            f(x)      delta\n", opt->fc);
     do {
         fo = opt->fc;
-        InitializeH(opt);
+        if (warm && restarts < 0) {
+            memcpy(opt->H, warmH, n * n * sizeof(double));
+        } else {
+            InitializeH(opt);
+        }
         fact = 1.;
         do {
             fn = opt->fc;
-            errn = 0;
+            opt->errn = 0;
             md = TakeStep(opt, tol, &fact, &newbound);
-            MakeErrString(&errstring, errn);
-            step++;
-            printf("%6d: %12.3f %10.3f %6d %3s %12.3f\n", step,
+            MakeErrString(&errstring, opt->errn);
+            opt->step++;
+            printf("%6d: %12.3f %10.3f %6d %3s %12.3f\n", opt->step,
                    opt->fc, fabs(opt->fc - fn), opt->neval, errstring, md);
 
             // Write temporary values to file
@@ -238,7 +281,10 @@ Optimize(double *x, int n, void (*df) (const double *, double *, void *),
             ("Didn't converge after %d restarts. Returning best value.\n",
              restarts);
     }
-    scale = ((struct scaleinfo *)opt->state)->scale;
+    if (NULL != warmH) {
+        memcpy(warmH, opt->H, n * n * sizeof(double));
+        memcpy(warmscale, scale, n * sizeof(double));
+    }
     for (int i = 0; i < n; i++) {
         x[i] = opt->x[i] * scale[i];
         opt->dx[i] *= scale[i];
@@ -359,7 +405,8 @@ InitializeOpt(OPTOBJ * opt, double *x, int n,
 {
     struct scaleinfo *sinfo;
 
-    step = 0;
+    opt->step = 0;
+    opt->errn = 0;
 
     for (int i = 0; i < n; i++) {
         opt->x[i] = x[i];
@@ -436,10 +483,11 @@ double TakeStep(OPTOBJ * opt, const double tol, double *factor, int *newbound)
     }
     UpdateH_BFGS(opt->H, opt->x, opt->xn, opt->dx, opt->dxn,
                  ((struct scaleinfo *)opt->state)->scale, opt->n, space,
-                 opt->onbound);
+                 opt->onbound, &opt->errn);
     UpdateActiveSet(opt->xn, direct,
                     ((struct scaleinfo *)opt->state)->scale, opt->H,
-                    opt->lb, opt->ub, opt->onbound, opt->n, newbound);
+                    opt->lb, opt->ub, opt->onbound, opt->n, newbound,
+                    &opt->errn);
 
     opt->fc = opt->fn;
     for (int i = 0; i < opt->n; i++) {
@@ -501,7 +549,7 @@ TrimAtBoundaries(const double *x, const double *direct,
 int
 UpdateActiveSet(const double *x, double *direct, const double *scale,
                 double *InvHess, const double *lb, const double *ub,
-                int *onbound, const int n, int *newbound)
+                int *onbound, const int n, int *newbound, int *errn)
 {
     int nremoved = 0;
     bool inverted = false;
@@ -528,7 +576,7 @@ UpdateActiveSet(const double *x, double *direct, const double *scale,
             if (onbound[i] == 0) {
                 /* Newly on boundary. Modify Hessian */
                 nremoved++;
-                errn = errn | PARAM_BOUND;
+                *errn = *errn | PARAM_BOUND;
 		if( ! inverted){
 		    InvertMatrix(InvHess, n);
 		    inverted = true;
@@ -605,7 +653,7 @@ ScaledStep(const double factor, const double *x, double *xn,
 void 
 UpdateH_BFGS(double *H, const double *x, double *xn, const double *dx,
              double *dxn, double *scale, const int n, double *space,
-             const int *onbound)
+             const int *onbound, int *errn)
 {
     const double update_tol = 1e-4;
     double gd = 0., *Hg, gHg = 0.;
@@ -630,7 +678,7 @@ UpdateH_BFGS(double *H, const double *x, double *xn, const double *dx,
     }
 
     if (gd <= update_tol) {
-        errn = errn | HESSIAN_NONPD;
+        *errn = *errn | HESSIAN_NONPD;
         MakeMatrixIdentity(H, n);
         return;
     }
@@ -656,7 +704,6 @@ UpdateH_BFGS(double *H, const double *x, double *xn, const double *dx,
 void InitializeH(OPTOBJ * opt)
 {
     MakeMatrixIdentity(opt->H, opt->n);
-    reset = 1;
 }
 
 void TestIdentity(double *A, double *B, int n)
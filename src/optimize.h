@@ -38,5 +38,6 @@
  */
 
 void Optimize (  double * x, int n, void (*df)(const double *,double *, void *), double (*f)(const double *, void*), double * fx, void * data, double *bd, const bool writeTemp, const bool readTemp);
+void Optimize_Warm ( double * x, int n, void (*df)(const double *,double *, void *), double (*f)(const double *, void*), double * fx, void * data, double *bd, double * H, double * scale, const bool warm);
 
 #endif
@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2003-2008 Tim Massingham (tim.massingham@ebi.ac.uk)
+ *  Funded by EMBL - European Bioinformatics Institute
+ */
+/*
+ *  This file is part of SLR ("Sitewise Likelihood Ratio")
+ *
+ *  SLR is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SLR is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SLR.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <assert.h>
+#include <err.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "profile.h"
+#include "utility.h"
+
+static const char *phase_name[Phase_Number] = {
+    "read", "freqs", "optimise", "grid", "sitewise", "output"
+};
+
+/*  Monotonic clock in nanoseconds */
+uint64_t ProfileClock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+void ProfileInit(struct profile *prof)
+{
+    if (NULL != prof) {
+        memset(prof, 0, sizeof(struct profile));
+    }
+}
+
+void ProfileStart(struct profile *prof, const enum profile_phase phase)
+{
+    assert(phase < Phase_Number);
+    if (NULL != prof) {
+        prof->started[phase] = ProfileClock();
+    }
+}
+
+void ProfileStop(struct profile *prof, const enum profile_phase phase)
+{
+    assert(phase < Phase_Number);
+    if (NULL != prof) {
+        prof->ns[phase] += ProfileClock() - prof->started[phase];
+    }
+}
+
+/*  Move the work counted by model into phase, so the model can be used for
+ * a following phase.
+ */
+void ProfileCounts(struct profile *prof, const enum profile_phase phase,
+                   MODEL * model)
+{
+    assert(phase < Phase_Number);
+    assert(NULL != model);
+    if (NULL != prof) {
+        struct model_counters *c = prof->count + phase;
+        c->getp += model->count.getp;
+        c->factorize += model->count.factorize;
+        c->prune += model->count.prune;
+        c->rescale += model->count.rescale;
+        c->like += model->count.like;
+    }
+    memset(&model->count, 0, sizeof(struct model_counters));
+}
+
+/*  Profile as JSON, with the CPU time and peak resident memory of the
+ * process.
+ */
+void WriteProfile(const char *file, const struct profile *prof)
+{
+    assert(NULL != file);
+    assert(NULL != prof);
+
+    FILE *fp = fopen(file, "w");
+    if (NULL == fp) {
+        warnx("Failed to open %s to write profile", file);
+        return;
+    }
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    const long maxrss_kb = usage.ru_maxrss / 1024;
+#else
+    const long maxrss_kb = usage.ru_maxrss;
+#endif
+
+    uint64_t total = 0;
+    fputs("{\n  \"phases\": [\n", fp);
+    for (int i = 0; i < Phase_Number; i++) {
+        const struct model_counters *c = prof->count + i;
+        fprintf(fp,
+                "    {\"name\": \"%s\", \"ns\": %llu, \"getp\": %lu, \"eigen\": %lu, \"prune\": %lu, \"rescale\": %lu, \"like\": %lu}%s\n",
+                phase_name[i], (unsigned long long)prof->ns[i], c->getp,
+                c->factorize, c->prune, c->rescale, c->like,
+                (i < Phase_Number - 1) ? "," : "");
+        total += prof->ns[i];
+    }
+    fprintf(fp, "  ],\n  \"total_ns\": %llu,\n", (unsigned long long)total);
+    fprintf(fp, "  \"user_seconds\": %ld.%06ld,\n", (long)usage.ru_utime.tv_sec,
+            (long)usage.ru_utime.tv_usec);
+    fprintf(fp, "  \"system_seconds\": %ld.%06ld,\n",
+            (long)usage.ru_stime.tv_sec, (long)usage.ru_stime.tv_usec);
+    fprintf(fp, "  \"peak_rss_kb\": %ld\n}\n", maxrss_kb);
+    fclose(fp);
+}
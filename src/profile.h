@@ -0,0 +1,54 @@
+/*
+ *  Copyright 2003-2008 Tim Massingham (tim.massingham@ebi.ac.uk)
+ *  Funded by EMBL - European Bioinformatics Institute
+ */
+/*
+ *  This file is part of SLR ("Sitewise Likelihood Ratio")
+ *
+ *  SLR is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SLR is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SLR.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PROFILE_H_
+#define _PROFILE_H_
+
+#ifndef _STDINT_H
+#include <stdint.h>
+#endif
+
+#ifndef _MODEL_H_
+#include "model.h"
+#endif
+
+/*  Phases of an analysis, in the order they are run */
+enum profile_phase { Phase_Read, Phase_Freqs, Phase_Optimise, Phase_Grid,
+                     Phase_Sitewise, Phase_Output, Phase_Number };
+
+/*  Wall time and model work for each phase. A NULL profile is accepted
+ * everywhere and records nothing.
+ */
+struct profile {
+    uint64_t ns[Phase_Number];
+    uint64_t started[Phase_Number];
+    struct model_counters count[Phase_Number];
+};
+
+uint64_t ProfileClock(void);
+void ProfileInit(struct profile *prof);
+void ProfileStart(struct profile *prof, const enum profile_phase phase);
+void ProfileStop(struct profile *prof, const enum profile_phase phase);
+void ProfileCounts(struct profile *prof, const enum profile_phase phase,
+                   MODEL * model);
+void WriteProfile(const char *file, const struct profile *prof);
+
+#endif
@@ -83,6 +83,7 @@ static void InitialiseLaggedFromSeed (const unsigned int seed, ULL_TYPE *d, cons
 
 static ULL_TYPE (*RL_generator64) (void) = RL_lagged64;
 static ULL_TYPE history64[RL_LAGGED_K];
+static int lagged_pos = RL_LAGGED_N;
 static ULL_TYPE seed = SEED;
 
 
@@ -311,16 +312,15 @@ ULL_TYPE RL_linear64 (void)
 ULL_TYPE RL_lagged64 (void)
 {
   static ULL_TYPE n[RL_LAGGED_G];
-  static int i = RL_LAGGED_N;
   ULL_TYPE a;
 
   /*   If run out of pre-generated numbers, generate another set */
-  if (i == RL_LAGGED_N) {
+  if (lagged_pos == RL_LAGGED_N) {
     RL_lagged64_g (n);
-    i = 0;
+    lagged_pos = 0;
   }
 
-  a = n[i++];
+  a = n[lagged_pos++];
   return a;
 }
 
@@ -368,6 +368,7 @@ void RL_Init (const unsigned int seed)
   FILE *seed_file;
 
   SetRandomGenerator (RL_LAGGED);
+  lagged_pos = RL_LAGGED_N;
 
   if ( seed != 0){
     InitialiseLaggedFromSeed (seed, history64, RL_LAGGED_K);
@@ -388,6 +389,26 @@ void RL_Init (const unsigned int seed)
 }
 
 
+/*  Initialise lagged generator to the start of one of many streams from
+ * the same seed, so work split between processes can be given a stream per
+ * piece and give the same results however it is divided. The state is filled
+ * by SplitMix64 from the seed and stream number.
+ */
+void RL_InitStream (const unsigned int seed, const unsigned int stream)
+{
+  ULL_TYPE x = ((ULL_TYPE) seed << 32) ^ stream;
+
+  SetRandomGenerator (RL_LAGGED);
+  lagged_pos = RL_LAGGED_N;
+  for (int i = 0; i < RL_LAGGED_K; i++) {
+    x += 0x9E3779B97F4A7C15ULL;
+    ULL_TYPE z = x;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    history64[i] = z ^ (z >> 31);
+  }
+}
+
 static void InitialiseLaggedFromSeed (const unsigned int seed, ULL_TYPE *d, const int n){
   assert (NULL != d);
   assert (n > 0);
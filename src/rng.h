@@ -25,6 +25,7 @@
 #define RL_LAGGED	0
 #define RL_LINEAR	1
 void RL_Init(const unsigned int seed);
+void RL_InitStream(const unsigned int seed, const unsigned int stream);
 
 double RandomStandardUniform ( void);
 double RandomExp (double mean);
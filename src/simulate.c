@@ -0,0 +1,385 @@
+/*
+ *  Copyright 2003-2008 Tim Massingham (tim.massingham@ebi.ac.uk)
+ *  Funded by EMBL - European Bioinformatics Institute
+ */
+/*
+ *  This file is part of SLR ("Sitewise Likelihood Ratio")
+ *
+ *  SLR is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SLR is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SLR.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <assert.h>
+#include <err.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bases.h"
+#include "gencode.h"
+#include "rng.h"
+#include "simulate.h"
+#include "tree_data.h"
+#include "utility.h"
+
+/*  Write subtree on leaves[0..n-1] in Newick format. The caller writes the
+ * length of the branch above it.
+ */
+static void fprint_subtree(FILE * fp, const int *leaves, const int n,
+                           const enum tree_shape shape, const double blength)
+{
+    if (1 == n) {
+        fprintf(fp, "sp%d", leaves[0]);
+        return;
+    }
+    const int nleft = (Shape_Balanced == shape) ? n / 2 : 1;
+    fputc('(', fp);
+    fprint_subtree(fp, leaves, nleft, shape, blength);
+    fprintf(fp, ":%f,", RandomExp(blength));
+    fprint_subtree(fp, leaves + nleft, n - nleft, shape, blength);
+    fprintf(fp, ":%f)", RandomExp(blength));
+}
+
+/*  Unrooted tree of the given shape on n_sp leaves, named sp1 to spn in a
+ * random order, with branch lengths exponentially distributed with mean
+ * blength.
+ */
+TREE *RandomTree(const int n_sp, const enum tree_shape shape,
+                 const double blength)
+{
+    assert(n_sp >= 3);
+    assert(blength > 0.);
+
+    int *leaves = malloc(n_sp * sizeof(int));
+    OOM(leaves);
+    for (int i = 0; i < n_sp; i++) {
+        leaves[i] = i + 1;
+    }
+    for (int i = n_sp - 1; i > 0; i--) {
+        const int j = (int)(RandomStandardUniform() * (i + 1)) % (i + 1);
+        const int tmp = leaves[i];
+        leaves[i] = leaves[j];
+        leaves[j] = tmp;
+    }
+
+    /*  Trifurcation at the root, the last two parts being a subtree of the
+     * requested shape.
+     */
+    char *str = NULL;
+    size_t len = 0;
+    FILE *fp = open_memstream(&str, &len);
+    OOM(fp);
+    const int n1 = (Shape_Balanced == shape) ? n_sp / 3 : 1;
+    const int n2 = (Shape_Balanced == shape) ? (n_sp - n1) / 2 : 1;
+    fputc('(', fp);
+    fprint_subtree(fp, leaves, n1, shape, blength);
+    fprintf(fp, ":%f,", RandomExp(blength));
+    fprint_subtree(fp, leaves + n1, n2, shape, blength);
+    fprintf(fp, ":%f,", RandomExp(blength));
+    fprint_subtree(fp, leaves + n1 + n2, n_sp - n1 - n2, shape, blength);
+    fprintf(fp, ":%f);", RandomExp(blength));
+    fclose(fp);
+    free(leaves);
+
+    TREE *tree = malloc(sizeof(TREE));
+    OOM(tree);
+    tree->tstring = str;
+    tree->n_sp = n_sp;
+    tree->n_br = 0;
+    tree->tree = NULL;
+    create_tree(tree);
+
+    return tree;
+}
+
+/*  Walker's alias table for a discrete distribution on n states, filled by
+ * Vose's method. Column i is chosen uniformly and kept with probability
+ * prob[i], otherwise replaced by alias[i], so one uniform variate and at most
+ * two memory reads give a draw whatever the number of states.
+ */
+static void fill_alias(const double *p, const int n, double *prob, int *alias,
+                       int *work)
+{
+    int *small = work;
+    int *large = work + n;
+    int nsmall = 0, nlarge = 0;
+    double total = 0.;
+
+    for (int i = 0; i < n; i++) {
+        total += p[i];
+    }
+    for (int i = 0; i < n; i++) {
+        prob[i] = n * p[i] / total;
+        alias[i] = i;
+        if (prob[i] < 1.) {
+            small[nsmall++] = i;
+        } else {
+            large[nlarge++] = i;
+        }
+    }
+    while (nsmall > 0 && nlarge > 0) {
+        const int s = small[--nsmall];
+        const int l = large[nlarge - 1];
+        alias[s] = l;
+        prob[l] -= 1. - prob[s];
+        if (prob[l] < 1.) {
+            nlarge--;
+            small[nsmall++] = l;
+        }
+    }
+    /*  Remaining columns are full, up to rounding */
+    while (nlarge > 0) {
+        prob[large[--nlarge]] = 1.;
+    }
+    while (nsmall > 0) {
+        prob[small[--nsmall]] = 1.;
+    }
+}
+
+static inline int draw_alias(const double *prob, const int *alias,
+                             const int n)
+{
+    const double x = RandomStandardUniform() * n;
+    int i = (int)x;
+    if (i >= n) {
+        i = n - 1;
+    }
+    return (x - i < prob[i]) ? i : alias[i];
+}
+
+/*  Alias tables for the equilibrium distribution at the root and for each
+ * row of the transition matrix of every branch, indexed by branch number
+ * (root last). Tables take 12 n^2 bytes per branch.
+ */
+struct simulator {
+    TREE *tree;
+    int n, gencode;
+    double *prob;
+    int *alias;
+};
+
+struct simulator *NewSimulator(TREE * tree, MODEL * model)
+{
+    CheckIsTree(tree);
+    assert(NULL != model);
+
+    struct simulator *sim = malloc(sizeof(struct simulator));
+    OOM(sim);
+    const int n = model->nbase;
+    const size_t ntable = (size_t)tree->n_br * n + 1;
+    sim->tree = tree;
+    sim->n = n;
+    sim->gencode = model->gencode;
+    sim->prob = malloc(ntable * n * sizeof(double));
+    sim->alias = malloc(ntable * n * sizeof(int));
+    double *mat = malloc(n * n * sizeof(double));
+    int *work = malloc(2 * n * sizeof(int));
+    OOM(sim->prob);
+    OOM(sim->alias);
+    OOM(mat);
+    OOM(work);
+
+    for (int b = 0; b < tree->n_br; b++) {
+        const NODE *node = tree->branches[b];
+        GetP(model, node->blength[0], mat);
+        for (int i = 0; i < n; i++) {
+            const size_t off = ((size_t)b * n + i) * n;
+            fill_alias(mat + i * n, n, sim->prob + off, sim->alias + off,
+                       work);
+        }
+    }
+    const size_t off = (size_t)tree->n_br * n * n;
+    fill_alias(model->pi, n, sim->prob + off, sim->alias + off, work);
+    free(work);
+    free(mat);
+
+    return sim;
+}
+
+void FreeSimulator(struct simulator *sim)
+{
+    if (NULL == sim) {
+        return;
+    }
+    free(sim->prob);
+    free(sim->alias);
+    free(sim);
+}
+
+static void simulate_sub(const NODE * node, const NODE * parent,
+                         const struct simulator *sim, const int *pstate,
+                         const int n_pts, DATA_SET * data, int *nleaf,
+                         const double gapfrac)
+{
+    const int n = sim->n;
+    const size_t off = (size_t)node->bnumber * n * n;
+    const double *prob = sim->prob + off;
+    const int *alias = sim->alias + off;
+
+    int *state = malloc(n_pts * sizeof(int));
+    OOM(state);
+    for (int i = 0; i < n_pts; i++) {
+        state[i] = draw_alias(prob + pstate[i] * n, alias + pstate[i] * n, n);
+    }
+
+    if (ISLEAF(node)) {
+        const int sp = (*nleaf)++;
+        const size_t len = strlen(node->name) + 1;
+        data->sp_name[sp] = malloc(len);
+        OOM(data->sp_name[sp]);
+        memcpy(data->sp_name[sp], node->name, len);
+        for (int i = 0; i < n_pts; i++) {
+            DATA_SEQ(data, sp, i) = (gapfrac > 0.
+                                && RandomStandardUniform() < gapfrac) ?
+                GapChar(SEQTYPE_CODON) : QcoordToCodon(state[i],
+                                                       data->gencode);
+        }
+    } else {
+        for (int b = 0; b < node->nbran; b++) {
+            const NODE *child = CHILD(node, b);
+            if (NULL != child && child != parent) {
+                simulate_sub(child, node, sim, state, n_pts, data, nleaf,
+                             gapfrac);
+            }
+        }
+    }
+    free(state);
+}
+
+/*  Alignment of n_pts codons simulated from the simulator's tree and model,
+ * starting from the equilibrium distribution at the root. Each codon is
+ * independently replaced by a gap with probability gapfrac. Sequences are
+ * returned as codons, as read from a file, so the data can be treated exactly
+ * as real data.
+ */
+DATA_SET *Simulate(const struct simulator *sim, const int n_pts,
+                   const double gapfrac)
+{
+    assert(NULL != sim);
+    assert(n_pts > 0);
+    assert(gapfrac >= 0. && gapfrac < 1.);
+
+    const TREE *tree = sim->tree;
+    const int n = sim->n;
+    DATA_SET *data = CreateDataSet(n_pts, tree->n_sp);
+    OOM(data);
+    data->seq_type = SEQTYPE_CODON;
+    data->n_bases = 64;
+    data->gencode = sim->gencode;
+
+    const size_t off = (size_t)tree->n_br * n * n;
+    int *state = malloc(n_pts * sizeof(int));
+    OOM(state);
+    for (int i = 0; i < n_pts; i++) {
+        state[i] = draw_alias(sim->prob + off, sim->alias + off, n);
+    }
+    int nleaf = 0;
+    const NODE *root = tree->tree;
+    for (int b = 0; b < root->nbran; b++) {
+        if (NULL != CHILD(root, b)) {
+            simulate_sub(CHILD(root, b), root, sim, state, n_pts, data,
+                         &nleaf, gapfrac);
+        }
+    }
+    assert(nleaf == tree->n_sp);
+    free(state);
+
+    return data;
+}
+
+DATA_SET *SimulateCodons(TREE * tree, MODEL * model, const int n_pts,
+                         const double gapfrac)
+{
+    struct simulator *sim = NewSimulator(tree, model);
+    DATA_SET *data = Simulate(sim, n_pts, gapfrac);
+    FreeSimulator(sim);
+    return data;
+}
+
+/*  Copy the gaps of data, compressed as for analysis, onto the sites of the
+ * simulated alignment sim, whose species are named by the leaves of tree.
+ * Species of data are matched to leaves as when the data are added to the
+ * tree, by name or else by numeric position, and sim takes the order and
+ * names of the species of data. Sites of data that were all gaps or a single
+ * character are made entirely gaps.
+ */
+void MaskGaps(DATA_SET * sim, const DATA_SET * data, const TREE * tree)
+{
+    CheckIsDataSet(sim);
+    CheckIsDataSet(data);
+    CheckIsTree(tree);
+    assert(sim->n_sp == data->n_sp);
+    assert(sim->n_pts == data->n_pts);
+
+    /*  Simulated species of each species of data */
+    int *row = malloc(data->n_sp * sizeof(int));
+    OOM(row);
+    for (int dsp = 0; dsp < data->n_sp; dsp++) {
+        const NODE *leaf = find_leaf(dsp, tree, data);
+        if (NULL == leaf) {
+            errx(EXIT_FAILURE, "Species %s not in tree", data->sp_name[dsp]);
+        }
+        int sp = 0;
+        while (sp < sim->n_sp && strcmp(sim->sp_name[sp], leaf->name) != 0) {
+            sp++;
+        }
+        assert(sp < sim->n_sp);
+        row[dsp] = sp;
+    }
+
+    const int simgap = GapChar(sim->seq_type);
+    const int datagap = GapChar(data->seq_type);
+    uint8_t *col = malloc(sim->n_sp);
+    OOM(col);
+    for (int i = 0; i < sim->n_pts; i++) {
+        const int idx = data->index[i];
+        for (int dsp = 0; dsp < data->n_sp; dsp++) {
+            col[dsp] = (idx < 0 || datagap == DATA_SEQ(data, dsp, idx)) ?
+                simgap : DATA_SEQ(sim, row[dsp], i);
+        }
+        memcpy(DATA_COLUMN(sim, i), col, sim->n_sp);
+    }
+    free(col);
+    free(row);
+
+    for (int sp = 0; sp < sim->n_sp; sp++) {
+        free(sim->sp_name[sp]);
+        const size_t len = strlen(data->sp_name[sp]) + 1;
+        sim->sp_name[sp] = malloc(len);
+        OOM(sim->sp_name[sp]);
+        memcpy(sim->sp_name[sp], data->sp_name[sp], len);
+    }
+}
+
+/*  Codon alignment in the PAML format read by Slr */
+void WriteCodonAlignment(FILE * fp, const DATA_SET * data)
+{
+    assert(NULL != fp);
+    CheckIsDataSet(data);
+    assert(SEQTYPE_CODON == data->seq_type);
+
+    fprintf(fp, "%d %d\n", data->n_sp, 3 * data->n_pts);
+    for (int sp = 0; sp < data->n_sp; sp++) {
+        fprintf(fp, "%s\n", data->sp_name[sp]);
+        for (int i = 0; i < data->n_pts; i++) {
+            const int codon = DATA_SEQ(data, sp, i);
+            if (GapChar(SEQTYPE_CODON) == codon) {
+                fputs("---", fp);
+            } else {
+                fputc(NucleoAsChar(codon / 16), fp);
+                fputc(NucleoAsChar((codon / 4) % 4), fp);
+                fputc(NucleoAsChar(codon % 4), fp);
+            }
+        }
+        fputc('\n', fp);
+    }
+}
@@ -0,0 +1,59 @@
+/*
+ *  Copyright 2003-2008 Tim Massingham (tim.massingham@ebi.ac.uk)
+ *  Funded by EMBL - European Bioinformatics Institute
+ */
+/*
+ *  This file is part of SLR ("Sitewise Likelihood Ratio")
+ *
+ *  SLR is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SLR is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SLR.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SIMULATE_H_
+#define _SIMULATE_H_
+
+#ifndef _STDIO_H_
+#include <stdio.h>
+#endif
+
+#ifndef _DATA_H_
+#include "data.h"
+#endif
+
+#ifndef _MODEL_H_
+#include "model.h"
+#endif
+
+#ifndef _TREE_H_
+#include "tree.h"
+#endif
+
+/*  Shapes of tree for synthetic data. Balanced trees split the leaves as
+ * evenly as possible at every node, caterpillars add one leaf at a time.
+ */
+enum tree_shape { Shape_Balanced, Shape_Caterpillar };
+
+struct simulator;
+
+TREE *RandomTree(const int n_sp, const enum tree_shape shape,
+                 const double blength);
+struct simulator *NewSimulator(TREE * tree, MODEL * model);
+void FreeSimulator(struct simulator *sim);
+DATA_SET *Simulate(const struct simulator *sim, const int n_pts,
+                   const double gapfrac);
+DATA_SET *SimulateCodons(TREE * tree, MODEL * model, const int n_pts,
+                         const double gapfrac);
+void MaskGaps(DATA_SET * sim, const DATA_SET * data, const TREE * tree);
+void WriteCodonAlignment(FILE * fp, const DATA_SET * data);
+
+#endif
@@ -20,7 +20,9 @@
  */
 
 #include <assert.h>
+#include <ctype.h>
 #include <err.h>
+#include <errno.h>
 #include <float.h>
 #include <limits.h>
 #include <math.h>
@@ -29,12 +31,16 @@
 #include <string.h>
 #include <sys/time.h>
 #include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
 #include <time.h>
+#include <unistd.h>
 
 #include "rng.h"
 #include "gencode.h"
 #include "model.h"
 #include "codonmodel.h"
+#include "nucmodel.h"
 #include "utility.h"
 #include "optimize.h"
 #include "bases.h"
@@ -47,16 +53,132 @@
 #include "statistics.h"
 #include "root.h"
 #include "linemin.h"
+#include "profile.h"
+#include "simulate.h"
 
 #define GRIDSIZE	50
 #define VERSIONSTRING	"1.5.0"
 
+/*  Smallest LRT statistics flagged as significant (unadjusted 95%) in
+ * fprint_results, for the chi-square and chi-bar-square (positive only)
+ * cases. Used to decide which sites can be screened.
+ */
+#define SCREEN_STAT		3.841459
+#define SCREEN_STAT_POSITIVE	2.705543
+#define SCREEN_TOL		1e-2
+#define BOUNDARY_DELTA		1e-6
+
 struct selectioninfo {
     double *llike_neu;
     double *llike_max;
     double *omega_max;
     double *lbound, *ubound;
     int *type;
+    int *screened;
+};
+
+/*  Checkpoint of sitewise results. A header identifying the analysis is
+ * followed by one record per unique site, appended as each is completed.
+ */
+#define CHECKPOINT_SUFFIX	".sitewise.tmp"
+#define CHECKPOINT_MAGIC	0x534c5232
+/*  Relative tolerance for parameters, which may differ slightly if the
+ * optimisation was itself recovered.
+ */
+#define CHECKPOINT_TOL		1e-4
+
+struct checkpoint_header {
+    int magic;
+    int n_sp, n_unique_pts;
+    int positive;
+    double kappa, omega, ldiff;
+    double screen, support_pval;
+    uint64_t patterns;
+};
+
+struct checkpoint_record {
+    int pattern;
+    int type, screened;
+    double llike_neu, llike_max, omega_max;
+    double lbound, ubound;
+};
+
+/*  Persistent store of sitewise results shared between runs. Each record is
+ * a checkpoint record keyed by a hash of the site pattern, in a file named by
+ * a hash of the tree, model and sitewise options. Records are only ever
+ * appended, so several runs may share a store.
+ */
+#define SITECACHE_MAGIC		0x534c5253
+
+struct sitecache_record {
+    uint64_t key;
+    struct checkpoint_record res;
+};
+
+/*  Log of the cost of optimising each site pattern. Sites and patterns are
+ * numbered after those of earlier blocks of a streamed alignment.
+ */
+struct sitecost_log {
+    FILE *fp;
+    int site, pattern;
+};
+
+/*  Function passed to CalcLike_Wrapper */
+struct like_offset {
+    double (*fun) (const double *, void *);
+    void *info;
+    double diff;
+};
+
+/*  Summary of the fitted model, as written at the top of the summary file */
+struct fitinfo {
+    double kappa, omega, loglike;
+    double tree_length, min_blength, max_blength;
+    int nbr;
+};
+
+#define SHARD_MAGIC	"SLRSHARD"
+
+/*  Sitewise results of an alignment read in blocks, one record per site as in
+ * partial results, kept until corrected for multiple comparisons. A header
+ * identifies the analysis so the results can be recovered after an
+ * interruption.
+ */
+#define STREAM_SUFFIX	".stream.part"
+#define STREAM_MAGIC	"SLRSTREAM"
+
+struct stream_header {
+    uint64_t key;
+    int n_pts;
+    double kappa, omega;
+};
+
+/*  Results for one site in partial results files */
+struct part_record {
+    int site, type, screened;
+    double llike_neu, llike_max, omega_max;
+    double lbound, ubound, entropy;
+};
+
+/*  Sitewise results read back from partial results files */
+struct shard_results {
+    struct fitinfo fit;
+    int n_pts, dosupport, positive;
+    struct selectioninfo *selinfo;
+    double *entropy;
+    int *index;
+};
+
+/*  Alignment and starting parameters, shared by the analyses of all trees */
+struct slr_input {
+    DATA_SET *data;
+    const char *seqfile;
+    bool ambiguity;
+    double *freqs;
+    double kappa, omega;
+    struct slr_params *paramin;
+    const CODONFUNCS *cfuncs;
+    struct profile profile;
 };
 
 struct slr_params {
@@ -66,10 +188,9 @@ struct slr_params {
     int gencode;
     double *blengths;
     int nbr;
+    char *topology;
 };
 
-int AnimoParam[400];
-int nseq = 0;
 
 char *FrequencyOptString[3] = { "Empirical (F6?)", "F3x4", "F1x4" };
 
@@ -78,130 +199,210 @@ int Trans(int a);
 double CalcLike_Single(const double *param, void *data);
 void GradLike_Single(const double *param, double *grad, void *data);
 void GradLike_Full(const double *param, double *grad, void *data);
+double *InfoLike_Full(const double *param, double *info, void *data);
 
 VEC create_grid(const unsigned int len, const bool positive);
 int FindBestX(const double *grid, const int site, const int n);
-DATA_SET *ReadData(const char *name, const int gencode);
+int IsNondecreasing(const double *x, const int n);
+int GridCrossing(const double *lgrid, const int n, const int start,
+                 const double thresh, const int dir);
+void GridSupport(const double *lgrid, const VEC omega_grid, const int start,
+                 const double fm, const double ldiff, const bool positive,
+                 double *lb, double *ub);
+DATA_SET *ReadData(const char *name, const int gencode, const bool ambiguity);
+DATA_SET *CompressData(DATA_SET * data);
+DATA_SET *PrepareData(const char *seqfile, const int gencode,
+                      const bool ambiguity, const char *cachedir, double **freqs,
+                      struct profile *prof);
 double OptimizeTree(const DATA_SET * data, TREE * tree, double *freqs,
                     double *x, const unsigned int freqtype, const int codonf,
-                    const enum model_branches branopt, const bool readTemp,
-                    const bool recover);
+                    const enum model_branches branopt,
+                    const CODONFUNCS * cfuncs, const bool readTemp,
+                    const bool recover, struct profile *prof);
+double NucleotideBranchLengths(const DATA_SET * data, TREE * tree,
+                               const bool *invalid, struct profile *prof);
+double TreeLikelihood(const DATA_SET * data, TREE * tree, const double *freqs,
+                      const double kappa, const double omega,
+                      const unsigned int freqtype, const int codonf,
+                      const CODONFUNCS * cfuncs, struct profile *prof);
 struct selectioninfo *CalculateSelection(TREE * tree, DATA_SET * data,
                                          double kappa, double omega,
                                          double *freqs, const double ldiff,
                                          const unsigned int freqtype,
-                                         const int codonf);
+                                         const int codonf,
+                                         const CODONFUNCS * cfuncs,
+                                         const char *outprefix,
+                                         const bool writeTmp,
+                                         const bool recover,
+                                         struct sitecost_log *cost,
+                                         struct profile *prof);
+FILE *open_sitecost(const char *outprefix);
+struct checkpoint_record *read_checkpoint(const char *outprefix,
+                                          const struct checkpoint_header *hdr,
+                                          int *nrecovered);
+FILE *open_checkpoint(const char *outprefix,
+                      const struct checkpoint_header *hdr,
+                      const struct checkpoint_record *rec, const int n);
+char *SiteCacheName(const char *cachedir, const TREE * tree,
+                    const double *freqs, const double *params,
+                    const int nparams, const int *settings,
+                    const int nsettings, const char *nucfile,
+                    const char *aminofile);
+uint64_t *PatternKeys(const DATA_SET * data);
+int read_sitecache(const char *file, const uint64_t * keys, const int n,
+                   struct checkpoint_record *rec);
+FILE *open_sitecache(const char *file);
 void fprint_results(FILE * fp, struct selectioninfo *selinfo,
                     const double *entropy, const double *pval,
                     const double *pval_adj, const int nsites);
 double *CalculatePvals(const double *lmax, const double *lneu, const int n,
                        const bool positive_only);
-double *AdjustPvals(const double *pval, DATA_SET * data);
+double *AdjustPvals(const double *pval, const int *index, const int n_pts);
 double *CalculateEntropy(const DATA_SET * data, const double *freqs);
 int IsRandomSite(const int site, const double *entropy, const double *lmax);
 void fprint_summary(FILE * fp, const struct selectioninfo *selinfo,
                     const double *entropy, const double *pval,
                     const double *pval_adj, const int n_pts);
+void WriteResults(const char *outprefix, const struct fitinfo *fit,
+                  struct selectioninfo *selinfo, const double *entropy,
+                  const int *index, const int n_pts, const bool positive);
+int *ShardPatterns(const int n_unique_pts, const int shard, const int nshard,
+                   const bool stripe);
+void WriteShard(const char *outprefix, const int shard, const int nshard,
+                const struct fitinfo *fit, const struct selectioninfo *selinfo,
+                const double *entropy, const DATA_SET * data,
+                const int *inshard, const bool positive);
+void ReadShard(const char *name, const int shard, const int nshard,
+               struct shard_results *res);
+void CheckShardsComplete(const struct shard_results *res);
+void FreeSelectionInfo(struct selectioninfo *selinfo);
+void FreeShardResults(struct shard_results *res);
+void MergeShards(const char *outprefix, const int nshard);
+int StreamSelection(TREE * tree, const char *seqfile, const int gencode,
+                    const bool ambiguity, const int blocksize, double kappa, double omega,
+                    double *freqs, const double ldiff,
+                    const unsigned int freqtype, const int codonf,
+                    const CODONFUNCS * cfuncs, const char *outprefix,
+                    const bool recover, double *loglike,
+                    struct profile *prof);
+void WriteStreamResults(const char *outprefix, const struct fitinfo *fit,
+                        const int n_pts, const int dosupport,
+                        const bool positive);
+void CompareTrees(const char *outprefix, char **treeprefix, const int ntree);
 double CalcLike_Wrapper(const double *x, void *info);
-void Set_CalcLike_Wrapper(double (*f) (const double *, void *), double diff);
 
 void fprint_params(FILE * fp, const double *params, const int nparams,
                    const double *cfreqs, const int gencode, const TREE * tree);
 void WriteParams(const char *file, const double *params, const int nparams,
                  const double *cfreqs, const int gencode, const TREE * tree);
 struct slr_params *ReadParams(const char *file);
+void FreeParams(struct slr_params *params);
+char *DataCacheName(const char *cachedir, const uint64_t key);
+char *TreeCacheName(const char *cachedir, const DATA_SET * data,
+                    const TREE * tree, const double *freqs, const double kappa,
+                    const double omega, const int *settings,
+                    const int nsettings, const char *nucfile,
+                    const char *aminofile);
+int ReadTreeCache(const char *file, TREE * tree, double *kappa,
+                  double *omega);
+void WriteTreeCache(const char *file, const double kappa, const double omega,
+                    const double *freqs, const int gencode, const TREE * tree);
+
+int Analyse(const char *seqfile, const char *treefile, const char *outprefix,
+            const CODONFUNCS * cfuncs);
+int AnalyseTree(TREE * tree, const struct slr_input *input,
+                const char *outprefix);
+int AnalyseTreeJob(const int t, void *info);
+void BootstrapFit(const DATA_SET * data, TREE * tree, double *freqs,
+                  const double kappa, const double omega,
+                  const unsigned int freqtype, const int codonf,
+                  const enum model_branches branopt,
+                  const CODONFUNCS * cfuncs, const char *outprefix);
+int SimulateNull(TREE * tree, const DATA_SET * data,
+                 const struct selectioninfo *selinfo, const double kappa,
+                 const double *freqs, const unsigned int freqtype,
+                 const int codonf, const CODONFUNCS * cfuncs,
+                 const char *outprefix, const bool positive);
+int RunWorkers(const int njobs, const int nworkers,
+               int (*job) (const int, void *), void *info, char **names,
+               int *status, double *seconds);
+int RunBatch(const char *manifest, const int nworkers, const char *outprefix,
+             const CODONFUNCS * cfuncs);
 
-double eps = 1e-4;
 
 char *OutString[5] =
     { "All gaps", "Single char", "Synonymous", "", "Constant" };
 
 /*   Strings describing options and defaults */
-int n_options = 24;
+int n_options = 40;
 char *options[] = { "seqfile", "treefile", "outprefix", "kappa", "omega",
     "codonf", "nucleof", "aminof", "reoptimise", "nucfile",
     "aminofile", "positive_only", "gencode", "timemem", "ldiff",
     "paramin", "paramout", "skipsitewise", "seed", "freqtype",
-    "cleandata", "branopt", "writetmp", "recover"
+    "cleandata", "branopt", "writetmp", "recover", "screen",
+    "support_pval", "shard", "nshard", "shardstripe", "merge",
+    "cachedir", "batch", "nworkers", "alltrees", "sitecost",
+    "nsim", "simwrite", "nboot", "nucstart", "blocksize"
 };
 
 char *optiondefault[] = { "incodon", "intree", "slr", "2.0", "0.1",
     "0", "0", "0", "1", "nuc.dat",
     "amino.dat", "0", "universal", "0", "3.841459",
     "", "", "0", "0", "1",
-    "0", "1", "0", "0"
+    "0", "1", "0", "0", "0.0",
+    "1.0", "0", "1", "0", "0",
+    "", "", "1", "0", "0",
+    "0", "0", "0", "1", "0"
 };
 
 char optiontype[] = { 's', 's', 's', 'f', 'f',
     'd', 'd', 'd', 'd', 's',
     's', 'd', 's', 'd', 'f',
     's', 's', 'd', 'd', 'd',
-    'd', 'd', 'd', 'd'
+    'd', 'd', 'd', 'd', 'f',
+    'f', 'd', 'd', 'd', 'd',
+    's', 's', 'd', 'd', 'd',
+    'd', 'd', 'd', 'd', 'd'
 };
 
 int optionlength[] = { 1, 1, 1, 1, 1,
     1, 1, 1, 1, 1,
     1, 1, 1, 1, 1,
     1, 1, 1, 1, 1,
-    1, 1, 1, 1
+    1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1
 };
 
 char *default_optionfile = "slr.ctl";
 
 int main(int argc, char *argv[])
 {
-    TREE **trees;
-    DATA_SET *data;
-    double *freqs;
-    struct single_fun *info;
-    double kappa, omega, loglike, ldiff;
-    char *seqfile, *treefile, *outprefix, *nucfile, *aminofile, *gencode_str,
-        *paramin;
-    int codonf, nucleof, aminof, reoptimise;
-    bool positive;
-    double *x;
-    int a, bran, i;
-    int gencode, timemem, skipsitewise, freqtype;
-    struct selectioninfo *selinfo;
-    double *entropy, *pval, *pval_adj;
-    time_t slr_clock[4];
-    struct slr_params *paramin_str;
-    unsigned int seed, cleandata;
-    enum model_branches branopt;
-    bool writeTmp, recover;
+    char *seqfile, *treefile, *outprefix, *nucfile, *aminofile, *batch;
+    int nucleof, aminof, nworkers;
+    unsigned int seed;
+    bool merge;
+    int shard, nshard;
     /*  Option variables
      */
     ReadOptions(argc, argv);
-    kappa = *(double *)GetOption("kappa");
-    omega = *(double *)GetOption("omega");
     seqfile = (char *)GetOption("seqfile");
     treefile = (char *)GetOption("treefile");
     outprefix = (char *)GetOption("outprefix");
-    codonf = *(int *)GetOption("codonf");
     nucleof = *(int *)GetOption("nucleof");
     aminof = *(int *)GetOption("aminof");
     nucfile = (char *)GetOption("nucfile");
     aminofile = (char *)GetOption("aminofile");
-    reoptimise = *(int *)GetOption("reoptimise");
-    positive = *(bool *) GetOption("positive_only");
-    gencode_str = (char *)GetOption("gencode");
-    timemem = *(int *)GetOption("timemem");
-    ldiff = *(double *)GetOption("ldiff");
-    paramin = (char *)GetOption("paramin");
-    skipsitewise = *(int *)GetOption("skipsitewise");
     seed = *(unsigned int *)GetOption("seed");
-    freqtype = *(unsigned int *)GetOption("freqtype");
-    cleandata = *(unsigned int *)GetOption("cleandata");
-    branopt = *(enum model_branches *)GetOption("branopt");
-    writeTmp = *(bool *) GetOption("writetmp");
-    recover = *(bool *) GetOption("recover");
+    shard = *(int *)GetOption("shard");
+    nshard = *(int *)GetOption("nshard");
+    merge = *(bool *) GetOption("merge");
+    batch = (char *)GetOption("batch");
+    nworkers = *(int *)GetOption("nworkers");
 
     PrintOptions();
 
-    if (timemem) {
-        time(slr_clock);
-    }
-
     /*  Initialise random number generator */
     RL_Init(seed);
 
@@ -211,29 +412,106 @@ int main(int argc, char *argv[])
     fputs(VERSIONSTRING, stdout);
     fputc('\n', stdout);
 
-    SetAminoAndCodonFuncs(nucleof, aminof, nucfile, aminofile);
-    gencode = GetGeneticCode(gencode_str);
+    if (nshard < 1 || shard < 0 || shard >= nshard) {
+        errx(EXIT_FAILURE, "Invalid shard %d of %d", shard, nshard);
+    }
+    if (merge) {
+        MergeShards(outprefix, nshard);
+        return EXIT_SUCCESS;
+    }
 
-    if (0 != cleandata) {
-        warnx
-            ("cleandata options not implemented yet. Defaulting to 0 (treat ambiguous characters as gaps).\n");
+    CODONFUNCS *cfuncs = NewCodonFuncs(nucleof, aminof, nucfile, aminofile);
+    OOM(cfuncs);
+
+    int ret;
+    if (batch[0] != '\0') {
+        ret = RunBatch(batch, nworkers, outprefix, cfuncs);
+    } else {
+        ret = Analyse(seqfile, treefile, outprefix, cfuncs);
     }
-    data = ReadData(seqfile, gencode);
-    if (NULL == data) {
-        puts("Problem reading data file. Aborting\n");
-        exit(EXIT_FAILURE);
+    FreeCodonFuncs(cfuncs);
+    return ret;
+}
+
+/*  Analysis of a single alignment and tree, all other settings being taken
+ * from the options.
+ */
+int Analyse(const char *seqfile, const char *treefile, const char *outprefix,
+            const CODONFUNCS * cfuncs)
+{
+    TREE **trees;
+    DATA_SET *data;
+    double *freqs;
+    double kappa, omega;
+    char *gencode_str, *paramin;
+    int i;
+    int gencode, alltrees, nworkers, skipsitewise;
+    struct slr_params *paramin_str = NULL;
+    unsigned int cleandata;
+    int shard, nshard;
+    struct profile prof;
+    /*  Option variables
+     */
+    kappa = *(double *)GetOption("kappa");
+    omega = *(double *)GetOption("omega");
+    gencode_str = (char *)GetOption("gencode");
+    paramin = (char *)GetOption("paramin");
+    cleandata = *(unsigned int *)GetOption("cleandata");
+    shard = *(int *)GetOption("shard");
+    nshard = *(int *)GetOption("nshard");
+    alltrees = *(int *)GetOption("alltrees");
+    nworkers = *(int *)GetOption("nworkers");
+    skipsitewise = *(int *)GetOption("skipsitewise");
+    const char *cachedir = (char *)GetOption("cachedir");
+    const int blocksize = *(int *)GetOption("blocksize");
+    const int reoptimise = *(int *)GetOption("reoptimise");
+    const int nboot = *(int *)GetOption("nboot");
+
+    ProfileInit(&prof);
+    if (blocksize > 0 && (nshard > 1 || alltrees)) {
+        errx(EXIT_FAILURE,
+             "Cannot read alignment in blocks when analysing shards or all trees");
     }
 
-    printf("# Read seqfile file %s. %d species, %d sites.\n", seqfile,
-           data->n_sp, data->n_pts);
+    /*  Each shard writes all its output under its own prefix */
+    if (nshard > 1) {
+        if (alltrees) {
+            errx(EXIT_FAILURE, "Cannot analyse all trees in shards");
+        }
+        char *shardprefix = malloc(strlen(outprefix) + 24);
+        OOM(shardprefix);
+        sprintf(shardprefix, "%s.shard%d", outprefix, shard);
+        outprefix = shardprefix;
+        printf("# Analysing shard %d of %d. Output prefix is %s\n", shard,
+               nshard, outprefix);
+    }
+
+    gencode = GetGeneticCode(gencode_str);
 
-    /*  Get frequencies from data
+    if (cleandata > 1) {
+        errx(EXIT_FAILURE, "Unrecognised value %u for cleandata", cleandata);
+    }
+    /*  With parameters fixed, the alignment need only be read in blocks for
+     * the sitewise analysis.
      */
-    freqs = GetBaseFreqs(data, 0);
+    if (blocksize > 0 && paramin[0] != '\0' && 0 == reoptimise && 0 == nboot
+        && !skipsitewise) {
+        printf("# Parameters fixed by %s. Alignment will be read in blocks of %d codons\n",
+               paramin, blocksize);
+        data = NULL;
+        freqs = calloc(64, sizeof(double));
+        OOM(freqs);
+    } else {
+        data = PrepareData(seqfile, gencode, 1 == cleandata, cachedir,
+                           &freqs, &prof);
+    }
 
     if (paramin[0] != '\0') {
         printf("# Reading old parameter values from %s\n", paramin);
         paramin_str = ReadParams(paramin);
+        if (NULL == paramin_str || paramin_str->nparams < 2) {
+            errx(EXIT_FAILURE, "Failed to read parameters from %s", paramin);
+        }
         kappa = paramin_str->params[0];
         omega = paramin_str->params[1];
         for (i = 0; i < 64; i++) {
@@ -244,20 +522,192 @@ int main(int argc, char *argv[])
         }
     }
 
-    /*  Calculations are in terms of Q coordinates (enumerated sense codons)
-     */
-    ConvertCodonToQcoord(data);
-
-    trees = read_tree_strings(treefile);
+    ProfileStart(&prof, Phase_Read);
+    trees = read_tree_strings((char *)treefile);
     OOM(trees);
     OOM(trees[0]);
-    create_tree(trees[0]);
+    ProfileStop(&prof, Phase_Read);
     printf("# Read tree from %s.\n", treefile);
-    fprint_tree(stdout, trees[0]->tree, NULL, trees[0]);
+
+    struct slr_input input =
+        { data, seqfile, 1 == cleandata, freqs, kappa, omega, paramin_str,
+        cfuncs, prof };
+    int ntree = 0;
+    while (NULL != trees[ntree]) {
+        ntree++;
+    }
+    if (!alltrees || 1 == ntree) {
+        return AnalyseTree(trees[0], &input, outprefix);
+    }
+    if (NULL != paramin_str || ((char *)GetOption("paramout"))[0] != '\0') {
+        errx(EXIT_FAILURE,
+             "Parameter files are for a single tree, so cannot be used when analysing all trees");
+    }
+
+    /*  Every tree is analysed against the same alignment, each in its own
+     * process with output under "<outprefix>.t<tree>".
+     */
+    printf("# Analysing %d trees from %s with %d workers\n", ntree, treefile,
+           nworkers);
+    char **treeprefix = malloc(ntree * sizeof(char *));
+    int *status = malloc(ntree * sizeof(int));
+    double *seconds = malloc(ntree * sizeof(double));
+    OOM(treeprefix);
+    OOM(status);
+    OOM(seconds);
+    for (int t = 0; t < ntree; t++) {
+        treeprefix[t] = malloc(strlen(outprefix) + 24);
+        OOM(treeprefix[t]);
+        sprintf(treeprefix[t], "%s.t%d", outprefix, t + 1);
+    }
+    void *info[3] = { trees, &input, treeprefix };
+    const int nfailed = RunWorkers(ntree, nworkers, AnalyseTreeJob, info,
+                                   treeprefix, status, seconds);
+    if (0 == nfailed && !skipsitewise) {
+        CompareTrees(outprefix, treeprefix, ntree);
+    }
+    for (int t = 0; t < ntree; t++) {
+        free(treeprefix[t]);
+    }
+    free(treeprefix);
+    free(status);
+    free(seconds);
+
+    return (0 == nfailed) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int AnalyseTreeJob(const int t, void *info)
+{
+    TREE **trees = ((void **)info)[0];
+    const struct slr_input *input = ((void **)info)[1];
+    char *treeprefix = ((char **)((void **)info)[2])[t];
+    return AnalyseTree(trees[t], input, treeprefix);
+}
+
+/*  Fit the model on a tree and, unless skipped, calculate sitewise results */
+int AnalyseTree(TREE * tree, const struct slr_input *input,
+                const char *outprefix)
+{
+    DATA_SET *data = input->data;
+    double *freqs = input->freqs;
+    struct slr_params *paramin_str = input->paramin;
+    double kappa, omega, loglike, ldiff;
+    char *nucfile, *aminofile, *gencode_str, *paramin, *paramout, *cachedir;
+    int codonf, nucleof, aminof, reoptimise;
+    bool positive;
+    double *x;
+    int a, bran;
+    int gencode, timemem, skipsitewise, freqtype, alltrees;
+    struct selectioninfo *selinfo;
+    double *entropy;
+    enum model_branches branopt;
+    bool writeTmp, recover, shardstripe;
+    int shard, nshard;
+    int ret = EXIT_SUCCESS;
+    /*  Option variables
+     */
+    kappa = input->kappa;
+    omega = input->omega;
+    codonf = *(int *)GetOption("codonf");
+    nucleof = *(int *)GetOption("nucleof");
+    aminof = *(int *)GetOption("aminof");
+    nucfile = (char *)GetOption("nucfile");
+    aminofile = (char *)GetOption("aminofile");
+    reoptimise = *(int *)GetOption("reoptimise");
+    positive = *(bool *) GetOption("positive_only");
+    gencode_str = (char *)GetOption("gencode");
+    timemem = *(int *)GetOption("timemem");
+    ldiff = *(double *)GetOption("ldiff");
+    paramin = (char *)GetOption("paramin");
+    skipsitewise = *(int *)GetOption("skipsitewise");
+    freqtype = *(unsigned int *)GetOption("freqtype");
+    branopt = *(enum model_branches *)GetOption("branopt");
+    writeTmp = *(bool *) GetOption("writetmp");
+    recover = *(bool *) GetOption("recover");
+    paramout = (char *)GetOption("paramout");
+    shard = *(int *)GetOption("shard");
+    nshard = *(int *)GetOption("nshard");
+    shardstripe = *(bool *) GetOption("shardstripe");
+    cachedir = (char *)GetOption("cachedir");
+    alltrees = *(int *)GetOption("alltrees");
+    const int nsim = *(int *)GetOption("nsim");
+    const int nboot = *(int *)GetOption("nboot");
+    const int nucstart = *(int *)GetOption("nucstart");
+    const int blocksize = *(int *)GetOption("blocksize");
+
+    gencode = GetGeneticCode(gencode_str);
+    if (nsim > 0 && nshard > 1) {
+        errx(EXIT_FAILURE, "Cannot simulate null distribution in shards");
+    }
+    if (nsim > 0 && blocksize > 0) {
+        errx(EXIT_FAILURE,
+             "Cannot simulate null distribution when reading alignment in blocks");
+    }
+
+    /*  Each tree has its own copy of the times taken to read the data */
+    struct profile profile = input->profile;
+    struct profile *prof = timemem ? &profile : NULL;
+
+    create_tree(tree);
+    fprint_tree(stdout, tree->tree, NULL, tree);
+
+    /*  Branch lengths from parameter file replace those of tree */
+    if (NULL != paramin_str) {
+        if (paramin_str->nbr != tree->n_br) {
+            errx(EXIT_FAILURE,
+                 "Tree has %d branches but %s contains %d branch lengths",
+                 tree->n_br, paramin, paramin_str->nbr);
+        }
+        if (NULL != paramin_str->topology) {
+            char *topology = topology_string(tree);
+            if (strcmp(topology, paramin_str->topology) != 0) {
+                errx(EXIT_FAILURE,
+                     "Topology of tree differs from that in %s:\n%s\n%s",
+                     paramin, topology, paramin_str->topology);
+            }
+            free(topology);
+        } else {
+            puts("# Warning. Parameter file has no topology, only checked number of branches");
+        }
+        add_lengths_to_tree(tree, paramin_str->blengths);
+        printf("# Restored %d branch lengths from %s\n", paramin_str->nbr,
+               paramin);
+    }
+
+    /*  Look for fitted parameters from an identical earlier analysis */
+    char *cachefile = NULL;
+    if (cachedir[0] != '\0' && 0 != mkdir(cachedir, 0777) && EEXIST != errno) {
+        err(EXIT_FAILURE, "Failed to create cache directory %s", cachedir);
+    }
+    if (cachedir[0] != '\0' && 0 != reoptimise) {
+        const int settings[] = { gencode, codonf, freqtype, branopt,
+            nucleof, aminof, reoptimise
+        };
+        cachefile =
+            TreeCacheName(cachedir, data, tree, freqs, kappa, omega,
+                          settings, sizeof(settings) / sizeof(int),
+                          nucleof ? nucfile : "", aminof ? aminofile : "");
+        if (ReadTreeCache(cachefile, tree, &kappa, &omega)) {
+            printf("# Found fitted parameters in cache %s\n", cachefile);
+            free(cachefile);
+            cachefile = NULL;
+            reoptimise = 0;
+        } else {
+            printf("# Fitted parameters not in cache. Will be saved to %s\n",
+                   cachefile);
+        }
+    }
 
     bool reoptmess = false;
-    for (bran = 0; bran < trees[0]->n_br; bran++) {
-        NODE *node = trees[0]->branches[bran];
+    bool *invalid = calloc(tree->n_br, sizeof(bool));
+    OOM(invalid);
+    int ninvalid = 0;
+    for (bran = 0; bran < tree->n_br; bran++) {
+        NODE *node = tree->branches[bran];
+        if (node->blength[0] < 0. && 2 != reoptimise) {
+            invalid[bran] = true;
+            ninvalid++;
+        }
         if (node->blength[0] < 0. || 2 == reoptimise) {
             node->blength[0] = RandomExp(0.1);
             a = find_connection(node->branch[0], node);
@@ -277,17 +727,25 @@ int main(int argc, char *argv[])
             branopt = Branches_Variable;
         }
     }
+    if (NULL == data && 0 != reoptimise) {
+        errx(EXIT_FAILURE,
+             "Tree has branches of invalid length, so cannot read alignment in blocks with fixed parameters");
+    }
 
-    info = calloc(1, sizeof(struct single_fun));
-    OOM(info);
-    info->tree = trees[0];
-    info->p = malloc(data->n_pts * 2 * sizeof(double));
-    OOM(info->p);
+    /*  Starting values for missing branch lengths from a nucleotide model,
+     * which is much cheaper to fit than the codon model.
+     */
+    if (ninvalid > 0 && 0 != nucstart) {
+        ProfileStart(prof, Phase_Optimise);
+        NucleotideBranchLengths(data, tree, invalid, prof);
+        ProfileStop(prof, Phase_Optimise);
+    }
+    free(invalid);
 
     if (0 != reoptimise) {
         /* Set initials
          */
-        const unsigned int nbr = trees[0]->n_br;
+        const unsigned int nbr = tree->n_br;
         unsigned int nparam = 2;
         if (Branches_Variable == branopt)
             nparam += nbr;
@@ -299,7 +757,7 @@ int main(int argc, char *argv[])
         if (Branches_Variable == branopt) {
             for (unsigned int bran = 0; bran < nbr; bran++) {
                 /* Branch lengths already randomised if necessary */
-                x[bran] = (trees[0]->branches[bran])->blength[0];
+                x[bran] = (tree->branches[bran])->blength[0];
             }
             offset += nbr;
         } else if (Branches_Proportional == branopt) {
@@ -310,151 +768,1053 @@ int main(int argc, char *argv[])
         x[offset + 0] = (kappa >= 0.) ? kappa : RandomExp(2.0);
         x[offset + 1] = (omega >= 0.) ? omega : RandomExp(0.1);
 
-        if (timemem) {
-            time(slr_clock + 1);
-        }
-
+        ProfileStart(prof, Phase_Optimise);
         loglike =
-            OptimizeTree(data, trees[0], freqs, x, freqtype, codonf, branopt,
-                         writeTmp, recover);
+            OptimizeTree(data, tree, freqs, x, freqtype, codonf, branopt,
+                         input->cfuncs, writeTmp, recover, prof);
+        ProfileStop(prof, Phase_Optimise);
         kappa = x[offset + 0];
         omega = x[offset + 1];
         printf("# lnL = %.3f\n", loglike);
-        free(x);
 
         if (Branches_Proportional == branopt) {
-            ScaleTree(trees[0], x[0]);
+            ScaleTree(tree, x[0]);
         }
+        free(x);
 
-        if (timemem) {
-            time(slr_clock + 2);
+        if (NULL != cachefile) {
+            WriteTreeCache(cachefile, kappa, omega, freqs, gencode, tree);
+            free(cachefile);
         }
+    } else if (NULL == data) {
+        puts("# Not reoptimising parameters. Likelihood will be found as the alignment is read");
+        loglike = 0.;
+    } else {
+        ProfileStart(prof, Phase_Optimise);
+        loglike =
+            TreeLikelihood(data, tree, freqs, kappa, omega, freqtype,
+                           codonf, input->cfuncs, prof);
+        ProfileStop(prof, Phase_Optimise);
+        printf("# Not reoptimising parameters. lnL = %.3f\n", loglike);
     }
 
     /*  Print some information about tree */
     {
         FILE * tree_fp = fopen_with_suffix(outprefix, ".tree", "w");
         if(NULL != tree_fp){
-	    fprintf(tree_fp, "%d 1\n", trees[0]->n_sp);
-            fprint_tree(tree_fp, trees[0]->tree, NULL, trees[0]);
+	    fprintf(tree_fp, "%d 1\n", tree->n_sp);
+            fprint_tree(tree_fp, tree->tree, NULL, tree);
         }
         fclose(tree_fp);
-        fprint_tree(stdout, trees[0]->tree, NULL, trees[0]);
+        fprint_tree(stdout, tree->tree, NULL, tree);
+    }
+
+    if (paramout[0] != '\0') {
+        const double params[2] = { kappa, omega };
+        WriteParams(paramout, params, 2, freqs, gencode, tree);
+        printf("# Written parameter values to %s\n", paramout);
     }
 
-    double min, max, len;
+    struct fitinfo fit = { kappa, omega, loglike, 0., 0., 0., tree->n_br };
     double blen;
-    min = max = len = (trees[0]->branches[0])->blength[0];
-    for (int i = 1; i < trees[0]->n_br; i++) {
-        blen = (trees[0]->branches[i])->blength[0];
-        len += blen;
-        max = (max > blen) ? max : blen;
-        min = (min < blen) ? min : blen;
+    fit.min_blength = fit.max_blength = fit.tree_length =
+        (tree->branches[0])->blength[0];
+    for (int i = 1; i < tree->n_br; i++) {
+        blen = (tree->branches[i])->blength[0];
+        fit.tree_length += blen;
+        fit.max_blength = (fit.max_blength > blen) ? fit.max_blength : blen;
+        fit.min_blength = (fit.min_blength < blen) ? fit.min_blength : blen;
     }
     printf("# Kappa = %8.6f Omega = %8.6f\n", kappa, omega);
     printf
         ("# Tree length = %4.2f, average branch length = %4.2f (min=%4.2f, max=%4.2f)\n",
-         len, len / trees[0]->n_br, min, max);
+         fit.tree_length, fit.tree_length / fit.nbr, fit.min_blength,
+         fit.max_blength);
 
-    if (!skipsitewise) {
+    if (nboot > 0) {
+        BootstrapFit(data, tree, freqs, kappa, omega, freqtype, codonf,
+                     branopt, input->cfuncs, outprefix);
+    }
+
+    if (!skipsitewise && blocksize > 0) {
+        const int n_pts =
+            StreamSelection(tree, input->seqfile, gencode, input->ambiguity,
+                            blocksize, kappa, omega, freqs, ldiff, freqtype,
+                            codonf, input->cfuncs, outprefix, recover,
+                            (NULL == data) ? &fit.loglike : NULL, prof);
+        if (NULL == data) {
+            printf("# Not reoptimising parameters. lnL = %.3f\n",
+                   fit.loglike);
+        }
+        ProfileStart(prof, Phase_Output);
+        WriteStreamResults(outprefix, &fit, n_pts, (0.0 == ldiff) ? 0 : 1,
+                           positive);
+        ProfileStop(prof, Phase_Output);
+    } else if (!skipsitewise) {
+        /*  A shard only analyses its own unique site patterns */
+        DATA_SET *data_sitewise = data;
+        int *inshard = NULL;
+        if (nshard > 1) {
+            inshard = ShardPatterns(data->n_unique_pts, shard, nshard,
+                                    shardstripe);
+            data_sitewise = SelectPatternsFromData(data, inshard);
+            if (NULL == data_sitewise) {
+                errx(EXIT_FAILURE,
+                     "Shard %d contains no site patterns. Use fewer shards.",
+                     shard);
+            }
+        }
+        struct sitecost_log cost = { NULL, 0, 0 };
+        if (*(int *)GetOption("sitecost")) {
+            cost.fp = open_sitecost(outprefix);
+        }
         selinfo =
-            CalculateSelection(trees[0], data, kappa, omega, freqs, ldiff,
-                               freqtype, codonf);
+            CalculateSelection(tree, data_sitewise, kappa, omega, freqs,
+                               ldiff, freqtype, codonf, input->cfuncs,
+                               outprefix, writeTmp, recover,
+                               (NULL != cost.fp) ? &cost : NULL, prof);
+        if (NULL != cost.fp) {
+            fclose(cost.fp);
+        }
+        ProfileStart(prof, Phase_Output);
         entropy = CalculateEntropy(data, freqs);
-        pval =
-            CalculatePvals(selinfo->llike_max, selinfo->llike_neu, data->n_pts,
-                           positive);
-        pval_adj = AdjustPvals(pval, data);
-
-	FILE * results_fp = fopen_with_suffix(outprefix, ".res", "w");
-	if(NULL != results_fp){
-            fprint_results(results_fp, selinfo, entropy, pval, pval_adj, data->n_pts);
-	}
-	fclose(results_fp);
 
-	FILE * summary_fp = fopen_with_suffix(outprefix, ".summary", "w");
-	if(NULL != summary_fp){
-            fprintf(summary_fp, "Kappa = %8.6f\nOmega = %8.6f\n", kappa, omega);
-	    fprintf(summary_fp, "lnL = %.3f\n", loglike);
-            fprintf(summary_fp,
-             "Tree length = %4.2f, average branch length = %4.2f (min=%4.2f, max=%4.2f)\n",
-             len, len / trees[0]->n_br, min, max);
-            fprint_summary(summary_fp, selinfo, entropy, pval, pval_adj, data->n_pts);
-	}
-	fclose(summary_fp);
+        if (nshard > 1) {
+            WriteShard(outprefix, shard, nshard, &fit, selinfo, entropy, data,
+                       inshard, positive);
+            free(inshard);
+            FreeDataSet(data_sitewise);
+        } else {
+            WriteResults(outprefix, &fit, selinfo, entropy, data->index,
+                         data->n_pts, positive);
+        }
+        /*  Results of each tree are kept for comparison between trees */
+        if (alltrees) {
+            int *all = ShardPatterns(data->n_unique_pts, 0, 1, false);
+            WriteShard(outprefix, 0, 1, &fit, selinfo, entropy, data, all,
+                       positive);
+            free(all);
+        }
+        ProfileStop(prof, Phase_Output);
 
-        fprint_summary(stdout, selinfo, entropy, pval, pval_adj, data->n_pts);
+        if (nsim > 0) {
+            ret = SimulateNull(tree, data, selinfo, kappa, freqs, freqtype,
+                               codonf, input->cfuncs, outprefix, positive);
+        }
     }
 
     if (timemem) {
-        struct rusage slr_usage;
-        time(slr_clock + 3);
-        getrusage(RUSAGE_SELF, &slr_usage);
-        fprintf(stdout, "#CpuTime\t%d\n", (int)slr_usage.ru_utime.tv_sec);
-        fprintf(stdout, "#DiffTimes\t%ld\t%ld\t%ld\n",
-                slr_clock[1] - slr_clock[0], slr_clock[2] - slr_clock[1],
-                slr_clock[3] - slr_clock[2]);
+        char *proffile = malloc(strlen(outprefix) + 14);
+        OOM(proffile);
+        sprintf(proffile, "%s.profile.json", outprefix);
+        WriteProfile(proffile, prof);
+        printf("# Written profile to %s\n", proffile);
+        free(proffile);
     }
 
-    return EXIT_SUCCESS;
+    return ret;
 }
 
-int FindBestX(const double *grid, const int site, const int n)
+/*  Replicate alignments simulated under the null hypothesis by one worker */
+struct null_job {
+    TREE *tree;
+    const DATA_SET *data;
+    const struct simulator *sim;
+    double kappa;
+    double *freqs;
+    unsigned int freqtype;
+    int codonf;
+    const CODONFUNCS *cfuncs;
+    const char *outprefix;
+    char **names;
+    int nsim, njobs;
+    unsigned int seed;
+    int write;
+};
+
+/*  Worker j simulates replicates j, j + njobs, ... each from its own stream
+ * of random numbers, so results do not depend on the number of workers. The
+ * replicates are either written to "<outprefix>.rep<r>.paml" or analysed
+ * in memory, the statistic for each informative site being written to
+ * "<names[j]>.null".
+ */
+static int null_job_run(const int j, void *info)
 {
-    assert(NULL != grid);
-    assert(site >= 0);
-    assert(n >= 0);
+    const struct null_job *job = (struct null_job *)info;
+    FILE *fp = NULL;
+    if (!job->write) {
+        fp = fopen_with_suffix(job->names[j], ".null", "w");
+        if (NULL == fp) {
+            err(EXIT_FAILURE, "Failed to open %s.null", job->names[j]);
+        }
+    }
 
-    double min = DBL_MAX;
-    unsigned int bestidx = 0;
-    for (unsigned int a = 0; a < n; a++) {
-        if (grid[site * n + a] < min) {
-            min = grid[site * n + a];
-            bestidx = a;
+    char *repfile = malloc(strlen(job->outprefix) + 24);
+    OOM(repfile);
+    for (int r = j; r < job->nsim; r += job->njobs) {
+        RL_InitStream(job->seed, r);
+        DATA_SET *rep = Simulate(job->sim, job->data->n_pts, 0.);
+        MaskGaps(rep, job->data, job->tree);
+        if (job->write) {
+            sprintf(repfile, "%s.rep%d.paml", job->outprefix, r + 1);
+            FILE *rep_fp = fopen(repfile, "w");
+            if (NULL == rep_fp) {
+                err(EXIT_FAILURE, "Failed to open %s", repfile);
+            }
+            WriteCodonAlignment(rep_fp, rep);
+            fclose(rep_fp);
+            FreeDataSet(rep);
+            continue;
         }
+
+        printf("# Replicate %d\n", r + 1);
+        rep = CompressData(rep);
+        ConvertCodonToQcoord(rep);
+        /*  Tree is already scaled to neutral evolution */
+        struct selectioninfo *selinfo =
+            CalculateSelection(job->tree, rep, job->kappa, 1., job->freqs, 0.,
+                               job->freqtype, job->codonf, job->cfuncs,
+                               job->names[j], false, false, NULL, NULL);
+        for (int site = 0; site < rep->n_pts; site++) {
+            if (rep->index[site] >= 0) {
+                const double stat =
+                    2. * (selinfo->llike_neu[site] - selinfo->llike_max[site]);
+                fprintf(fp, "%d\t%d\t%.6f\n", r + 1, site + 1,
+                        (stat > 0.) ? stat : 0.);
+            }
+        }
+        FreeSelectionInfo(selinfo);
+        FreeDataSet(rep);
+    }
+    free(repfile);
+    if (NULL != fp) {
+        fclose(fp);
     }
 
-    return bestidx;
+    return EXIT_SUCCESS;
 }
 
-DATA_SET *ReadData(const char *name, const int gencode)
+static int double_compare(const void *a, const void *b)
 {
-    DATA_SET *tmp, *data;
+    const double x = *(const double *)a;
+    const double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
 
-    assert(NULL != name);
+/*  Calibrate the sitewise tests by parametric bootstrap. Replicates of the
+ * alignment, with the same gaps, are simulated from the fitted tree and
+ * codon model with omega = 1 and analysed as the data were. The statistics
+ * of all informative sites of all replicates form the null distribution from
+ * which an empirical p-value is found for each site of the data, written to
+ * "<outprefix>.null". With simwrite, replicates are only written as PAML
+ * alignments. Returns EXIT_FAILURE if any worker failed.
+ */
+int SimulateNull(TREE * tree, const DATA_SET * data,
+                 const struct selectioninfo *selinfo, const double kappa,
+                 const double *freqs, const unsigned int freqtype,
+                 const int codonf, const CODONFUNCS * cfuncs,
+                 const char *outprefix, const bool positive)
+{
+    const int nsim = *(int *)GetOption("nsim");
+    const int nworkers = *(int *)GetOption("nworkers");
+    const int simwrite = *(int *)GetOption("simwrite");
+    assert(nsim > 0);
+
+    MODEL *model = NewCodonModel_single(data->gencode, kappa, 1., freqs,
+                                        codonf, freqtype, cfuncs);
+    OOM(model);
+    model->Update(model, 1., 0);
+    struct simulator *sim = NewSimulator(tree, model);
 
-    /* Read nucleotides and convert into codons
+    /*  Seed for the streams of all replicates, drawn after everything else
+     * so results for the data are unchanged.
      */
-    tmp = read_data(name, SEQTYPE_NUCLEO);
-    if (NULL == tmp)
-        return NULL;
-    data = ConvertNucToCodon(tmp, gencode);
-    if (NULL == data) {
-        puts("Error converting nucleotides to codons. Returning uncompressed sequence.");
-        return tmp;
+    const unsigned int seed =
+        (unsigned int)(RandomStandardUniform() * (double)UINT_MAX);
+    const int njobs = (nworkers < nsim) ? nworkers : nsim;
+    char **names = malloc(njobs * sizeof(char *));
+    int *status = malloc(njobs * sizeof(int));
+    double *seconds = malloc(njobs * sizeof(double));
+    OOM(names);
+    OOM(status);
+    OOM(seconds);
+    for (int j = 0; j < njobs; j++) {
+        names[j] = malloc(strlen(outprefix) + 24);
+        OOM(names[j]);
+        sprintf(names[j], "%s.sim%d", outprefix, j + 1);
     }
-    FreeDataSet(tmp);
+    struct null_job job = { tree, data, sim, kappa, (double *)freqs,
+        freqtype, codonf, cfuncs, outprefix, names, nsim, njobs, seed,
+        simwrite
+    };
+    printf("# Simulating %d replicates under the null hypothesis with %d workers\n",
+           nsim, njobs);
+    const int nfailed = RunWorkers(njobs, nworkers, null_job_run, &job, names,
+                                   status, seconds);
+    FreeSimulator(sim);
+    FreeModel(model);
+
+    if (0 != nfailed) {
+        warnx("%d workers simulating the null distribution failed", nfailed);
+    } else if (simwrite) {
+        printf("# Written %d replicates to %s.rep*.paml\n", nsim, outprefix);
+    } else {
+        /*  Pool statistics from all workers */
+        int ninformative = 0;
+        for (int site = 0; site < data->n_pts; site++) {
+            ninformative += (data->index[site] >= 0);
+        }
+        int nstat = 0, maxstat = nsim * ninformative;
+        double *stat = malloc(maxstat * sizeof(double));
+        OOM(stat);
+        for (int j = 0; j < njobs; j++) {
+            FILE *fp = fopen_with_suffix(names[j], ".null", "r");
+            if (NULL == fp) {
+                err(EXIT_FAILURE, "Failed to open %s.null", names[j]);
+            }
+            int r, site;
+            double x;
+            while (nstat < maxstat
+                   && fscanf(fp, "%d %d %lf", &r, &site, &x) == 3) {
+                stat[nstat++] = x;
+            }
+            fclose(fp);
+        }
+        qsort(stat, nstat, sizeof(double), double_compare);
+
+        const double crit = positive ? SCREEN_STAT_POSITIVE : SCREEN_STAT;
+        int ncrit = 0;
+        while (ncrit < nstat && stat[nstat - ncrit - 1] > crit) {
+            ncrit++;
+        }
+        printf("# Null distribution from %d statistics. %.2f%% exceed nominal 5%% critical value\n",
+               nstat, (nstat > 0) ? 100. * ncrit / nstat : 0.);
+
+        double *pval = CalculatePvals(selinfo->llike_max, selinfo->llike_neu,
+                                      data->n_pts, positive);
+        FILE *fp = fopen_with_suffix(outprefix, ".null", "w");
+        if (NULL == fp) {
+            err(EXIT_FAILURE, "Failed to open %s.null", outprefix);
+        }
+        fprintf(fp, "# %d replicates simulated with omega = 1, %d statistics\n",
+                nsim, nstat);
+        fputs("Site\tLrtStat\tPvalue\tEmpPvalue\n", fp);
+        for (int site = 0; site < data->n_pts; site++) {
+            double x = 0., emp = 1.;
+            if (data->index[site] >= 0) {
+                x = 2. * (selinfo->llike_neu[site] - selinfo->llike_max[site]);
+                x = (x > 0.) ? x : 0.;
+                /*  Number of null statistics at least as large as x */
+                int lo = 0, hi = nstat;
+                while (lo < hi) {
+                    const int mid = lo + (hi - lo) / 2;
+                    if (stat[mid] < x) {
+                        lo = mid + 1;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                emp = (1. + nstat - lo) / (1. + nstat);
+            }
+            fprintf(fp, "%d\t%.4f\t%.4e\t%.4e\n", site + 1, x, pval[site],
+                    emp);
+        }
+        fclose(fp);
+        printf("# Written empirical p-values to %s.null\n", outprefix);
+        free(pval);
+        free(stat);
 
-    /*  Check if sequence contains stop codons  */
-    int nstop = count_alignment_stops(data);
-    if (0 != nstop) {
-        fputs("Alignment contains stop codons. Cannot continue.\n", stderr);
-        exit(EXIT_FAILURE);
     }
-    /*  Sort and compress sequence to remove redundency
-     */
-    sort_data(data);
-    tmp = compress_data(data);
-    if (NULL == tmp) {
-        puts("Error compressing sequence! Returning uncompressed set");
-        return data;
+
+    /*  Output of workers is only kept if one failed */
+    char *file = malloc(strlen(outprefix) + 32);
+    OOM(file);
+    for (int j = 0; j < njobs; j++) {
+        if (0 == nfailed) {
+            sprintf(file, "%s.null", names[j]);
+            unlink(file);
+            sprintf(file, "%s.log", names[j]);
+            unlink(file);
+        }
+        free(names[j]);
     }
-    FreeDataSet(data);
+    free(file);
+    free(names);
+    free(status);
+    free(seconds);
 
-    /*  Find and mask trivial observations in data. Likelihood for these
-     * observations can be calculated trivially without using the pruning
-     * algorithm
-     */
+    return (0 == nfailed) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*  Bootstrap replicates of the fit run by one worker. The model, with the
+ * tip data added, and the starting point are set up before the workers are
+ * forked so are shared between them.
+ */
+struct boot_job {
+    const DATA_SET *data;
+    TREE *tree;
+    struct single_fun *info;
+    const double *x0, *H0, *scale0;
+    const double *bd;
+    int nparam, offset, nboot, njobs;
+    bool warm;
+    enum model_branches branopt;
+    unsigned int seed;
+    char **names;
+};
+
+/*  Worker j fits replicates j, j + njobs, ... each from its own stream of
+ * random numbers, writing the estimates to "<names[j]>.boot". Resampling
+ * sites only changes the weight of each site pattern, so the replicates
+ * share the patterns and tip data. Each fit starts from the estimates for
+ * the data, with their inverse Hessian.
+ */
+static int boot_job_run(const int j, void *info)
+{
+    const struct boot_job *job = (struct boot_job *)info;
+    const DATA_SET *data = job->data;
+    const int n = job->nparam;
+    MODEL *model = job->info->model;
+
+    FILE *fp = fopen_with_suffix(job->names[j], ".boot", "w");
+    if (NULL == fp) {
+        err(EXIT_FAILURE, "Failed to open %s.boot", job->names[j]);
+    }
+    double *x = malloc(n * sizeof(double));
+    double *H = malloc(n * n * sizeof(double));
+    double *scale = malloc(n * sizeof(double));
+    double *bd = malloc(2 * n * sizeof(double));
+    OOM(x);
+    OOM(H);
+    OOM(scale);
+    OOM(bd);
+    for (int r = j; r < job->nboot; r += job->njobs) {
+        RL_InitStream(job->seed, r);
+        for (int i = 0; i < data->n_unique_pts; i++) {
+            model->pt_freq[i] = 0.;
+        }
+        for (int i = 0; i < data->n_pts; i++) {
+            int site = (int)(RandomStandardUniform() * data->n_pts);
+            site = (site < data->n_pts) ? site : data->n_pts - 1;
+            if (data->index[site] >= 0) {
+                model->pt_freq[data->index[site]] += 1.;
+            }
+        }
+
+        printf("# Replicate %d\n", r + 1);
+        memcpy(x, job->x0, n * sizeof(double));
+        memcpy(H, job->H0, n * n * sizeof(double));
+        memcpy(scale, job->scale0, n * sizeof(double));
+        memcpy(bd, job->bd, 2 * n * sizeof(double));
+        double fx = CalcLike_Single(x, job->info);
+        Optimize_Warm(x, n, GradLike_Full, CalcLike_Single, &fx, job->info,
+                      bd, H, scale, job->warm);
+
+        double tree_length = 0.;
+        if (Branches_Variable == job->branopt) {
+            for (int b = 0; b < job->tree->n_br; b++) {
+                tree_length += x[b];
+            }
+        } else {
+            for (int b = 0; b < job->tree->n_br; b++) {
+                tree_length += (job->tree->branches[b])->blength[0];
+            }
+            if (Branches_Proportional == job->branopt) {
+                tree_length *= x[0];
+            }
+        }
+        fprintf(fp, "%d\t%.6f\t%.6f\t%.6f\n", r + 1, x[job->offset],
+                x[job->offset + 1], tree_length);
+    }
+    free(bd);
+    free(scale);
+    free(H);
+    free(x);
+    fclose(fp);
+
+    return EXIT_SUCCESS;
+}
+
+/*  Mean, standard deviation and 2.5% and 97.5% quantiles of x[0..n-1],
+ * which is sorted.
+ */
+static void boot_summary(double *x, const int n, double *res)
+{
+    double mean = 0., var = 0.;
+    for (int i = 0; i < n; i++) {
+        mean += x[i];
+    }
+    mean /= n;
+    for (int i = 0; i < n; i++) {
+        var += (x[i] - mean) * (x[i] - mean);
+    }
+    qsort(x, n, sizeof(double), double_compare);
+    res[0] = mean;
+    res[1] = (n > 1) ? sqrt(var / (n - 1)) : 0.;
+    res[2] = x[(int)floor(0.025 * (n - 1))];
+    res[3] = x[(int)ceil(0.975 * (n - 1))];
+}
+
+/*  Standard errors of kappa, omega and the tree length by resampling sites.
+ * Each of nboot replicates draws the number of times every site pattern is
+ * used from a multinomial distribution and refits the model. Estimates for
+ * every replicate and a summary are written to "<outprefix>.boot".
+ */
+void BootstrapFit(const DATA_SET * data, TREE * tree, double *freqs,
+                  const double kappa, const double omega,
+                  const unsigned int freqtype, const int codonf,
+                  const enum model_branches branopt,
+                  const CODONFUNCS * cfuncs, const char *outprefix)
+{
+    CheckIsDataSet(data);
+    CheckIsTree(tree);
+    const int nboot = *(int *)GetOption("nboot");
+    const int nworkers = *(int *)GetOption("nworkers");
+    assert(nboot > 0);
+
+    MODEL *model = NewCodonModel_full(data->gencode, kappa, omega, freqs,
+                                      codonf, freqtype, branopt, cfuncs);
+    OOM(model);
+    model->exact_obs = 1;
+    const int nbr = tree->n_br;
+    const int offset = (Branches_Variable == branopt) ? nbr :
+        (Branches_Proportional == branopt) ? 1 : 0;
+    const int n = model->nparam + ((Branches_Variable == branopt) ? nbr : 0);
+
+    double *x0 = malloc(n * sizeof(double));
+    double *bd = malloc(2 * n * sizeof(double));
+    double *H0 = malloc(n * n * sizeof(double));
+    double *scale0 = malloc(n * sizeof(double));
+    OOM(x0);
+    OOM(bd);
+    OOM(H0);
+    OOM(scale0);
+    for (int i = 0; i < offset; i++) {
+        x0[i] = (Branches_Variable == branopt) ?
+            (tree->branches[i])->blength[0] : 1.;
+    }
+    x0[offset] = kappa;
+    x0[offset + 1] = omega;
+    for (int i = 0; i < n; i++) {
+        bd[i] = 1e-8;
+        bd[n + i] = 50.;
+        x0[i] = (x0[i] > bd[i]) ? x0[i] : bd[i] + 1e-5;
+    }
+
+    struct single_fun *info = calloc(1, sizeof(struct single_fun));
+    OOM(info);
+    info->tree = tree;
+    info->p = calloc(data->n_pts * 2, sizeof(double));
+    OOM(info->p);
+    info->model = model;
+    add_data_to_tree(data, tree, model);
+
+    /*  Inverse of the information at the estimates, scaled as the optimiser
+     * would, warms the first step of every replicate.
+     */
+    CalcLike_Single(x0, info);
+    InfoLike_Full(x0, H0, info);
+    bool warm = (InvertMatrix(H0, n) == 0);
+    for (int i = 0; warm && i < n; i++) {
+        warm = isfinite(H0[i * n + i]) && H0[i * n + i] > 0.;
+    }
+    for (int i = 0; warm && i < n; i++) {
+        scale0[i] = sqrt(H0[i * n + i]);
+        scale0[i] = (scale0[i] > 1e-3) ? scale0[i] : 1e-3;
+        scale0[i] = (scale0[i] < 1e3) ? scale0[i] : 1e3;
+    }
+    for (int i = 0; warm && i < n; i++) {
+        for (int k = 0; k < n; k++) {
+            H0[i * n + k] /= scale0[i] * scale0[k];
+        }
+    }
+    if (!warm) {
+        puts("# Information singular at estimates, bootstrap fits start with identity");
+    }
+
+    const unsigned int seed =
+        (unsigned int)(RandomStandardUniform() * (double)UINT_MAX);
+    const int njobs = (nworkers < nboot) ? nworkers : nboot;
+    char **names = malloc(njobs * sizeof(char *));
+    int *status = malloc(njobs * sizeof(int));
+    double *seconds = malloc(njobs * sizeof(double));
+    OOM(names);
+    OOM(status);
+    OOM(seconds);
+    for (int j = 0; j < njobs; j++) {
+        names[j] = malloc(strlen(outprefix) + 24);
+        OOM(names[j]);
+        sprintf(names[j], "%s.boot%d", outprefix, j + 1);
+    }
+    struct boot_job job = { data, tree, info, x0, H0, scale0, bd, n, offset,
+        nboot, njobs, warm, branopt, seed, names
+    };
+    printf("# Fitting %d bootstrap replicates with %d workers\n", nboot,
+           njobs);
+    const int nfailed = RunWorkers(njobs, nworkers, boot_job_run, &job, names,
+                                   status, seconds);
+
+    if (0 != nfailed) {
+        warnx("%d workers fitting bootstrap replicates failed", nfailed);
+    } else {
+        double *est = malloc(3 * nboot * sizeof(double));
+        OOM(est);
+        for (int i = 0; i < 3 * nboot; i++) {
+            est[i] = NAN;
+        }
+        for (int j = 0; j < njobs; j++) {
+            FILE *fp = fopen_with_suffix(names[j], ".boot", "r");
+            if (NULL == fp) {
+                err(EXIT_FAILURE, "Failed to open %s.boot", names[j]);
+            }
+            int r;
+            double k, w, t;
+            while (fscanf(fp, "%d %lf %lf %lf", &r, &k, &w, &t) == 4) {
+                if (r >= 1 && r <= nboot) {
+                    est[r - 1] = k;
+                    est[nboot + r - 1] = w;
+                    est[2 * nboot + r - 1] = t;
+                }
+            }
+            fclose(fp);
+        }
+
+        FILE *fp = fopen_with_suffix(outprefix, ".boot", "w");
+        if (NULL == fp) {
+            err(EXIT_FAILURE, "Failed to open %s.boot", outprefix);
+        }
+        fputs("Replicate\tKappa\tOmega\tTreeLength\n", fp);
+        for (int r = 0; r < nboot; r++) {
+            fprintf(fp, "%d\t%.6f\t%.6f\t%.6f\n", r + 1, est[r],
+                    est[nboot + r], est[2 * nboot + r]);
+        }
+        fclose(fp);
+
+        const char *name[3] = { "Kappa", "Omega", "Tree length" };
+        for (int i = 0; i < 3; i++) {
+            double res[4];
+            boot_summary(est + i * nboot, nboot, res);
+            printf("# Bootstrap %s: mean %8.6f, s.e. %8.6f, 95%% interval %8.6f - %8.6f\n",
+                   name[i], res[0], res[1], res[2], res[3]);
+        }
+        printf("# Written bootstrap estimates to %s.boot\n", outprefix);
+        free(est);
+    }
+
+    /*  Output of workers is only kept if one failed */
+    char *file = malloc(strlen(outprefix) + 32);
+    OOM(file);
+    for (int j = 0; j < njobs; j++) {
+        if (0 == nfailed) {
+            sprintf(file, "%s.boot", names[j]);
+            unlink(file);
+            sprintf(file, "%s.log", names[j]);
+            unlink(file);
+        }
+        free(names[j]);
+    }
+    free(file);
+    free(names);
+    free(status);
+    free(seconds);
+    free(info->p);
+    free(info);
+    FreeModel(model);
+    free(scale0);
+    free(H0);
+    free(bd);
+    free(x0);
+}
+
+/*  Run njobs jobs, each in a process forked from this one, with up to
+ * nworkers at once. Output of job j that would go to the terminal is written
+ * to "<names[j]>.log". The exit status and wall time of each job are stored
+ * in status and seconds.
+ * Returns the number of jobs that failed.
+ */
+int RunWorkers(const int njobs, const int nworkers,
+               int (*job) (const int, void *), void *info, char **names,
+               int *status, double *seconds)
+{
+    assert(NULL != job);
+    assert(NULL != names);
+    assert(NULL != status);
+    assert(NULL != seconds);
+
+    if (nworkers < 1) {
+        errx(EXIT_FAILURE, "Number of workers must be positive, not %d",
+             nworkers);
+    }
+    pid_t *pid = malloc(njobs * sizeof(pid_t));
+    struct timespec *start = malloc(njobs * sizeof(struct timespec));
+    OOM(pid);
+    OOM(start);
+    fflush(stdout);
+
+    int nrunning = 0, nfailed = 0;
+    for (int next = 0; next < njobs || nrunning > 0;) {
+        if (next < njobs && nrunning < nworkers) {
+            clock_gettime(CLOCK_MONOTONIC, start + next);
+            status[next] = -1;
+            pid[next] = fork();
+            if (-1 == pid[next]) {
+                err(EXIT_FAILURE, "Failed to start %s", names[next]);
+            }
+            if (0 == pid[next]) {
+                FILE *log = fopen_with_suffix(names[next], ".log", "w");
+                if (NULL == log || -1 == dup2(fileno(log), STDOUT_FILENO)) {
+                    err(EXIT_FAILURE, "Failed to open log for %s", names[next]);
+                }
+                fclose(log);
+                const int ret = job(next, info);
+                fflush(stdout);
+                _exit(ret);
+            }
+            nrunning++;
+            next++;
+            continue;
+        }
+
+        int wstatus;
+        const pid_t done = wait(&wstatus);
+        if (-1 == done) {
+            err(EXIT_FAILURE, "Failed waiting for workers");
+        }
+        for (int j = 0; j < next; j++) {
+            if (pid[j] != done) {
+                continue;
+            }
+            struct timespec end;
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            seconds[j] = (end.tv_sec - start[j].tv_sec)
+                + 1e-9 * (end.tv_nsec - start[j].tv_nsec);
+            status[j] = (WIFEXITED(wstatus)) ? WEXITSTATUS(wstatus) : -1;
+            pid[j] = -1;
+            nrunning--;
+            if (EXIT_SUCCESS != status[j]) {
+                nfailed++;
+            }
+            printf("# %d: %s %s in %.2fs\n", j + 1, names[j],
+                   (EXIT_SUCCESS == status[j]) ? "finished" : "FAILED",
+                   seconds[j]);
+            fflush(stdout);
+            break;
+        }
+    }
+    free(start);
+    free(pid);
+
+    return nfailed;
+}
+
+/*  One analysis from a batch manifest */
+struct batch_job {
+    char *seqfile, *treefile, *outprefix;
+    const CODONFUNCS *cfuncs;
+};
+
+static int batch_job_run(const int j, void *info)
+{
+    const struct batch_job *job = (struct batch_job *)info + j;
+    return Analyse(job->seqfile, job->treefile, job->outprefix,
+                   job->cfuncs);
+}
+
+/*  Run each analysis listed in manifest, one line per analysis giving the
+ * sequence file, tree file and output prefix. Options are read once and each
+ * analysis runs in a process forked from this one, so data, trees and models
+ * are freed with the process and the state of the random number generator is
+ * the same for every analysis. The time taken by each analysis is written to
+ * "<outprefix>.batch".
+ */
+int RunBatch(const char *manifest, const int nworkers, const char *outprefix,
+             const CODONFUNCS * cfuncs)
+{
+    assert(NULL != manifest);
+    assert(NULL != outprefix);
+
+    FILE *fp = fopen(manifest, "r");
+    if (NULL == fp) {
+        err(EXIT_FAILURE, "Failed to open batch manifest %s", manifest);
+    }
+
+    int njobs = 0, maxjobs = 64;
+    struct batch_job *jobs = malloc(maxjobs * sizeof(struct batch_job));
+    OOM(jobs);
+    char *line = NULL;
+    size_t linelen = 0;
+    for (int lineno = 1; getline(&line, &linelen, fp) != -1; lineno++) {
+        const char *start = line;
+        while (isspace(*start)) {
+            start++;
+        }
+        if ('\0' == *start || '#' == *start) {
+            continue;
+        }
+        if (njobs == maxjobs) {
+            maxjobs *= 2;
+            jobs = realloc(jobs, maxjobs * sizeof(struct batch_job));
+            OOM(jobs);
+        }
+        struct batch_job *job = jobs + njobs;
+        const size_t len = strlen(start) + 1;
+        job->seqfile = malloc(len);
+        job->treefile = malloc(len);
+        job->outprefix = malloc(len);
+        job->cfuncs = cfuncs;
+        OOM(job->seqfile);
+        OOM(job->treefile);
+        OOM(job->outprefix);
+        if (sscanf(start, "%s %s %s", job->seqfile, job->treefile,
+                   job->outprefix) != 3) {
+            errx(EXIT_FAILURE,
+                 "Line %d of %s should give sequence file, tree file and output prefix",
+                 lineno, manifest);
+        }
+        njobs++;
+    }
+    free(line);
+    fclose(fp);
+    printf("# Running %d analyses from %s with %d workers\n", njobs, manifest,
+           nworkers);
+
+    char **names = malloc(njobs * sizeof(char *));
+    int *status = malloc(njobs * sizeof(int));
+    double *seconds = malloc(njobs * sizeof(double));
+    OOM(names);
+    OOM(status);
+    OOM(seconds);
+    for (int j = 0; j < njobs; j++) {
+        names[j] = jobs[j].outprefix;
+    }
+    const int nfailed =
+        RunWorkers(njobs, nworkers, batch_job_run, jobs, names, status,
+                   seconds);
+
+    FILE *summary_fp = fopen_with_suffix(outprefix, ".batch", "w");
+    if (NULL != summary_fp) {
+        fputs("# Job\tSeqfile\tTreefile\tOutprefix\tStatus\tSeconds\n",
+              summary_fp);
+        for (int j = 0; j < njobs; j++) {
+            fprintf(summary_fp, "%d\t%s\t%s\t%s\t%d\t%.3f\n", j + 1,
+                    jobs[j].seqfile, jobs[j].treefile, jobs[j].outprefix,
+                    status[j], seconds[j]);
+        }
+        fclose(summary_fp);
+    } else {
+        warnx("Failed to write batch summary %s.batch", outprefix);
+    }
+    printf("# %d of %d analyses succeeded. Times written to %s.batch\n",
+           njobs - nfailed, njobs, outprefix);
+
+    for (int j = 0; j < njobs; j++) {
+        free(jobs[j].seqfile);
+        free(jobs[j].treefile);
+        free(jobs[j].outprefix);
+    }
+    free(jobs);
+    free(names);
+    free(status);
+    free(seconds);
+
+    return (0 == nfailed) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int FindBestX(const double *grid, const int site, const int n)
+{
+    assert(NULL != grid);
+    assert(site >= 0);
+    assert(n >= 0);
+
+    double min = DBL_MAX;
+    unsigned int bestidx = 0;
+    for (unsigned int a = 0; a < n; a++) {
+        if (grid[site * n + a] < min) {
+            min = grid[site * n + a];
+            bestidx = a;
+        }
+    }
+
+    return bestidx;
+}
+
+int IsNondecreasing(const double *x, const int n)
+{
+    assert(NULL != x);
+    assert(n > 0);
+
+    for (int i = 1; i < n; i++) {
+        if (x[i] < x[i - 1]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*  Index of first point of a row of the likelihood grid, moving away from
+ * start in direction dir (-1 or +1), whose value exceeds thresh. Returns -1
+ * if there is no such point.
+ */
+int GridCrossing(const double *lgrid, const int n, const int start,
+                 const double thresh, const int dir)
+{
+    assert(NULL != lgrid);
+    assert(start >= 0 && start < n);
+    assert(1 == dir || -1 == dir);
+
+    for (int i = start + dir; i >= 0 && i < n; i += dir) {
+        if (lgrid[i] > thresh) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*  Approximate support interval for omega from a row of the likelihood grid,
+ * interpolating linearly between the grid points either side of where the
+ * likelihood crosses fm + ldiff/2. Bounds default to the edges of the grid
+ * if no crossing is found.
+ */
+void GridSupport(const double *lgrid, const VEC omega_grid, const int start,
+                 const double fm, const double ldiff, const bool positive,
+                 double *lb, double *ub)
+{
+    assert(NULL != lgrid);
+    assert(NULL != lb);
+    assert(NULL != ub);
+
+    const int n = vlen(omega_grid);
+    const double thresh = fm + ldiff / 2.;
+
+    *lb = (double)positive;
+    *ub = 99.;
+    for (int dir = -1; dir <= 1; dir += 2) {
+        const int out = GridCrossing(lgrid, n, start, thresh, dir);
+        if (-1 == out) {
+            continue;
+        }
+        const int in = out - dir;
+        double frac = (thresh - lgrid[in]) / (lgrid[out] - lgrid[in]);
+        frac = (frac > 0.) ? frac : 0.;
+        const double x = vget(omega_grid, in)
+            + frac * (vget(omega_grid, out) - vget(omega_grid, in));
+        if (-1 == dir) {
+            *lb = x;
+        } else {
+            *ub = x;
+        }
+    }
+}
+
+/*  Read, compress and convert the alignment, or take it from the cache of
+ * prepared alignments, and find its codon frequencies.
+ */
+DATA_SET *PrepareData(const char *seqfile, const int gencode,
+                      const bool ambiguity, const char *cachedir,
+                      double **freqs, struct profile *prof)
+{
+    /*  Prepared data from an earlier run on an identical alignment */
+    ProfileStart(prof, Phase_Read);
+    DATA_SET *data = NULL;
+    *freqs = NULL;
+    char *datacache = NULL;
+    uint64_t datakey = FNV_OFFSET;
+    if (cachedir[0] != '\0' && fnv1a_hash_file(&datakey, seqfile)) {
+        if (0 != mkdir(cachedir, 0777) && EEXIST != errno) {
+            err(EXIT_FAILURE, "Failed to create cache directory %s",
+                cachedir);
+        }
+        datakey = fnv1a_hash(datakey, &gencode, sizeof(int));
+        datakey = fnv1a_hash(datakey, &ambiguity, sizeof(bool));
+        datacache = DataCacheName(cachedir, datakey);
+        data = ReadDataCache(datacache, datakey, freqs);
+        if (NULL != data) {
+            printf("# Found prepared alignment in cache %s\n", datacache);
+        }
+    }
+    if (NULL == data) {
+        data = ReadData(seqfile, gencode, ambiguity);
+    }
+    if (NULL == data) {
+        puts("Problem reading data file. Aborting\n");
+        exit(EXIT_FAILURE);
+    }
+
+    printf("# Read seqfile file %s. %d species, %d sites.\n", seqfile,
+           data->n_sp, data->n_pts);
+
+    ProfileStop(prof, Phase_Read);
+
+    if (NULL == *freqs) {
+        /*  Get frequencies from data
+         */
+        ProfileStart(prof, Phase_Freqs);
+        *freqs = GetBaseFreqs(data, 0);
+        ProfileStop(prof, Phase_Freqs);
+
+        /*  Calculations are in terms of Q coordinates (enumerated sense
+         * codons)
+         */
+        ProfileStart(prof, Phase_Read);
+        ConvertCodonToQcoord(data);
+        ProfileStop(prof, Phase_Read);
+        if (NULL != datacache) {
+            if (0 == WriteDataCache(datacache, datakey, data, *freqs)) {
+                printf("# Saved prepared alignment to cache %s\n",
+                       datacache);
+            } else {
+                warnx("Failed to save prepared alignment to cache %s",
+                      datacache);
+            }
+        }
+    }
+    free(datacache);
+
+    return data;
+}
+
+DATA_SET *ReadData(const char *name, const int gencode, const bool ambiguity)
+{
+    DATA_SET *data;
+
+    assert(NULL != name);
+
+    /* Read nucleotides straight into codons
+     */
+    data = read_codon_data(name, gencode, ambiguity);
+    if (NULL == data)
+        return NULL;
+
+    /*  Check if sequence contains stop codons  */
+    int nstop = count_alignment_stops(data);
+    if (0 != nstop) {
+        fputs("Alignment contains stop codons. Cannot continue.\n", stderr);
+        exit(EXIT_FAILURE);
+    }
+    return CompressData(data);
+}
+
+/*  Sort and compress codon data, then mask trivial observations. Data is
+ * freed unless returned because a step failed.
+ */
+DATA_SET *CompressData(DATA_SET * data)
+{
+    DATA_SET *tmp;
+
+    /*  Sort and compress sequence to remove redundency
+     */
+    sort_data(data);
+    tmp = compress_data(data);
+    if (NULL == tmp) {
+        puts("Error compressing sequence! Returning uncompressed set");
+        return data;
+    }
+    FreeDataSet(data);
+
+    /*  Find and mask trivial observations in data. Likelihood for these
+     * observations can be calculated trivially without using the pruning
+     * algorithm
+     */
     data = RemoveTrivialObs(tmp);
     if (NULL == data) {
         puts("Error removing trivial observations (single chars and all gaps).\nReturning compressed sequence.\n");
@@ -471,8 +1831,9 @@ DATA_SET *ReadData(const char *name, const int gencode)
 
 double OptimizeTree(const DATA_SET * data, TREE * tree, double *freqs,
                     double *x, const unsigned int freqtype, const int codonf,
-                    const enum model_branches branopt, const bool writeTmp,
-                    const bool recover)
+                    const enum model_branches branopt,
+                    const CODONFUNCS * cfuncs, const bool writeTmp,
+                    const bool recover, struct profile *prof)
 {
     struct single_fun *info;
     double *bd, fx;
@@ -489,7 +1850,7 @@ double OptimizeTree(const DATA_SET * data, TREE * tree, double *freqs,
     const unsigned int nbr = tree->n_br;
     model =
         NewCodonModel_full(data->gencode, x[nbr + 0], x[nbr + 1], freqs, codonf,
-                           freqtype, branopt);
+                           freqtype, branopt, cfuncs);
     OOM(model);
     model->exact_obs = 1;
 
@@ -529,6 +1890,7 @@ double OptimizeTree(const DATA_SET * data, TREE * tree, double *freqs,
     Optimize(x, nparam, GradLike_Full, CalcLike_Single, &fx, (void *)info, bd,
              writeTmp, recover);
 
+    ProfileCounts(prof, Phase_Optimise, model);
     FreeModel(model);
     free(bd);
     free(info->p);
@@ -537,45 +1899,170 @@ double OptimizeTree(const DATA_SET * data, TREE * tree, double *freqs,
     return fx;
 }
 
-struct selectioninfo *CalculateSelection(TREE * tree, DATA_SET * data,
-                                         double kappa, double omega,
-                                         double *freqs, const double ldiff,
-                                         const unsigned int freqtype,
-                                         const int codonf)
+/*  Fit branch lengths and kappa of the HKY nucleotide model to the three
+ * positions of the codon data and use them, multiplied by three to convert
+ * to substitutions per codon, as starting values for the branches marked
+ * invalid. Other branches start from a third of their length and are left
+ * unchanged. Returns the same likelihood scale as OptimizeTree.
+ */
+double NucleotideBranchLengths(const DATA_SET * data, TREE * tree,
+                               const bool *invalid, struct profile *prof)
 {
-    double x[1];
-    struct selectioninfo *selinfo;
-    bool positive;
-    double factor;
-    MODEL *model;
-    DATA_SET *data_single;
     struct single_fun *info;
-    double bd[2];
-    double *likelihood_grid;
-    int col;
-    int *done_usite;
-    int species, bufflen;
+    double *x, *bd, *pi, fx;
+    DATA_SET *nucdata;
+    MODEL *model;
 
-    CheckIsTree(tree);
     CheckIsDataSet(data);
-    assert(kappa >= 0.);
-    assert(omega >= 0.);
-    assert(freqs != NULL);
+    CheckIsTree(tree);
+    assert(NULL != invalid);
 
-    const int dosupport = (0.0 == ldiff) ? 0 : 1;
+    nucdata = ConvertQcoordToNuc(data);
+    pi = GetBaseFreqs(nucdata, 0);
+    const double kappa = 2.0;
+    model = NewNNNModel_full(desc_HKY, &kappa, 1, pi, 0, tree->n_br, 0, 0);
+    OOM(model);
+    model->exact_obs = 1;
 
-    selinfo = malloc(sizeof(struct selectioninfo));
-    OOM(selinfo);
-    selinfo->llike_neu = calloc(data->n_pts, sizeof(double));
-    OOM(selinfo->llike_neu);
-    selinfo->llike_max = calloc(data->n_pts, sizeof(double));
-    OOM(selinfo->llike_max);
-    selinfo->omega_max = calloc(data->n_pts, sizeof(double));
-    OOM(selinfo->omega_max);
-    if (dosupport) {
-        selinfo->lbound = calloc(data->n_pts, sizeof(double));
-        OOM(selinfo->lbound);
-        selinfo->ubound = calloc(data->n_pts, sizeof(double));
+    const unsigned int nbr = tree->n_br;
+    const unsigned int nparam = nbr + model->nparam;
+    x = calloc(nparam, sizeof(double));
+    bd = calloc(2 * nparam, sizeof(double));
+    OOM(x);
+    OOM(bd);
+    for (unsigned int i = 0; i < nparam; i++) {
+        bd[i] = 1e-8;
+        bd[i + nparam] = 50.;
+    }
+    for (unsigned int bran = 0; bran < nbr; bran++) {
+        x[bran] = (tree->branches[bran])->blength[0] / 3.;
+        if (x[bran] <= bd[bran])
+            x[bran] = bd[bran] + 1e-5;
+    }
+    x[nbr] = kappa;
+
+    info = calloc(1, sizeof(struct single_fun));
+    OOM(info);
+    info->tree = tree;
+    info->p = calloc(nucdata->n_pts * 2, sizeof(double));
+    OOM(info->p);
+    info->model = model;
+
+    add_data_to_tree(nucdata, tree, model);
+    fx = CalcLike_Single(x, info);
+    Optimize(x, nparam, GradLike_Full, CalcLike_Single, &fx, (void *)info, bd,
+             false, false);
+    printf("# Starting branch lengths from nucleotide model. lnL = %.3f, kappa = %f\n",
+           fx, x[nbr]);
+
+    for (unsigned int bran = 0; bran < nbr; bran++) {
+        if (!invalid[bran])
+            continue;
+        NODE *node = tree->branches[bran];
+        node->blength[0] = 3. * x[bran];
+        const int a = find_connection(node->branch[0], node);
+        assert(-1 != a);
+        (node->branch[0])->blength[a] = node->blength[0];
+    }
+
+    ProfileCounts(prof, Phase_Optimise, model);
+    FreeModel(model);
+    FreeDataSet(nucdata);
+    free(pi);
+    free(bd);
+    free(x);
+    free(info->p);
+    free(info);
+
+    return fx;
+}
+
+/*  Likelihood at the current parameters, on the same scale as that returned
+ * by OptimizeTree.
+ */
+double TreeLikelihood(const DATA_SET * data, TREE * tree, const double *freqs,
+                      const double kappa, const double omega,
+                      const unsigned int freqtype, const int codonf,
+                      const CODONFUNCS * cfuncs, struct profile *prof)
+{
+    struct single_fun *info;
+    MODEL *model;
+    double fx;
+
+    CheckIsDataSet(data);
+    CheckIsTree(tree);
+    assert(NULL != freqs);
+
+    model =
+        NewCodonModel_full(data->gencode, kappa, omega, freqs, codonf,
+                           freqtype, Branches_Fixed, cfuncs);
+    OOM(model);
+    model->exact_obs = 1;
+
+    info = calloc(1, sizeof(struct single_fun));
+    OOM(info);
+    info->tree = tree;
+    info->p = calloc(data->n_pts * 2, sizeof(double));
+    OOM(info->p);
+    info->model = model;
+
+    add_data_to_tree(data, tree, model);
+    const double x[2] = { kappa, omega };
+    fx = CalcLike_Single(x, info);
+
+    ProfileCounts(prof, Phase_Optimise, model);
+    FreeModel(model);
+    free(info->p);
+    free(info);
+
+    return fx;
+}
+
+struct selectioninfo *CalculateSelection(TREE * tree, DATA_SET * data,
+                                         double kappa, double omega,
+                                         double *freqs, const double ldiff,
+                                         const unsigned int freqtype,
+                                         const int codonf,
+                                         const CODONFUNCS * cfuncs,
+                                         const char *outprefix,
+                                         const bool writeTmp,
+                                         const bool recover,
+                                         struct sitecost_log *cost,
+                                         struct profile *prof)
+{
+    double x[1];
+    struct selectioninfo *selinfo;
+    bool positive;
+    double factor;
+    MODEL *model;
+    DATA_SET *data_single;
+    struct single_fun *info;
+    double bd[2];
+    double *likelihood_grid;
+    int col;
+    int *done_usite;
+    int species, bufflen;
+
+    CheckIsTree(tree);
+    CheckIsDataSet(data);
+    assert(kappa >= 0.);
+    assert(omega >= 0.);
+    assert(freqs != NULL);
+
+    const int dosupport = (0.0 == ldiff) ? 0 : 1;
+
+    selinfo = malloc(sizeof(struct selectioninfo));
+    OOM(selinfo);
+    selinfo->llike_neu = calloc(data->n_pts, sizeof(double));
+    OOM(selinfo->llike_neu);
+    selinfo->llike_max = calloc(data->n_pts, sizeof(double));
+    OOM(selinfo->llike_max);
+    selinfo->omega_max = calloc(data->n_pts, sizeof(double));
+    OOM(selinfo->omega_max);
+    if (dosupport) {
+        selinfo->lbound = calloc(data->n_pts, sizeof(double));
+        OOM(selinfo->lbound);
+        selinfo->ubound = calloc(data->n_pts, sizeof(double));
         OOM(selinfo->ubound);
     } else {
         selinfo->lbound = NULL;
@@ -583,12 +2070,20 @@ struct selectioninfo *CalculateSelection(TREE * tree, DATA_SET * data,
     }
     selinfo->type = calloc(data->n_pts, sizeof(int));
     OOM(selinfo->type);
+    selinfo->screened = calloc(data->n_pts, sizeof(int));
+    OOM(selinfo->screened);
 
     positive = *(bool *) GetOption("positive_only");
+    const double screen = *(double *)GetOption("screen");
+    const double screen_stat = positive ? SCREEN_STAT_POSITIVE : SCREEN_STAT;
+    int nscreened = 0;
+    int nboundary = 0;
+    const double support_pval = *(double *)GetOption("support_pval");
+    int nsupport_search = 0, nsupport_eval = 0, nsupport_skipped = 0;
 
     model =
         NewCodonModel_single(data->gencode, kappa, omega, freqs, codonf,
-                             freqtype);
+                             freqtype, cfuncs);
     OOM(model);
     model->exact_obs = 1;
 
@@ -605,6 +2100,9 @@ struct selectioninfo *CalculateSelection(TREE * tree, DATA_SET * data,
     //  One site data set to be used in all optimizations
     data_single = CreateDataSet(1, data->n_sp);
     OOM(data_single);
+    data_single->seq_type = data->seq_type;
+    data_single->gencode = data->gencode;
+    data_single->n_bases = data->n_bases;
     for (species = 0; species < data->n_sp; species++) {
         bufflen = 1 + strlen(data->sp_name[species]);
         data_single->sp_name[species] = malloc(bufflen * sizeof(char));
@@ -630,6 +2128,7 @@ struct selectioninfo *CalculateSelection(TREE * tree, DATA_SET * data,
      * sites for a single omega (due to memory effects rather than algorithms).
      */
     puts("# Calculating initial estimates of sitewise conservation");
+    ProfileStart(prof, Phase_Grid);
     add_data_to_tree(data, tree, model);
     const VEC omega_grid = create_grid(GRIDSIZE, positive);
 
@@ -652,19 +2151,86 @@ struct selectioninfo *CalculateSelection(TREE * tree, DATA_SET * data,
         likelihood_neutral[pt] =
             -(tree->tree)->scalefactor[pt] - log(info->p[pt]);
     }
+    ProfileCounts(prof, Phase_Grid, model);
+    ProfileStop(prof, Phase_Grid);
 
     puts("# Calculating conservation at each site. This may take a while.");
+    ProfileStart(prof, Phase_Sitewise);
     col = 0;
     done_usite = calloc(data->n_unique_pts, sizeof(int));
     for (unsigned int site = 0; site < data->n_unique_pts; site++) {
         done_usite[site] = -1;
     }
 
+    /*  Results for unique sites completed by a previous run are read from
+     * the checkpoint, which is rewritten so new results can be appended.
+     * The checkpoint is identified by the options and the contents of every
+     * site pattern, in order.
+     */
+    const char *cachedir = (char *)GetOption("cachedir");
+    uint64_t *pattern_keys = NULL;
+    if (recover || writeTmp || cachedir[0] != '\0') {
+        pattern_keys = PatternKeys(data);
+    }
+    struct checkpoint_header ckpt_hdr = {
+        CHECKPOINT_MAGIC, data->n_sp, data->n_unique_pts, positive,
+        kappa, omega, ldiff, screen, support_pval,
+        (NULL != pattern_keys) ? fnv1a_hash(FNV_OFFSET, pattern_keys,
+                                            data->n_unique_pts *
+                                            sizeof(uint64_t)) : 0
+    };
+    struct checkpoint_record *ckpt = NULL;
+    FILE *ckpt_fp = NULL;
+    if (recover) {
+        int nrecovered = 0;
+        ckpt = read_checkpoint(outprefix, &ckpt_hdr, &nrecovered);
+        printf("# Recovered %d of %d unique sites from checkpoint\n",
+               nrecovered, data->n_unique_pts);
+    }
+
+    /*  Results for site patterns seen in earlier runs with the same tree,
+     * model and options.
+     */
+    FILE *sitecache_fp = NULL;
+    if (cachedir[0] != '\0') {
+        const double params[] = { kappa, omega, ldiff, screen, support_pval };
+        const int nucleof = *(int *)GetOption("nucleof");
+        const int aminof = *(int *)GetOption("aminof");
+        const int settings[] = { data->gencode, codonf, freqtype, positive,
+            nucleof, aminof
+        };
+        //  Parameter files only matter if empirical models are used
+        char *sitecache =
+            SiteCacheName(cachedir, tree, freqs, params,
+                          sizeof(params) / sizeof(double), settings,
+                          sizeof(settings) / sizeof(int),
+                          nucleof ? (char *)GetOption("nucfile") : "",
+                          aminof ? (char *)GetOption("aminofile") : "");
+        if (NULL == ckpt) {
+            ckpt = malloc(data->n_unique_pts * sizeof(struct checkpoint_record));
+            OOM(ckpt);
+            for (int i = 0; i < data->n_unique_pts; i++) {
+                ckpt[i].pattern = -1;
+            }
+        }
+        const int nfound = read_sitecache(sitecache, pattern_keys,
+                                          data->n_unique_pts, ckpt);
+        printf("# Found %d of %d unique sites in sitewise cache %s\n", nfound,
+               data->n_unique_pts, sitecache);
+        sitecache_fp = open_sitecache(sitecache);
+        free(sitecache);
+    }
+    if (writeTmp) {
+        ckpt_fp = open_checkpoint(outprefix, &ckpt_hdr, ckpt,
+                                  data->n_unique_pts);
+    }
+
     for (unsigned int site = 0; site < data->n_pts; site++) {
         double fm, fn;
         double lb = 0.0, ub = HUGE_VAL;
         double omegam;
         int type;
+        int screened = 0;
 
         if (col % 50 == 0) {
             printf("\n%4d:  ", col + 1);
@@ -695,9 +2261,21 @@ struct selectioninfo *CalculateSelection(TREE * tree, DATA_SET * data,
                 ub = selinfo->ubound[usite];
             }
             type = selinfo->type[usite];
+            screened = selinfo->screened[usite];
             //printf ("%5d same as site %d\n",site,usite);
+        } else if (NULL != ckpt && -1 != ckpt[data->index[site]].pattern) {
+            const struct checkpoint_record *rec = ckpt + data->index[site];
+            fn = rec->llike_neu;
+            fm = rec->llike_max;
+            omegam = rec->omega_max;
+            lb = rec->lbound;
+            ub = rec->ubound;
+            type = rec->type;
+            screened = rec->screened;
+            done_usite[data->index[site]] = site;
         } else {
             int start;
+            const uint64_t cost_start = ProfileClock();
             // General case
             CopySiteToDataSet(data, data_single, site);
             add_data_to_tree(data_single, tree, model);
@@ -713,10 +2291,6 @@ struct selectioninfo *CalculateSelection(TREE * tree, DATA_SET * data,
                 errx(EXIT_FAILURE, "Non-finite x[0] detected");
             }
 
-            int neval = 0;
-            fm = linemin_1d(CalcLike_Single, x, (void *)info, bd[0], bd[1],
-                            1e-5, &neval);
-            omegam = model->param[1];
             if (IsConserved(data, site)) {
                 type = 4;
             } else if (IsSiteSynonymous(data, site, data->gencode)) {
@@ -725,32 +2299,135 @@ struct selectioninfo *CalculateSelection(TREE * tree, DATA_SET * data,
                 type = 3;
             }
 
-            /*  Find confidence interval for omega (actually "support") */
-            if (dosupport) {
-                neval = 0;
-                if (likelihood_grid[data->index[site] * GRIDSIZE] - fm <=
-                    ldiff / 2.) {
-                    lb = (double)positive;
-                } else {
-                    const double initial_lb = (double)positive;
-                    Set_CalcLike_Wrapper(CalcLike_Single, fm + ldiff / 2.);
-                    lb = find_root(initial_lb, omegam, CalcLike_Wrapper,
-                                   (void *)info, NULL, NULL, 1e-3, &neval);
+            /*  Likelihood at constant and synonymous sites is monotone in
+             * omega, so the optimum is on the lower boundary. Verify from the
+             * grid and the sign of the derivative at the boundary, where the
+             * likelihood is already known from the grid.
+             */
+            const double *lrow = likelihood_grid + data->index[site] * GRIDSIZE;
+            int neval = 0, nroot = 0;
+            int boundary = 0;
+            if ((2 == type || 4 == type) && 0 == start
+                && IsNondecreasing(lrow, GRIDSIZE)) {
+                x[0] = vget(omega_grid, 0) + BOUNDARY_DELTA;
+                boundary = (CalcLike_Single(x, info) > lrow[0]) ? 1 : 0;
+                neval++;
+                x[0] = vget(omega_grid, 0);
+            }
+
+            /*  Screening, a heuristic. Refine loosely and skip the exact
+             * pass if the statistic, from the grid and then from the loose
+             * refit, falls short of significance by more than the margin
+             * given. Both are only lower bounds on the exact statistic, so
+             * the margin is what guards against missing a significant site.
+             */
+            if (boundary) {
+                fm = lrow[0];
+                omegam = x[0];
+                nboundary++;
+            } else {
+                if (screen > 0.
+                    && 2. * (fn - lrow[start]) + screen < screen_stat) {
+                    fm = linemin_1d(CalcLike_Single, x, (void *)info, bd[0],
+                                    bd[1], SCREEN_TOL, &neval);
+                    screened = (2. * (fn - fm) + screen < screen_stat) ? 1 : 0;
                 }
+                if (!screened) {
+                    fm = linemin_1d(CalcLike_Single, x, (void *)info, bd[0],
+                                    bd[1], 1e-5, &neval);
+                }
+                omegam = model->param[1];
+            }
+            double pval_site = pchisq((fn > fm) ? 2. * (fn - fm) : 0., 1., 1);
+            if (positive && pval_site + DBL_EPSILON < 1.) {
+                pval_site /= 2.;
+            }
 
-                if (likelihood_grid[data->index[site] * GRIDSIZE + GRIDSIZE - 1]
-                    - fm <= ldiff / 2.) {
-                    ub = 99.;
-                } else {
-                    Set_CalcLike_Wrapper(CalcLike_Single, fm + ldiff / 2.);
-                    neval = 0;
-                    ub = find_root(omegam, 99., CalcLike_Wrapper, (void *)info,
-                                   NULL, NULL, 1e-3, &neval);
+            /*  Find confidence interval for omega (actually "support") */
+            if (dosupport && screened) {
+                GridSupport(lrow, omega_grid, start, fm, ldiff, positive, &lb,
+                            &ub);
+            } else if (dosupport && pval_site > support_pval) {
+                GridSupport(lrow, omega_grid, start, fm, ldiff, positive, &lb,
+                            &ub);
+                nsupport_skipped++;
+            } else if (dosupport) {
+                /*  Bracket each bound between the grid points either side of
+                 * the crossing, reusing their cached likelihoods. The optimum
+                 * is used as the inner end if it is nearer than the grid point.
+                 */
+                const double thresh = fm + ldiff / 2.;
+                struct like_offset offset = { CalcLike_Single, info, thresh };
+                lb = (double)positive;
+                ub = 99.;
+                for (int dir = -1; dir <= 1; dir += 2) {
+                    const int out =
+                        GridCrossing(lrow, GRIDSIZE, start, thresh, dir);
+                    if (-1 == out) {
+                        continue;
+                    }
+                    double xout = vget(omega_grid, out);
+                    double fout = lrow[out] - thresh;
+                    double xin = vget(omega_grid, out - dir);
+                    double fin = lrow[out - dir] - thresh;
+                    if (fin > 0. || dir * (xin - omegam) < 0.) {
+                        xin = omegam;
+                        fin = fm - thresh;
+                    }
+                    int nsearch = 0;
+                    const double bound = (-1 == dir) ?
+                        find_root(xout, xin, CalcLike_Wrapper, &offset,
+                                  &fout, &fin, 1e-3, &nsearch) :
+                        find_root(xin, xout, CalcLike_Wrapper, &offset,
+                                  &fin, &fout, 1e-3, &nsearch);
+                    if (-1 == dir) {
+                        lb = bound;
+                    } else {
+                        ub = bound;
+                    }
+                    nsupport_search++;
+                    nsupport_eval += nsearch;
+                    nroot += nsearch;
                 }
             }
 
             assert(data->index[site] >= 0);
             done_usite[data->index[site]] = site;
+            nscreened += screened;
+
+            if (NULL != cost) {
+                fprintf(cost->fp, "%d\t%u\t%d\t%llu\t%d\t%d\t%d\t%g\t%g\t%g\t%s\n",
+                        cost->pattern + data->index[site] + 1,
+                        cost->site + site + 1, type,
+                        (unsigned long long)(ProfileClock() - cost_start),
+                        neval, nroot, start, bd[0], bd[1], omegam,
+                        boundary ? "Boundary" : (screened ? "Screened" : ""));
+            }
+
+            if (NULL != ckpt_fp) {
+                const struct checkpoint_record rec = {
+                    data->index[site], type, screened, fn, fm, omegam, lb, ub
+                };
+                if (fwrite(&rec, sizeof(rec), 1, ckpt_fp) != 1
+                    || fflush(ckpt_fp) != 0) {
+                    warnx("Failed to write to sitewise checkpoint");
+                    fclose(ckpt_fp);
+                    ckpt_fp = NULL;
+                }
+            }
+            if (NULL != sitecache_fp) {
+                const struct sitecache_record rec = {
+                    pattern_keys[data->index[site]],
+                    { data->index[site], type, screened, fn, fm, omegam, lb,
+                     ub }
+                };
+                if (fwrite(&rec, sizeof(rec), 1, sitecache_fp) != 1
+                    || fflush(sitecache_fp) != 0) {
+                    warnx("Failed to write to sitewise cache");
+                    fclose(sitecache_fp);
+                    sitecache_fp = NULL;
+                }
+            }
         }
 
         selinfo->llike_neu[site] = fn;
@@ -760,189 +2437,1419 @@ struct selectioninfo *CalculateSelection(TREE * tree, DATA_SET * data,
             selinfo->lbound[site] = lb;
             selinfo->ubound[site] = ub;
         }
-        selinfo->type[site] = type;
-        putchar('.');
-        fflush(stdout);
+        selinfo->type[site] = type;
+        selinfo->screened[site] = screened;
+        putchar('.');
+        fflush(stdout);
+    }
+    free(done_usite);
+    free(ckpt);
+    if (NULL != ckpt_fp) {
+        fclose(ckpt_fp);
+    }
+    free(pattern_keys);
+    if (NULL != sitecache_fp) {
+        fclose(sitecache_fp);
+    }
+    free(likelihood_grid);
+    free(likelihood_neutral);
+    free_vec(omega_grid);
+    ProfileCounts(prof, Phase_Sitewise, model);
+    ProfileStop(prof, Phase_Sitewise);
+    FreeModel(model);
+    FreeDataSet(data_single);
+    free(info->p);
+    free(info);
+    putchar('\n');
+    printf("# %d constant or synonymous unique sites have optimum on boundary\n",
+           nboundary);
+    if (screen > 0.) {
+        printf("# Screened %d of %d unique sites\n", nscreened,
+               data->n_unique_pts);
+    }
+    if (dosupport) {
+        /*  Seeding from the grid saves both end point evaluations of each
+         * search; skipped sites are assumed to have cost the average.
+         */
+        const int nsaved = 2 * nsupport_search
+            + ((nsupport_search > 0) ?
+               nsupport_skipped * 2 * nsupport_eval / nsupport_search : 0);
+        printf("# Support intervals: %d root searches, %d likelihood evaluations, approx. %d evaluations saved\n",
+               nsupport_search, nsupport_eval, nsaved);
+        if (nsupport_skipped > 0) {
+            printf("# Support intervals for %d unique sites with p-value above %g interpolated from grid\n",
+                   nsupport_skipped, support_pval);
+        }
+    }
+
+    return selinfo;
+}
+
+/*  Log of the cost of optimising each unique site pattern, or NULL if it
+ * cannot be opened.
+ */
+FILE *open_sitecost(const char *outprefix)
+{
+    assert(NULL != outprefix);
+
+    FILE *fp = fopen_with_suffix(outprefix, ".sitecost", "w");
+    if (NULL == fp) {
+        warnx("Failed to open per-site cost log");
+        return NULL;
+    }
+    fputs("Pattern\tSite\tType\tNs\tBrent\tRoot\tStart\tLower\tUpper\tOmega\tNote\n",
+          fp);
+    return fp;
+}
+
+/** Read sitewise results from a checkpoint
+
+@param outprefix Prefix of checkpoint file.
+@param hdr Header describing current analysis, which checkpoint must match.
+@param nrecovered Pointer to store number of unique sites recovered.
+@returns Array of records indexed by unique site, pattern -1 if not
+recovered, or NULL if there is no checkpoint.
+*/
+struct checkpoint_record *read_checkpoint(const char *outprefix,
+                                          const struct checkpoint_header *hdr,
+                                          int *nrecovered)
+{
+    assert(NULL != outprefix);
+    assert(NULL != hdr);
+    assert(NULL != nrecovered);
+
+    *nrecovered = 0;
+    FILE *fp = fopen_with_suffix(outprefix, CHECKPOINT_SUFFIX, "rb");
+    if (NULL == fp) {
+        warnx("No sitewise checkpoint to recover from");
+        return NULL;
+    }
+
+    struct checkpoint_header file_hdr;
+    if (fread(&file_hdr, sizeof(file_hdr), 1, fp) != 1
+        || file_hdr.magic != hdr->magic || file_hdr.n_sp != hdr->n_sp
+        || file_hdr.n_unique_pts != hdr->n_unique_pts
+        || file_hdr.positive != hdr->positive || file_hdr.ldiff != hdr->ldiff
+        || file_hdr.screen != hdr->screen
+        || file_hdr.support_pval != hdr->support_pval
+        || file_hdr.patterns != hdr->patterns
+        || fabs(file_hdr.kappa - hdr->kappa) > CHECKPOINT_TOL * hdr->kappa
+        || fabs(file_hdr.omega - hdr->omega) > CHECKPOINT_TOL * hdr->omega) {
+        errx(EXIT_FAILURE,
+             "Sitewise checkpoint does not match current analysis");
+    }
+
+    struct checkpoint_record *ckpt =
+        calloc(hdr->n_unique_pts, sizeof(struct checkpoint_record));
+    OOM(ckpt);
+    for (int i = 0; i < hdr->n_unique_pts; i++) {
+        ckpt[i].pattern = -1;
+    }
+
+    /*  A truncated record at the end is from an interrupted write */
+    struct checkpoint_record rec;
+    while (fread(&rec, sizeof(rec), 1, fp) == 1) {
+        if (rec.pattern < 0 || rec.pattern >= hdr->n_unique_pts) {
+            errx(EXIT_FAILURE, "Corrupt record in sitewise checkpoint");
+        }
+        if (-1 == ckpt[rec.pattern].pattern) {
+            (*nrecovered)++;
+        }
+        ckpt[rec.pattern] = rec;
+    }
+    fclose(fp);
+
+    return ckpt;
+}
+
+/** Start a checkpoint of sitewise results
+
+The new checkpoint is written under a temporary name and renamed over the
+old one, so recovered results are never lost if the run is interrupted
+while rewriting them.
+
+@param outprefix Prefix of checkpoint file.
+@param hdr Header describing current analysis.
+@param rec Records already recovered, or NULL.
+@param n Number of unique sites.
+@returns File to append new records to, or NULL on failure.
+*/
+FILE *open_checkpoint(const char *outprefix,
+                      const struct checkpoint_header *hdr,
+                      const struct checkpoint_record *rec, const int n)
+{
+    assert(NULL != outprefix);
+    assert(NULL != hdr);
+
+    char *file = malloc(strlen(outprefix) + strlen(CHECKPOINT_SUFFIX) + 1);
+    OOM(file);
+    sprintf(file, "%s%s", outprefix, CHECKPOINT_SUFFIX);
+    char *tmpname = malloc(strlen(file) + 32);
+    OOM(tmpname);
+    sprintf(tmpname, "%s.%ld.tmp", file, (long)getpid());
+
+    FILE *fp = fopen(tmpname, "wb");
+    if (NULL == fp) {
+        warnx("Failed to open sitewise checkpoint");
+        free(tmpname);
+        free(file);
+        return NULL;
+    }
+    bool ok = (fwrite(hdr, sizeof(*hdr), 1, fp) == 1);
+    for (int i = 0; ok && NULL != rec && i < n; i++) {
+        if (-1 != rec[i].pattern) {
+            ok = (fwrite(rec + i, sizeof(*rec), 1, fp) == 1);
+        }
+    }
+    if (!ok || fflush(fp) != 0 || 0 != rename(tmpname, file)) {
+        warnx("Failed to write to sitewise checkpoint");
+        fclose(fp);
+        remove(tmpname);
+        fp = NULL;
+    }
+    free(tmpname);
+    free(file);
+
+    return fp;
+}
+
+/*  Contents of a substitution parameter file, or its name if it cannot be
+ * read (the built-in default parameters are then used).
+ */
+static uint64_t hash_param_file(uint64_t h, const char *name)
+{
+    if (!fnv1a_hash_file(&h, name)) {
+        h = fnv1a_hash(h, name, strlen(name) + 1);
+    }
+    return h;
+}
+
+/*  Floating point values are hashed as printed to ten significant figures,
+ * so parameters read back from a file give the same name.
+ */
+char *SiteCacheName(const char *cachedir, const TREE * tree,
+                    const double *freqs, const double *params,
+                    const int nparams, const int *settings,
+                    const int nsettings, const char *nucfile,
+                    const char *aminofile)
+{
+    uint64_t h = FNV_OFFSET;
+    char buf[32];
+
+    assert(NULL != cachedir);
+    CheckIsTree(tree);
+    assert(NULL != freqs);
+    assert(NULL != params);
+    assert(NULL != settings);
+    assert(NULL != nucfile);
+    assert(NULL != aminofile);
+
+    char *topology = topology_string(tree);
+    h = fnv1a_hash(h, topology, strlen(topology) + 1);
+    free(topology);
+    for (int br = 0; br < tree->n_br; br++) {
+        sprintf(buf, "%.9e", (tree->branches[br])->blength[0]);
+        h = fnv1a_hash(h, buf, strlen(buf) + 1);
+    }
+    for (int i = 0; i < 64; i++) {
+        sprintf(buf, "%.9e", freqs[i]);
+        h = fnv1a_hash(h, buf, strlen(buf) + 1);
+    }
+    for (int i = 0; i < nparams; i++) {
+        sprintf(buf, "%.9e", params[i]);
+        h = fnv1a_hash(h, buf, strlen(buf) + 1);
+    }
+    h = fnv1a_hash(h, settings, nsettings * sizeof(int));
+    h = hash_param_file(h, nucfile);
+    h = hash_param_file(h, aminofile);
+
+    char *name = malloc(strlen(cachedir) + 32);
+    OOM(name);
+    sprintf(name, "%s/%016llx.sites", cachedir, (unsigned long long)h);
+    return name;
+}
+
+static int compare_species_name(const void *a, const void *b)
+{
+    return strcmp(**(char *const *const *)a, **(char *const *const *)b);
+}
+
+/*  Ambiguity codes are numbered as they are met in each data set, so hash
+ * the set of bases they stand for rather than the code.
+ */
+static uint64_t hash_observation(uint64_t h, const DATA_SET * data,
+                                 const int base)
+{
+    if (IsAmbiguous(base)) {
+        const uint64_t set = Ambiguity(data->ambig, base)->set;
+        h = fnv1a_hash(h, &set, sizeof(uint64_t));
+    } else {
+        h = fnv1a_hash(h, &base, sizeof(int));
+    }
+    return h;
+}
+
+/*  Hash of each unique site pattern. Species are taken in order of name, so
+ * the key does not depend on the order of sequences in the alignment.
+ */
+uint64_t *PatternKeys(const DATA_SET * data)
+{
+    CheckIsDataSet(data);
+
+    char *const **order = malloc(data->n_sp * sizeof(char *const *));
+    OOM(order);
+    for (int sp = 0; sp < data->n_sp; sp++) {
+        order[sp] = data->sp_name + sp;
+    }
+    qsort(order, data->n_sp, sizeof(char *const *), compare_species_name);
+
+    uint64_t *keys = malloc(data->n_unique_pts * sizeof(uint64_t));
+    OOM(keys);
+    for (int pt = 0; pt < data->n_unique_pts; pt++) {
+        uint64_t h = FNV_OFFSET;
+        for (int i = 0; i < data->n_sp; i++) {
+            const int sp = order[i] - data->sp_name;
+            h = fnv1a_hash(h, data->sp_name[sp], strlen(data->sp_name[sp]) + 1);
+            h = hash_observation(h, data, DATA_SEQ(data, sp, pt));
+        }
+        keys[pt] = h;
+    }
+    free(order);
+
+    return keys;
+}
+
+static int compare_key_index(const void *a, const void *b)
+{
+    const uint64_t ka = ((const uint64_t *)a)[0];
+    const uint64_t kb = ((const uint64_t *)b)[0];
+    return (ka > kb) - (ka < kb);
+}
+
+/** Read results for site patterns from the sitewise cache
+
+@param file Name of cache file.
+@param keys Keys of the n unique site patterns.
+@param rec Array of records indexed by unique site. Those with pattern -1
+are filled from the cache, where possible.
+@returns Number of unique sites found.
+*/
+int read_sitecache(const char *file, const uint64_t * keys, const int n,
+                   struct checkpoint_record *rec)
+{
+    assert(NULL != file);
+    assert(NULL != keys);
+    assert(NULL != rec);
+
+    FILE *fp = fopen(file, "rb");
+    if (NULL == fp) {
+        return 0;
+    }
+    int magic;
+    if (fread(&magic, sizeof(magic), 1, fp) != 1 || SITECACHE_MAGIC != magic) {
+        warnx("Ignoring invalid sitewise cache %s", file);
+        fclose(fp);
+        return 0;
+    }
+
+    /*  Sorted pairs of (key, unique site) for lookup */
+    uint64_t *lookup = malloc(2 * n * sizeof(uint64_t));
+    OOM(lookup);
+    for (int i = 0; i < n; i++) {
+        lookup[2 * i] = keys[i];
+        lookup[2 * i + 1] = i;
+    }
+    qsort(lookup, n, 2 * sizeof(uint64_t), compare_key_index);
+
+    int nfound = 0;
+    struct sitecache_record crec;
+    while (fread(&crec, sizeof(crec), 1, fp) == 1) {
+        const uint64_t *found = bsearch(&crec.key, lookup, n,
+                                        2 * sizeof(uint64_t),
+                                        compare_key_index);
+        if (NULL == found) {
+            continue;
+        }
+        /*  Identical patterns within a run share a key, so step back to the
+         * first and fill every one not already known.
+         */
+        while (found > lookup && found[-2] == crec.key) {
+            found -= 2;
+        }
+        for (; found < lookup + 2 * n && found[0] == crec.key; found += 2) {
+            const int pt = (int)found[1];
+            if (-1 == rec[pt].pattern) {
+                rec[pt] = crec.res;
+                rec[pt].pattern = pt;
+                nfound++;
+            }
+        }
+    }
+    free(lookup);
+    fclose(fp);
+
+    return nfound;
+}
+
+FILE *open_sitecache(const char *file)
+{
+    assert(NULL != file);
+
+    FILE *fp = fopen(file, "ab");
+    if (NULL == fp) {
+        warnx("Failed to open sitewise cache %s", file);
+        return NULL;
+    }
+    if (0 == ftell(fp)) {
+        const int magic = SITECACHE_MAGIC;
+        if (fwrite(&magic, sizeof(magic), 1, fp) != 1 || fflush(fp) != 0) {
+            warnx("Failed to write to sitewise cache %s", file);
+            fclose(fp);
+            return NULL;
+        }
+    }
+
+    return fp;
+}
+
+/*  Cumulative numbers of sites under selection at each level of significance,
+ * and those of positively selected sites that appear random.
+ */
+struct summary_counts {
+    int npos[4], ncons[4], dpos[4];
+};
+
+static void count_summary_site(struct summary_counts *counts,
+                               const double omegam, const double llikem,
+                               const double entropy, const double pval,
+                               const double pval_adj)
+{
+    const int random = IsRandomSite(0, &entropy, &llikem);
+    if (omegam > 1.) {
+        if (pval_adj < 0.01) {
+            counts->npos[0]++;
+            counts->dpos[0] += random;
+        }
+        if (pval_adj < 0.05) {
+            counts->npos[1]++;
+            counts->dpos[1] += random;
+        }
+        if (pval < 0.01) {
+            counts->npos[2]++;
+            counts->dpos[2] += random;
+        }
+        if (pval < 0.05) {
+            counts->npos[3]++;
+            counts->dpos[3] += random;
+        }
+    } else if (omegam < 1.) {
+        if (pval_adj < 0.01) {
+            counts->ncons[0]++;
+        }
+        if (pval_adj < 0.05) {
+            counts->ncons[1]++;
+        }
+        if (pval < 0.01) {
+            counts->ncons[2]++;
+        }
+        if (pval < 0.05) {
+            counts->ncons[3]++;
+        }
+    }
+}
+
+static void fprint_summary_counts(FILE * fp,
+                                  const struct summary_counts *counts)
+{
+    const int *npos = counts->npos, *ncons = counts->ncons;
+    const int *dpos = counts->dpos;
+
+    fprintf(fp, "# Positively selected sites (cumulative)\n");
+    fprintf(fp, "# Significance  Number sites  Number Random\n");
+    fprintf(fp, "# 99%% corrected  %5d   %5d\n", npos[0], dpos[0]);
+    fprintf(fp, "# 95%% corrected  %5d   %5d\n", npos[1], dpos[1]);
+    fprintf(fp, "# 99%%            %5d   %5d\n", npos[2], dpos[2]);
+    fprintf(fp, "# 95%%            %5d   %5d\n", npos[3], dpos[3]);
+    fputc('\n', fp);
+    fprintf(fp, "# Conserved sites (cumulative)\n");
+    fprintf(fp, "# Significance  Number sites\n");
+    fprintf(fp, "# 99%% corrected  %5d\n", ncons[0]);
+    fprintf(fp, "# 95%% corrected  %5d\n", ncons[1]);
+    fprintf(fp, "# 99%%            %5d\n", ncons[2]);
+    fprintf(fp, "# 95%%            %5d\n", ncons[3]);
+}
+
+static void fprint_results_header(FILE * fp, const int dosupport)
+{
+    if (dosupport) {
+        fputs
+            ("Site\tNeutral\tOptimal\tOmega\tLower\tUpper\tLrtStat\tPvalue\tAdjPvalue\tQvalue\tResult\tNote\n",
+             fp);
+    } else {
+        fputs
+            ("Site\tNeutral\tOptimal\tOmega\tLrtStat\tPvalue\tAdjPvalue\tQvalue\tResult\tNote\n",
+             fp);
+    }
+}
+
+/*  Line of results for a site, whose values are element i of selinfo */
+static void fprint_results_site(FILE * fp, const int site,
+                                const struct selectioninfo *selinfo,
+                                const int i, const double entropy,
+                                const double pval, const double pval_adj,
+                                const double qval)
+{
+    char result[7], sign;
+    const int dosupport = (NULL == selinfo->lbound) ? 0 : 1;
+
+    const char *note = OutString[selinfo->type[i]];
+    const char *screen_note = "";
+    if (selinfo->screened[i]) {
+        screen_note = ('\0' == note[0]) ? "Screened" : ",Screened";
+    }
+    double stat = 2. * (selinfo->llike_neu[i] - selinfo->llike_max[i]);
+    double stat_inf = 2. * (entropy - selinfo->llike_max[i]);
+    for (int j = 0; j < 6; j++) {
+        result[j] = ' ';
+    }
+    result[6] = '\0';
+    if (stat_inf < 6.63) {
+        result[5] = '!';
+    }
+    if (selinfo->omega_max[i] > 1.) {
+        sign = '+';
+    } else {
+        sign = '-';
+    }
+    if (pval <= 0.05)
+        result[0] = sign;
+    if (pval <= 0.01)
+        result[1] = sign;
+    if (pval_adj <= 0.05)
+        result[2] = sign;
+    if (pval_adj <= 0.01)
+        result[3] = sign;
+
+    if (dosupport) {
+        fprintf(fp,
+                "%d\t%.2f\t%.2f\t%.4f\t%.4f\t%.4f\t%.4f\t%.4e\t%.4e\t%.4e\t%s\t%s%s\n",
+                site + 1, selinfo->llike_neu[i], selinfo->llike_max[i],
+                selinfo->omega_max[i], selinfo->lbound[i], selinfo->ubound[i],
+                stat, pval, pval_adj, qval, result, note, screen_note);
+    } else {
+        fprintf(fp,
+                "%d\t%.2f\t%.2f\t%.4f\t%.4f\t%.4e\t%.4e\t%.4e\t%s\t%s%s\n",
+                site + 1, selinfo->llike_neu[i], selinfo->llike_max[i],
+                selinfo->omega_max[i], stat, pval, pval_adj, qval, result,
+                note, screen_note);
+    }
+}
+
+void fprint_results(FILE * fp, struct selectioninfo *selinfo,
+                    const double *entropy, const double *pval,
+                    const double *pval_adj, const int nsites)
+{
+    assert(NULL != fp);
+    assert(NULL != selinfo);
+    assert(NULL != entropy);
+    assert(NULL != pval);
+    assert(NULL != pval_adj);
+    assert(nsites > 0);
+
+    const int dosupport = (NULL == selinfo->lbound) ? 0 : 1;
+    assert(!dosupport || (NULL != selinfo->ubound && NULL != selinfo->lbound));
+    assert(dosupport || (NULL == selinfo->ubound && NULL == selinfo->lbound));
+
+    fprint_results_header(fp, dosupport);
+    for (int site = 0; site < nsites; site++) {
+        fprint_results_site(fp, site, selinfo, site, entropy[site], pval[site],
+                            pval_adj[site], pval_adj[site + nsites]);
+    }
+}
+
+double *CalculateEntropy(const DATA_SET * data, const double *freqs)
+{
+    int site;
+    double *entropy;
+    CheckIsDataSet(data);
+    assert(NULL != freqs);
+
+    entropy = malloc(data->n_pts * sizeof(double));
+    OOM(entropy);
+
+    for (site = 0; site < data->n_pts; site++) {
+        entropy[site] = SiteEntropy(data, site, freqs);
+    }
+
+    return entropy;
+}
+
+/*  P-value of the likelihood ratio test at one site */
+static double SitePvalue(const double lmax, const double lneu,
+                         const bool positive_only)
+{
+    double x = -2. * (lmax - lneu);
+    if (x < 0.)
+        x = 0.;
+    double pval = pchisq(x, 1., 1);
+
+    /*  If positive only, then pvals are from chisq-bar distribution
+     * (exactly half those from chisq_1).
+     */
+    if (positive_only && pval + DBL_EPSILON < 1.) {
+        pval /= 2.;
+    }
+    return pval;
+}
+
+double *CalculatePvals(const double *lmax, const double *lneu, const int n,
+                       const bool positive_only)
+{
+    int site;
+    double *pval;
+    assert(NULL != lmax);
+    assert(NULL != lneu);
+    assert(n > 1);
+
+    pval = malloc(n * sizeof(double));
+    OOM(pval);
+    for (site = 0; site < n; site++) {
+        pval[site] = SitePvalue(lmax[site], lneu[site], positive_only);
+    }
+
+    return pval;
+}
+
+/*  Adjust p-values for multiple comparisons. Only sites with a non-negative
+ * index (not all gaps or a single character) are counted.
+ */
+double *AdjustPvals(const double *pval, const int *index, const int n_pts)
+{
+    int site, idx;
+    int n_idx;
+    double *adj_tmp, *adj, *qval_tmp;
+    assert(NULL != pval);
+    assert(NULL != index);
+    assert(n_pts > 0);
+
+    adj = malloc(2 * n_pts * sizeof(double));
+    OOM(adj);
+
+    n_idx = 0;
+    for (site = 0; site < n_pts; site++) {
+        idx = index[site];
+        if (idx >= 0) {
+            adj[n_idx] = pval[site];
+            adj[n_idx + n_pts] = pval[site];
+            n_idx++;
+        }
+    }
+    if (0 == n_idx) {
+        //  No informative sites, nothing to adjust
+        for (site = 0; site < 2 * n_pts; site++) {
+            adj[site] = 1.;
+        }
+        return adj;
+    }
+
+    adj_tmp = Pvalue_adjust_StepUp(adj, n_idx, BONFERRONI);
+    qval_tmp = qvals_storey02(adj + n_pts, n_idx);
+
+    n_idx = 0;
+    for (site = 0; site < n_pts; site++) {
+        idx = index[site];
+        if (idx >= 0) {
+            adj[site] = adj_tmp[n_idx];
+            adj[site + n_pts] = qval_tmp[n_idx];
+            n_idx++;
+        } else {
+            adj[site] = 1.;
+            adj[site + n_pts] = 1.;
+        }
+    }
+
+    free(adj_tmp);
+    free(qval_tmp);
+    return adj;
+}
+
+/*  Fitted model, as at the top of the summary file */
+static void fprint_fit(FILE * fp, const struct fitinfo *fit)
+{
+    fprintf(fp, "Kappa = %8.6f\nOmega = %8.6f\n", fit->kappa, fit->omega);
+    fprintf(fp, "lnL = %.3f\n", fit->loglike);
+    fprintf(fp,
+            "Tree length = %4.2f, average branch length = %4.2f (min=%4.2f, max=%4.2f)\n",
+            fit->tree_length, fit->tree_length / fit->nbr, fit->min_blength,
+            fit->max_blength);
+}
+
+/*  Calculate p-values and write the results and summary files */
+void WriteResults(const char *outprefix, const struct fitinfo *fit,
+                  struct selectioninfo *selinfo, const double *entropy,
+                  const int *index, const int n_pts, const bool positive)
+{
+    assert(NULL != outprefix);
+    assert(NULL != fit);
+    assert(NULL != selinfo);
+    assert(NULL != entropy);
+    assert(NULL != index);
+
+    double *pval =
+        CalculatePvals(selinfo->llike_max, selinfo->llike_neu, n_pts, positive);
+    double *pval_adj = AdjustPvals(pval, index, n_pts);
+
+    FILE *results_fp = fopen_with_suffix(outprefix, ".res", "w");
+    if (NULL != results_fp) {
+        fprint_results(results_fp, selinfo, entropy, pval, pval_adj, n_pts);
+        fclose(results_fp);
+    }
+
+    FILE *summary_fp = fopen_with_suffix(outprefix, ".summary", "w");
+    if (NULL != summary_fp) {
+        fprint_fit(summary_fp, fit);
+        fprint_summary(summary_fp, selinfo, entropy, pval, pval_adj, n_pts);
+        fclose(summary_fp);
+    }
+
+    fprint_summary(stdout, selinfo, entropy, pval, pval_adj, n_pts);
+    free(pval_adj);
+    free(pval);
+}
+
+/*  Which unique site patterns belong to a shard, either as a contiguous range
+ * or every nshard-th pattern (stripe). Patterns are sorted, so striping tends
+ * to balance the work better.
+ */
+int *ShardPatterns(const int n_unique_pts, const int shard, const int nshard,
+                   const bool stripe)
+{
+    assert(n_unique_pts > 0);
+    assert(shard >= 0 && shard < nshard);
+
+    int *inshard = calloc(n_unique_pts, sizeof(int));
+    OOM(inshard);
+    for (int pt = 0; pt < n_unique_pts; pt++) {
+        if (stripe) {
+            inshard[pt] = (pt % nshard == shard);
+        } else {
+            inshard[pt] = ((long)pt * nshard / n_unique_pts == shard);
+        }
+    }
+    return inshard;
+}
+
+/*  Record of partial results for a site, whose values are element i of
+ * selinfo.
+ */
+static void fprint_part_record(FILE * fp, const int site,
+                               const struct selectioninfo *selinfo,
+                               const int i, const double entropy)
+{
+    const int dosupport = (NULL == selinfo->lbound) ? 0 : 1;
+    fprintf(fp, "%d %d %d %.17e %.17e %.17e %.17e %.17e %.17e\n", site,
+            selinfo->type[i], selinfo->screened[i], selinfo->llike_neu[i],
+            selinfo->llike_max[i], selinfo->omega_max[i],
+            dosupport ? selinfo->lbound[i] : 0.,
+            dosupport ? selinfo->ubound[i] : 0., entropy);
+}
+
+/*  Write partial results for the sites of a shard. Trivial sites (all gaps or
+ * a single character) are written by shard zero.
+ */
+void WriteShard(const char *outprefix, const int shard, const int nshard,
+                const struct fitinfo *fit, const struct selectioninfo *selinfo,
+                const double *entropy, const DATA_SET * data,
+                const int *inshard, const bool positive)
+{
+    assert(NULL != outprefix);
+    assert(NULL != fit);
+    assert(NULL != selinfo);
+    assert(NULL != entropy);
+    assert(NULL != inshard);
+    CheckIsDataSet(data);
+
+    FILE *fp = fopen_with_suffix(outprefix, ".part", "w");
+    if (NULL == fp) {
+        errx(EXIT_FAILURE, "Failed to open %s.part for writing", outprefix);
+    }
+
+    const int dosupport = (NULL == selinfo->lbound) ? 0 : 1;
+    fprintf(fp, "%s %d %d %d %d %d\n", SHARD_MAGIC, shard, nshard,
+            data->n_pts, dosupport, positive ? 1 : 0);
+    fprintf(fp, "%.17e %.17e %.17e %.17e %.17e %.17e %d\n", fit->kappa,
+            fit->omega, fit->loglike, fit->tree_length, fit->min_blength,
+            fit->max_blength, fit->nbr);
+    for (int site = 0; site < data->n_pts; site++) {
+        const int idx = data->index[site];
+        if ((idx >= 0 && !inshard[idx]) || (idx < 0 && 0 != shard)) {
+            continue;
+        }
+        fprint_part_record(fp, site, selinfo, site, entropy[site]);
+    }
+    fclose(fp);
+    printf("# Written partial results to %s.part\n", outprefix);
+}
+
+/*  Next record of partial results, as written by fprint_part_record.
+ * Returns the number of fields read, as fscanf.
+ */
+static int fscan_part_record(FILE * fp, struct part_record *rec)
+{
+    return fscanf(fp, "%d %d %d %le %le %le %le %le %le", &rec->site,
+                  &rec->type, &rec->screened, &rec->llike_neu,
+                  &rec->llike_max, &rec->omega_max, &rec->lbound,
+                  &rec->ubound, &rec->entropy);
+}
+
+static void fprint_stream_header(FILE * fp, const struct stream_header *hdr)
+{
+    fprintf(fp, "%s %016llx %d %.17e %.17e\n", STREAM_MAGIC,
+            (unsigned long long)hdr->key, hdr->n_pts, hdr->kappa, hdr->omega);
+}
+
+/*  Returns zero if the file does not start with a valid header */
+static int fscan_stream_header(FILE * fp, struct stream_header *hdr)
+{
+    char magic[16];
+    unsigned long long key;
+    if (fscanf(fp, "%15s %llx %d %le %le", magic, &key, &hdr->n_pts,
+               &hdr->kappa, &hdr->omega) != 5
+        || strcmp(magic, STREAM_MAGIC) != 0 || fgetc(fp) != '\n') {
+        return 0;
+    }
+    hdr->key = key;
+    return 1;
+}
+
+/*  Read the partial results of one shard into res. The arrays of res are
+ * allocated when reading the first shard, whose header the others must match.
+ */
+void ReadShard(const char *name, const int shard, const int nshard,
+               struct shard_results *res)
+{
+    assert(NULL != name);
+    assert(NULL != res);
+
+    FILE *fp = fopen(name, "r");
+    if (NULL == fp) {
+        errx(EXIT_FAILURE, "Failed to open partial results %s", name);
+    }
+    char magic[16];
+    int file_shard, file_nshard, file_npts, file_support, file_positive;
+    struct fitinfo file_fit;
+    if (fscanf(fp, "%15s %d %d %d %d %d", magic, &file_shard,
+               &file_nshard, &file_npts, &file_support, &file_positive) != 6
+        || strcmp(magic, SHARD_MAGIC) != 0 || file_shard != shard
+        || file_nshard != nshard || file_npts <= 0
+        || fscanf(fp, "%le %le %le %le %le %le %d", &file_fit.kappa,
+                  &file_fit.omega, &file_fit.loglike,
+                  &file_fit.tree_length, &file_fit.min_blength,
+                  &file_fit.max_blength, &file_fit.nbr) != 7) {
+        errx(EXIT_FAILURE, "Invalid header in partial results %s", name);
+    }
+
+    if (NULL == res->selinfo) {
+        const int n_pts = file_npts;
+        struct selectioninfo *selinfo = calloc(1, sizeof(struct selectioninfo));
+        OOM(selinfo);
+        res->fit = file_fit;
+        res->n_pts = n_pts;
+        res->dosupport = file_support;
+        res->positive = file_positive;
+        selinfo->llike_neu = calloc(n_pts, sizeof(double));
+        selinfo->llike_max = calloc(n_pts, sizeof(double));
+        selinfo->omega_max = calloc(n_pts, sizeof(double));
+        selinfo->type = calloc(n_pts, sizeof(int));
+        selinfo->screened = calloc(n_pts, sizeof(int));
+        res->entropy = calloc(n_pts, sizeof(double));
+        res->index = malloc(n_pts * sizeof(int));
+        OOM(selinfo->llike_neu);
+        OOM(selinfo->llike_max);
+        OOM(selinfo->omega_max);
+        OOM(selinfo->type);
+        OOM(selinfo->screened);
+        OOM(res->entropy);
+        OOM(res->index);
+        if (res->dosupport) {
+            selinfo->lbound = calloc(n_pts, sizeof(double));
+            selinfo->ubound = calloc(n_pts, sizeof(double));
+            OOM(selinfo->lbound);
+            OOM(selinfo->ubound);
+        }
+        for (int site = 0; site < n_pts; site++) {
+            res->index[site] = -INT_MAX;
+        }
+        res->selinfo = selinfo;
+    } else if (file_npts != res->n_pts || file_support != res->dosupport
+               || file_positive != res->positive
+               || file_fit.kappa != res->fit.kappa
+               || file_fit.omega != res->fit.omega) {
+        errx(EXIT_FAILURE, "Partial results %s are from a different analysis",
+             name);
+    }
+
+    struct selectioninfo *selinfo = res->selinfo;
+    struct part_record rec;
+    int nread;
+    while ((nread = fscan_part_record(fp, &rec)) == 9) {
+        const int site = rec.site;
+        if (site < 0 || site >= res->n_pts || rec.type < 0 || rec.type > 4) {
+            errx(EXIT_FAILURE, "Invalid site in partial results %s", name);
+        }
+        if (-INT_MAX != res->index[site]) {
+            errx(EXIT_FAILURE, "Site %d occurs more than once in shards",
+                 site + 1);
+        }
+        /*  Only sites not all gaps or single characters are counted
+         * when adjusting for multiple comparisons.
+         */
+        res->index[site] = (rec.type > 1) ? 0 : -1;
+        selinfo->type[site] = rec.type;
+        selinfo->screened[site] = rec.screened;
+        selinfo->llike_neu[site] = rec.llike_neu;
+        selinfo->llike_max[site] = rec.llike_max;
+        selinfo->omega_max[site] = rec.omega_max;
+        if (res->dosupport) {
+            selinfo->lbound[site] = rec.lbound;
+            selinfo->ubound[site] = rec.ubound;
+        }
+        res->entropy[site] = rec.entropy;
+    }
+    if (EOF != nread) {
+        errx(EXIT_FAILURE, "Error reading partial results %s", name);
+    }
+    fclose(fp);
+}
+
+/*  Check every site was read. */
+void CheckShardsComplete(const struct shard_results *res)
+{
+    assert(NULL != res);
+    for (int site = 0; site < res->n_pts; site++) {
+        if (-INT_MAX == res->index[site]) {
+            errx(EXIT_FAILURE, "Site %d is missing from shards", site + 1);
+        }
     }
-    free(done_usite);
-    free(likelihood_grid);
-    free(likelihood_neutral);
-    free_vec(omega_grid);
-    putchar('\n');
+}
 
-    return selinfo;
+void FreeSelectionInfo(struct selectioninfo *selinfo)
+{
+    if (NULL == selinfo) {
+        return;
+    }
+    free(selinfo->llike_neu);
+    free(selinfo->llike_max);
+    free(selinfo->omega_max);
+    free(selinfo->lbound);
+    free(selinfo->ubound);
+    free(selinfo->type);
+    free(selinfo->screened);
+    free(selinfo);
 }
 
-void fprint_results(FILE * fp, struct selectioninfo *selinfo,
-                    const double *entropy, const double *pval,
-                    const double *pval_adj, const int nsites)
+void FreeShardResults(struct shard_results *res)
 {
-    char result[7], sign;
+    if (NULL == res || NULL == res->selinfo) {
+        return;
+    }
+    FreeSelectionInfo(res->selinfo);
+    free(res->entropy);
+    free(res->index);
+    res->selinfo = NULL;
+}
 
-    assert(NULL != fp);
-    assert(NULL != selinfo);
-    assert(NULL != entropy);
-    assert(NULL != pval);
-    assert(NULL != pval_adj);
-    assert(nsites > 0);
+/*  Combine the partial results from all shards and write results and summary
+ * as a single run would, correcting for multiple comparisons over all sites.
+ */
+void MergeShards(const char *outprefix, const int nshard)
+{
+    assert(NULL != outprefix);
+    assert(nshard > 0);
+
+    struct shard_results res = { 0 };
+    char *name = malloc(strlen(outprefix) + 32);
+    OOM(name);
+    for (int shard = 0; shard < nshard; shard++) {
+        sprintf(name, "%s.shard%d.part", outprefix, shard);
+        ReadShard(name, shard, nshard, &res);
+    }
+    free(name);
+    CheckShardsComplete(&res);
+    printf("# Merged %d shards, %d sites\n", nshard, res.n_pts);
 
-    const int dosupport = (NULL == selinfo->lbound) ? 0 : 1;
-    assert(!dosupport || (NULL != selinfo->ubound && NULL != selinfo->lbound));
-    assert(dosupport || (NULL == selinfo->ubound && NULL == selinfo->lbound));
+    WriteResults(outprefix, &res.fit, res.selinfo, res.entropy, res.index,
+                 res.n_pts, res.positive);
+    FreeShardResults(&res);
+}
 
-    if (dosupport) {
-        fputs
-            ("Site\tNeutral\tOptimal\tOmega\tLower\tUpper\tLrtStat\tPvalue\tAdjPvalue\tQvalue\tResult\tNote\n",
-             fp);
-    } else {
-        fputs
-            ("Site\tNeutral\tOptimal\tOmega\tLrtStat\tPvalue\tAdjPvalue\tQvalue\tResult\tNote\n",
-             fp);
+/*  Key of a streamed analysis: the alignment, tree and every option that
+ * changes the sitewise results. Fitted parameters are checked separately,
+ * as they may differ slightly if the fit was itself recovered.
+ */
+static uint64_t stream_key(const char *seqfile, const TREE * tree,
+                           const int gencode, const bool ambiguity,
+                           const int blocksize, const double ldiff,
+                           const unsigned int freqtype, const int codonf)
+{
+    uint64_t h = FNV_OFFSET;
+    if (!fnv1a_hash_file(&h, seqfile)) {
+        err(EXIT_FAILURE, "Failed to read %s", seqfile);
     }
+    h = fnv1a_hash(h, tree->tstring, strlen(tree->tstring) + 1);
+    const double params[] = { ldiff, *(double *)GetOption("screen"),
+        *(double *)GetOption("support_pval")
+    };
+    const int settings[] = { gencode, ambiguity, blocksize, freqtype, codonf,
+        *(bool *) GetOption("positive_only"), *(int *)GetOption("nucleof"),
+        *(int *)GetOption("aminof")
+    };
+    h = fnv1a_hash(h, params, sizeof(params));
+    h = fnv1a_hash(h, settings, sizeof(settings));
+    return h;
+}
 
-    for (int site = 0; site < nsites; site++) {
-        double stat = 2. * (selinfo->llike_neu[site] - selinfo->llike_max[site]);
-        double stat_inf = 2. * (entropy[site] - selinfo->llike_max[site]);
-        for (int i = 0; i < 6; i++) {
-            result[i] = ' ';
-        }
-        result[6] = '\0';
-        if (stat_inf < 6.63) {
-            result[5] = '!';
-        }
-        if (selinfo->omega_max[site] > 1.) {
-            sign = '+';
-        } else {
-            sign = '-';
-        }
-        if (pval[site] <= 0.05)
-            result[0] = sign;
-        if (pval[site] <= 0.01)
-            result[1] = sign;
-        if (pval_adj[site] <= 0.05)
-            result[2] = sign;
-        if (pval_adj[site] <= 0.01)
-            result[3] = sign;
+/*  Reopen the results of an interrupted streamed analysis for appending,
+ * after dropping any incomplete record at the end. Returns NULL if there is
+ * nothing to recover and exits if the results are from another analysis.
+ */
+static FILE *recover_stream(const char *outprefix,
+                            const struct stream_header *hdr,
+                            int *nrecovered)
+{
+    char *name = malloc(strlen(outprefix) + strlen(STREAM_SUFFIX) + 1);
+    OOM(name);
+    sprintf(name, "%s%s", outprefix, STREAM_SUFFIX);
+    *nrecovered = 0;
+    FILE *fp = fopen(name, "r");
+    if (NULL == fp) {
+        warnx("No sitewise checkpoint to recover from");
+        free(name);
+        return NULL;
+    }
 
-        if (dosupport) {
-            fprintf(fp,
-                    "%d\t%.2f\t%.2f\t%.4f\t%.4f\t%.4f\t%.4f\t%.4e\t%.4e\t%.4e\t%s\t%s\n",
-                    site + 1, selinfo->llike_neu[site],
-                    selinfo->llike_max[site], selinfo->omega_max[site],
-                    selinfo->lbound[site], selinfo->ubound[site], stat,
-                    pval[site], pval_adj[site], pval_adj[site + nsites], result,
-                    OutString[selinfo->type[site]]);
-        } else {
-            fprintf(fp,
-                    "%d\t%.2f\t%.2f\t%.4f\t%.4f\t%.4e\t%.4e\t%.4e\t%s\t%s\n",
-                    site + 1, selinfo->llike_neu[site],
-                    selinfo->llike_max[site], selinfo->omega_max[site], stat,
-                    pval[site], pval_adj[site], pval_adj[site + nsites], result,
-                    OutString[selinfo->type[site]]);
-        }
+    struct stream_header file_hdr;
+    if (!fscan_stream_header(fp, &file_hdr) || file_hdr.key != hdr->key
+        || file_hdr.n_pts != hdr->n_pts
+        || fabs(file_hdr.kappa - hdr->kappa) > CHECKPOINT_TOL * hdr->kappa
+        || fabs(file_hdr.omega - hdr->omega) > CHECKPOINT_TOL * hdr->omega) {
+        errx(EXIT_FAILURE,
+             "Sitewise checkpoint does not match current analysis");
     }
+    /*  Only records ending in a newline were written completely */
+    struct part_record rec;
+    long end = ftell(fp);
+    while (*nrecovered < hdr->n_pts && fscan_part_record(fp, &rec) == 9
+           && fgetc(fp) == '\n' && rec.site == *nrecovered) {
+        (*nrecovered)++;
+        end = ftell(fp);
+    }
+    fclose(fp);
+
+    if (0 != truncate(name, end) || NULL == (fp = fopen(name, "a"))) {
+        err(EXIT_FAILURE, "Failed to recover sitewise checkpoint %s", name);
+    }
+    free(name);
+    return fp;
 }
 
-double *CalculateEntropy(const DATA_SET * data, const double *freqs)
+/*  Sitewise results for a block with no informative site patterns, where
+ * every site is all gaps or a codon in a single sequence. These are the
+ * results CalculateSelection gives such sites, found without the tree. The
+ * negative log-likelihood of the block is added to loglike if not NULL.
+ */
+static struct selectioninfo *TrivialSelection(const DATA_SET * data,
+                                              const double kappa,
+                                              const double omega,
+                                              const double *freqs,
+                                              const double ldiff,
+                                              const unsigned int freqtype,
+                                              const int codonf,
+                                              const CODONFUNCS * cfuncs,
+                                              double *loglike)
 {
-    int site;
-    double *entropy;
     CheckIsDataSet(data);
-    assert(NULL != freqs);
+    assert(0 == data->n_unique_pts);
 
-    entropy = malloc(data->n_pts * sizeof(double));
-    OOM(entropy);
+    MODEL *model =
+        NewCodonModel_single(data->gencode, kappa, omega, freqs, codonf,
+                             freqtype, cfuncs);
+    OOM(model);
 
-    for (site = 0; site < data->n_pts; site++) {
-        entropy[site] = SiteEntropy(data, site, freqs);
+    struct selectioninfo *selinfo = malloc(sizeof(struct selectioninfo));
+    OOM(selinfo);
+    selinfo->llike_neu = calloc(data->n_pts, sizeof(double));
+    selinfo->llike_max = calloc(data->n_pts, sizeof(double));
+    selinfo->omega_max = calloc(data->n_pts, sizeof(double));
+    selinfo->type = calloc(data->n_pts, sizeof(int));
+    selinfo->screened = calloc(data->n_pts, sizeof(int));
+    OOM(selinfo->llike_neu);
+    OOM(selinfo->llike_max);
+    OOM(selinfo->omega_max);
+    OOM(selinfo->type);
+    OOM(selinfo->screened);
+    selinfo->lbound = NULL;
+    selinfo->ubound = NULL;
+    if (0.0 != ldiff) {
+        selinfo->lbound = calloc(data->n_pts, sizeof(double));
+        selinfo->ubound = malloc(data->n_pts * sizeof(double));
+        OOM(selinfo->lbound);
+        OOM(selinfo->ubound);
     }
 
-    return entropy;
+    for (int site = 0; site < data->n_pts; site++) {
+        double f = 0.;
+        if (data->index[site] != -INT_MAX) {
+            f = -log(model->pi[-data->index[site] - 1]);
+            selinfo->type[site] = 1;
+        }
+        selinfo->llike_neu[site] = f;
+        selinfo->llike_max[site] = f;
+        selinfo->omega_max[site] = 1.;
+        if (NULL != selinfo->ubound) {
+            selinfo->ubound[site] = HUGE_VAL;
+        }
+        if (NULL != loglike) {
+            *loglike += f;
+        }
+    }
+    FreeModel(model);
+
+    return selinfo;
 }
 
-double *CalculatePvals(const double *lmax, const double *lneu, const int n,
-                       const bool positive_only)
+/*  Sitewise results for the alignment in seqfile, read in blocks of at most
+ * blocksize codons so only one block need be held in memory. The results of
+ * each block are appended to "<outprefix>.stream.part" as they are found,
+ * and the number of sites in the alignment is returned. If loglike is not
+ * NULL, it is set to the likelihood of the whole alignment, summed over
+ * blocks. With recover, sites already in "<outprefix>.stream.part" are not
+ * recalculated, only the block that was interrupted being repeated.
+ */
+int StreamSelection(TREE * tree, const char *seqfile, const int gencode,
+                    const bool ambiguity, const int blocksize, double kappa, double omega,
+                    double *freqs, const double ldiff,
+                    const unsigned int freqtype, const int codonf,
+                    const CODONFUNCS * cfuncs, const char *outprefix,
+                    const bool recover, double *loglike,
+                    struct profile *prof)
 {
-    int site;
-    double *pval;
-    double x;
-    assert(NULL != lmax);
-    assert(NULL != lneu);
-    assert(n > 1);
+    CheckIsTree(tree);
+    assert(NULL != seqfile);
+    assert(blocksize > 0);
+    assert(NULL != freqs);
+    assert(NULL != outprefix);
 
-    pval = malloc(n * sizeof(double));
-    OOM(pval);
-    for (site = 0; site < n; site++) {
-        x = -2. * (lmax[site] - lneu[site]);
-        if (x < 0.)
-            x = 0.;
-        pval[site] = pchisq(x, 1., 1);
+    ProfileStart(prof, Phase_Read);
+    struct codon_stream *stream = OpenCodonStream(seqfile, gencode, ambiguity);
+    ProfileStop(prof, Phase_Read);
+    if (NULL == stream) {
+        puts("Problem reading data file. Aborting\n");
+        exit(EXIT_FAILURE);
+    }
+    const int n_pts = CodonStreamLength(stream);
+    const struct stream_header hdr = {
+        stream_key(seqfile, tree, gencode, ambiguity, blocksize, ldiff,
+                   freqtype, codonf), n_pts, kappa, omega
+    };
+    int nrecovered = 0;
+    FILE *fp = NULL;
+    if (recover) {
+        fp = recover_stream(outprefix, &hdr, &nrecovered);
+        printf("# Recovered %d of %d sites from checkpoint\n", nrecovered,
+               n_pts);
+    }
+    if (NULL == fp) {
+        fp = fopen_with_suffix(outprefix, STREAM_SUFFIX, "w");
+        if (NULL == fp) {
+            errx(EXIT_FAILURE, "Failed to open %s%s for writing", outprefix,
+                 STREAM_SUFFIX);
+        }
+        fprint_stream_header(fp, &hdr);
+    }
+    /*  One cost log for the whole alignment */
+    struct sitecost_log cost = { NULL, 0, 0 };
+    if (*(int *)GetOption("sitecost")) {
+        cost.fp = open_sitecost(outprefix);
     }
 
-    /*  If positive only, then pvals are from chisq-bar distribution
-     * (exactly half those from chisq_1).
+    /*  CalculateSelection scales the tree, so lengths are restored after
+     * each block.
      */
-    if (positive_only) {
-        for (site = 0; site < n; site++) {
-            if (pval[site] + DBL_EPSILON < 1.) {
-                pval[site] /= 2.;
+    double *blengths = malloc(tree->n_br * sizeof(double));
+    OOM(blengths);
+    for (int bran = 0; bran < tree->n_br; bran++) {
+        blengths[bran] = (tree->branches[bran])->blength[0];
+    }
+    if (NULL != loglike) {
+        *loglike = 0.;
+    }
+
+    int offset = 0;
+    for (int block = 1;; block++) {
+        ProfileStart(prof, Phase_Read);
+        DATA_SET *data = ReadCodonBlock(stream, blocksize);
+        if (NULL != data) {
+            if (0 != count_alignment_stops(data)) {
+                fputs("Alignment contains stop codons. Cannot continue.\n",
+                      stderr);
+                exit(EXIT_FAILURE);
+            }
+            data = CompressData(data);
+            ConvertCodonToQcoord(data);
+        }
+        ProfileStop(prof, Phase_Read);
+        if (NULL == data) {
+            break;
+        }
+        /*  Blocks of trivial sites are written without using the tree */
+        const bool trivial = (0 == data->n_unique_pts);
+        if (NULL != loglike && !trivial) {
+            ProfileStart(prof, Phase_Optimise);
+            *loglike +=
+                TreeLikelihood(data, tree, freqs, kappa, omega, freqtype,
+                               codonf, cfuncs, prof);
+            ProfileStop(prof, Phase_Optimise);
+        }
+        if (offset + data->n_pts <= nrecovered) {
+            if (NULL != loglike && trivial) {
+                FreeSelectionInfo(TrivialSelection(data, kappa, omega, freqs,
+                                                   ldiff, freqtype, codonf,
+                                                   cfuncs, loglike));
+            }
+            offset += data->n_pts;
+            cost.site += data->n_pts;
+            cost.pattern += data->n_unique_pts;
+            FreeDataSet(data);
+            continue;
+        }
+        printf("# Block %d. Sites %d to %d of %d\n", block, offset + 1,
+               offset + data->n_pts, n_pts);
+        struct selectioninfo *selinfo;
+        if (trivial) {
+            selinfo = TrivialSelection(data, kappa, omega, freqs, ldiff,
+                                       freqtype, codonf, cfuncs, loglike);
+        } else {
+            selinfo =
+                CalculateSelection(tree, data, kappa, omega, freqs, ldiff,
+                                   freqtype, codonf, cfuncs, outprefix, false,
+                                   false, (NULL != cost.fp) ? &cost : NULL,
+                                   prof);
+            add_lengths_to_tree(tree, blengths);
+        }
+        cost.site += data->n_pts;
+        cost.pattern += data->n_unique_pts;
+
+        ProfileStart(prof, Phase_Output);
+        double *entropy = CalculateEntropy(data, freqs);
+        for (int site = 0; site < data->n_pts; site++) {
+            if (offset + site >= nrecovered) {
+                fprint_part_record(fp, offset + site, selinfo, site,
+                                   entropy[site]);
             }
         }
+        if (0 != fflush(fp)) {
+            err(EXIT_FAILURE, "Failed to write %s%s", outprefix,
+                STREAM_SUFFIX);
+        }
+        ProfileStop(prof, Phase_Output);
+
+        offset += data->n_pts;
+        free(entropy);
+        FreeSelectionInfo(selinfo);
+        FreeDataSet(data);
     }
+    assert(offset == n_pts);
 
-    return pval;
+    fclose(fp);
+    if (NULL != cost.fp) {
+        fclose(cost.fp);
+    }
+    free(blengths);
+    CloseCodonStream(stream);
+    return n_pts;
 }
 
-double *AdjustPvals(const double *pval, DATA_SET * data)
+/*  Write results and summary from the records of a streamed analysis, as a
+ * single run would. The correction for multiple comparisons needs the
+ * p-values of every site, so the records are read twice: first to collect
+ * the p-values, then to write the results a site at a time.
+ */
+void WriteStreamResults(const char *outprefix, const struct fitinfo *fit,
+                        const int n_pts, const int dosupport,
+                        const bool positive)
 {
-    int site, idx;
-    int n_idx;
-    double *adj_tmp, *adj, *qval_tmp;
-    assert(NULL != pval);
-    CheckIsDataSet(data);
+    assert(NULL != outprefix);
+    assert(NULL != fit);
+    assert(n_pts > 0);
 
-    adj = malloc(2 * data->n_pts * sizeof(double));
-    OOM(adj);
+    char *name = malloc(strlen(outprefix) + strlen(STREAM_SUFFIX) + 1);
+    OOM(name);
+    sprintf(name, "%s%s", outprefix, STREAM_SUFFIX);
+    FILE *fp = fopen(name, "r");
+    if (NULL == fp) {
+        errx(EXIT_FAILURE, "Failed to open sitewise results %s", name);
+    }
+
+    struct stream_header hdr;
+    if (!fscan_stream_header(fp, &hdr) || hdr.n_pts != n_pts) {
+        errx(EXIT_FAILURE, "Invalid header in sitewise results %s", name);
+    }
+    const long start = ftell(fp);
+
+    /*  P-values of sites counted when adjusting for multiple comparisons */
+    struct part_record rec;
+    double *pval = malloc(n_pts * sizeof(double));
+    OOM(pval);
+    int n_idx = 0, nread, site;
+    for (site = 0; (nread = fscan_part_record(fp, &rec)) == 9; site++) {
+        if (rec.site != site || site >= n_pts) {
+            errx(EXIT_FAILURE, "Invalid site in sitewise results %s", name);
+        }
+        if (rec.type > 1) {
+            pval[n_idx++] =
+                SitePvalue(rec.llike_max, rec.llike_neu, positive);
+        }
+    }
+    if (EOF != nread || site != n_pts) {
+        errx(EXIT_FAILURE, "Error reading sitewise results %s", name);
+    }
+    double *adj = NULL, *qval = NULL;
+    if (n_idx > 0) {
+        //  Otherwise no informative sites, nothing to adjust
+        adj = Pvalue_adjust_StepUp(pval, n_idx, BONFERRONI);
+        qval = qvals_storey02(pval, n_idx);
+    }
+    free(pval);
 
+    FILE *results_fp = fopen_with_suffix(outprefix, ".res", "w");
+    if (NULL != results_fp) {
+        fprint_results_header(results_fp, dosupport);
+    }
+    struct selectioninfo selinfo = {
+        &rec.llike_neu, &rec.llike_max, &rec.omega_max,
+        dosupport ? &rec.lbound : NULL, dosupport ? &rec.ubound : NULL,
+        &rec.type, &rec.screened
+    };
+    struct summary_counts counts = { {0} };
+    fseek(fp, start, SEEK_SET);
     n_idx = 0;
-    for (site = 0; site < data->n_pts; site++) {
-        idx = data->index[site];
-        if (idx >= 0) {
-            adj[n_idx] = pval[site];
-            adj[n_idx + data->n_pts] = pval[site];
+    while (fscan_part_record(fp, &rec) == 9) {
+        const double p = SitePvalue(rec.llike_max, rec.llike_neu, positive);
+        double p_adj = 1., q = 1.;
+        if (rec.type > 1) {
+            p_adj = adj[n_idx];
+            q = qval[n_idx];
             n_idx++;
         }
+        if (NULL != results_fp) {
+            fprint_results_site(results_fp, rec.site, &selinfo, 0,
+                                rec.entropy, p, p_adj, q);
+        }
+        count_summary_site(&counts, rec.omega_max, rec.llike_max,
+                           rec.entropy, p, p_adj);
+    }
+    fclose(fp);
+    if (NULL != results_fp) {
+        fclose(results_fp);
     }
+    free(adj);
+    free(qval);
+
+    FILE *summary_fp = fopen_with_suffix(outprefix, ".summary", "w");
+    if (NULL != summary_fp) {
+        fprint_fit(summary_fp, fit);
+        fprint_summary_counts(summary_fp, &counts);
+        fclose(summary_fp);
+    }
+    fprint_summary_counts(stdout, &counts);
 
-    adj_tmp = Pvalue_adjust_StepUp(adj, n_idx, BONFERRONI);
-    qval_tmp = qvals_storey02(adj + data->n_pts, n_idx);
+    remove(name);
+    free(name);
+}
 
-    n_idx = 0;
-    for (site = 0; site < data->n_pts; site++) {
-        idx = data->index[site];
-        if (idx >= 0) {
-            adj[site] = adj_tmp[n_idx];
-            adj[site + data->n_pts] = qval_tmp[n_idx];
-            n_idx++;
-        } else {
-            adj[site] = 1.;
-            adj[site + data->n_pts] = 1.;
+/*  Table comparing the sitewise results from each tree. For each site, the
+ * estimated omega and the p-value under each tree, and the number of trees
+ * under which the site is significant after correcting for multiple
+ * comparisons.
+ */
+void CompareTrees(const char *outprefix, char **treeprefix, const int ntree)
+{
+    assert(NULL != outprefix);
+    assert(NULL != treeprefix);
+    assert(ntree > 0);
+
+    struct shard_results *res = calloc(ntree, sizeof(struct shard_results));
+    OOM(res);
+    double **pval = calloc(ntree, sizeof(double *));
+    double **pval_adj = calloc(ntree, sizeof(double *));
+    OOM(pval);
+    OOM(pval_adj);
+    char *name = NULL;
+    for (int t = 0; t < ntree; t++) {
+        name = realloc(name, strlen(treeprefix[t]) + 8);
+        OOM(name);
+        sprintf(name, "%s.part", treeprefix[t]);
+        ReadShard(name, 0, 1, res + t);
+        CheckShardsComplete(res + t);
+        if (res[t].n_pts != res[0].n_pts) {
+            errx(EXIT_FAILURE, "Results for trees have different numbers of sites");
         }
+        pval[t] = CalculatePvals(res[t].selinfo->llike_max,
+                                 res[t].selinfo->llike_neu, res[t].n_pts,
+                                 res[t].positive);
+        pval_adj[t] = AdjustPvals(pval[t], res[t].index, res[t].n_pts);
     }
+    free(name);
 
-    free(adj_tmp);
-    free(qval_tmp);
-    return adj;
+    FILE *fp = fopen_with_suffix(outprefix, ".trees", "w");
+    if (NULL == fp) {
+        errx(EXIT_FAILURE, "Failed to open %s.trees for writing", outprefix);
+    }
+    fputs("# Tree\tlnL\tKappa\tOmega\tTree length\n", fp);
+    for (int t = 0; t < ntree; t++) {
+        fprintf(fp, "# %d\t%.3f\t%.6f\t%.6f\t%.4f\n", t + 1,
+                res[t].fit.loglike, res[t].fit.kappa, res[t].fit.omega,
+                res[t].fit.tree_length);
+    }
+    fputs("# Site", fp);
+    for (int t = 0; t < ntree; t++) {
+        fprintf(fp, "\tOmega.%d", t + 1);
+    }
+    for (int t = 0; t < ntree; t++) {
+        fprintf(fp, "\tPval.%d", t + 1);
+    }
+    fputs("\tNSig\n", fp);
+    for (int site = 0; site < res[0].n_pts; site++) {
+        int nsig = 0;
+        fprintf(fp, "%d", site + 1);
+        for (int t = 0; t < ntree; t++) {
+            fprintf(fp, "\t%.4f", res[t].selinfo->omega_max[site]);
+        }
+        for (int t = 0; t < ntree; t++) {
+            fprintf(fp, "\t%.4e", pval[t][site]);
+            nsig += (pval_adj[t][site] < 0.05) ? 1 : 0;
+        }
+        fprintf(fp, "\t%d\n", nsig);
+    }
+    fclose(fp);
+    printf("# Comparison of %d trees written to %s.trees\n", ntree, outprefix);
+
+    for (int t = 0; t < ntree; t++) {
+        free(pval[t]);
+        free(pval_adj[t]);
+        FreeShardResults(res + t);
+    }
+    free(pval);
+    free(pval_adj);
+    free(res);
 }
 
 void fprint_summary(FILE * fp, const struct selectioninfo *selinfo,
                   const double *entropy, const double *pval,
                   const double *pval_adj, const int n_pts)
 {
-    const double *omegam, *llikem;
-    int npos[4] = { 0, 0, 0, 0 }, ncons[4] = {
-    0, 0, 0, 0}, dpos[4] = {
-    0, 0, 0, 0};
+    struct summary_counts counts = { {0} };
     assert(NULL != selinfo);
     assert(NULL != selinfo->llike_neu);
     assert(NULL != selinfo->llike_max);
@@ -952,57 +3859,12 @@ void fprint_summary(FILE * fp, const struct selectioninfo *selinfo,
     assert(NULL != pval_adj);
     assert(n_pts > 0);
 
-    omegam = selinfo->omega_max;
-    llikem = selinfo->llike_max;
-
     for (int site = 0; site < n_pts; site++) {
-        if (omegam[site] > 1.) {
-            if (pval_adj[site] < 0.01) {
-                npos[0]++;
-                dpos[0] += IsRandomSite(site, entropy, llikem);
-            }
-            if (pval_adj[site] < 0.05) {
-                npos[1]++;
-                dpos[1] += IsRandomSite(site, entropy, llikem);
-            }
-            if (pval[site] < 0.01) {
-                npos[2]++;
-                dpos[2] += IsRandomSite(site, entropy, llikem);
-            }
-            if (pval[site] < 0.05) {
-                npos[3]++;
-                dpos[3] += IsRandomSite(site, entropy, llikem);
-            }
-        } else if (omegam[site] < 1.) {
-            if (pval_adj[site] < 0.01) {
-                ncons[0]++;
-            }
-            if (pval_adj[site] < 0.05) {
-                ncons[1]++;
-            }
-            if (pval[site] < 0.01) {
-                ncons[2]++;
-            }
-            if (pval[site] < 0.05) {
-                ncons[3]++;
-            }
-        }
+        count_summary_site(&counts, selinfo->omega_max[site],
+                           selinfo->llike_max[site], entropy[site], pval[site],
+                           pval_adj[site]);
     }
-
-    fprintf(fp, "# Positively selected sites (cumulative)\n");
-    fprintf(fp, "# Significance  Number sites  Number Random\n");
-    fprintf(fp, "# 99%% corrected  %5d   %5d\n", npos[0], dpos[0]);
-    fprintf(fp, "# 95%% corrected  %5d   %5d\n", npos[1], dpos[1]);
-    fprintf(fp, "# 99%%            %5d   %5d\n", npos[2], dpos[2]);
-    fprintf(fp, "# 95%%            %5d   %5d\n", npos[3], dpos[3]);
-    fputc('\n', fp);
-    fprintf(fp, "# Conserved sites (cumulative)\n");
-    fprintf(fp, "# Significance  Number sites\n");
-    fprintf(fp, "# 99%% corrected  %5d\n", ncons[0]);
-    fprintf(fp, "# 95%% corrected  %5d\n", ncons[1]);
-    fprintf(fp, "# 99%%            %5d\n", ncons[2]);
-    fprintf(fp, "# 95%%            %5d\n", ncons[3]);
-
+    fprint_summary_counts(fp, &counts);
 }
 
 int IsRandomSite(const int site, const double *entropy, const double *lmax)
@@ -1018,18 +3880,13 @@ int IsRandomSite(const int site, const double *entropy, const double *lmax)
     return 0;
 }
 
-double (*CalcLike_Wrapper_fun) (const double *, void *);
-double CalcLikeWrapper_const;
-
+/*  Likelihood less a constant, so its roots are where the likelihood equals
+ * that constant.
+ */
 double CalcLike_Wrapper(const double *x, void *info)
 {
-    return (CalcLike_Wrapper_fun(x, info) - CalcLikeWrapper_const);
-}
-
-void Set_CalcLike_Wrapper(double (*f) (const double *, void *), double diff)
-{
-    CalcLike_Wrapper_fun = f;
-    CalcLikeWrapper_const = diff;
+    const struct like_offset *offset = (const struct like_offset *)info;
+    return (offset->fun(x, offset->info) - offset->diff);
 }
 
 void fprint_params(FILE * output, const double *params, const int nparams,
@@ -1053,12 +3910,19 @@ void fprint_params(FILE * output, const double *params, const int nparams,
     for (codon = 0; codon < 64; codon++) {
         qcodon = CodonToQcoord(codon, gencode);
         (qcodon != -1) ? fprintf(output, "%16.15e ",
-                                 cfreqs[qcodon]) : fprintf(output, "0.0 ");
+                                 cfreqs[codon]) : fprintf(output, "0.0 ");
     }
     fputc('\n', output);
-    // Tree
+    // Tree. Plain values so that ReadParams can read them back.
     fprintf(output, "%d ", tree->n_br);
-    PrintBranchLengths(output, tree);
+    for (int br = 0; br < tree->n_br; br++) {
+        fprintf(output, "%16.15e ", (tree->branches[br])->blength[0]);
+    }
+    fputc('\n', output);
+    // Topology, to check branch lengths are applied to the same tree
+    char *topology = topology_string(tree);
+    fprintf(output, "%s\n", topology);
+    free(topology);
 }
 
 void WriteParams(const char *file, const double *params, const int nparams,
@@ -1141,6 +4005,7 @@ struct slr_params *ReadParams(const char *file)
     if (nread != 1 || nbr <= 0) {
         goto error_exit;
     }
+    ret_struct->nbr = nbr;
     ret_struct->blengths = calloc(nbr, sizeof(double));
     if (NULL == ret_struct->blengths) {
         goto error_exit;
@@ -1152,6 +4017,29 @@ struct slr_params *ReadParams(const char *file)
         }
     }
 
+    // Topology of tree, if present (older files do not have it)
+    int c;
+    while ((c = fgetc(input)) != EOF && isspace(c)) ;
+    if ('(' == c) {
+        size_t len = 0, maxlen = 256;
+        ret_struct->topology = malloc(maxlen);
+        if (NULL == ret_struct->topology) {
+            goto error_exit;
+        }
+        for (; c != EOF && c != '\n'; c = fgetc(input)) {
+            if (len + 1 == maxlen) {
+                maxlen *= 2;
+                char *tmp = realloc(ret_struct->topology, maxlen);
+                if (NULL == tmp) {
+                    goto error_exit;
+                }
+                ret_struct->topology = tmp;
+            }
+            ret_struct->topology[len++] = c;
+        }
+        ret_struct->topology[len] = '\0';
+    }
+
     fclose(input);
     return ret_struct;
 
@@ -1167,11 +4055,140 @@ struct slr_params *ReadParams(const char *file)
         if (NULL != ret_struct->blengths) {
             free(ret_struct->blengths);
         }
+        free(ret_struct->topology);
         free(ret_struct);
     }
     return NULL;
 }
 
+void FreeParams(struct slr_params *params)
+{
+    if (NULL == params) {
+        return;
+    }
+    free(params->params);
+    free(params->cfreqs);
+    free(params->blengths);
+    free(params->topology);
+    free(params);
+}
+
+/*  Name of the file in the cache directory holding the prepared alignment,
+ * from a hash of the contents of the sequence file and the genetic code.
+ */
+char *DataCacheName(const char *cachedir, const uint64_t key)
+{
+    assert(NULL != cachedir);
+
+    char *name = malloc(strlen(cachedir) + 32);
+    OOM(name);
+    sprintf(name, "%s/%016llx.data", cachedir, (unsigned long long)key);
+    return name;
+}
+
+/*  Name of the file in the cache directory holding the fitted parameters for
+ * an analysis, derived from a hash of everything that affects the fit: the
+ * compressed site patterns, the starting tree and parameters, and the model.
+ * Substitution parameter files are hashed by contents, and should be given
+ * as empty names when the model does not use them.
+ */
+char *TreeCacheName(const char *cachedir, const DATA_SET * data,
+                    const TREE * tree, const double *freqs, const double kappa,
+                    const double omega, const int *settings,
+                    const int nsettings, const char *nucfile,
+                    const char *aminofile)
+{
+    uint64_t h = FNV_OFFSET;
+
+    assert(NULL != cachedir);
+    CheckIsDataSet(data);
+    CheckIsTree(tree);
+    assert(NULL != freqs);
+    assert(NULL != settings);
+
+    h = fnv1a_hash(h, &data->n_sp, sizeof(int));
+    h = fnv1a_hash(h, &data->n_unique_pts, sizeof(int));
+    for (int sp = 0; sp < data->n_sp; sp++) {
+        h = fnv1a_hash(h, data->sp_name[sp], strlen(data->sp_name[sp]) + 1);
+        for (int pt = 0; pt < data->n_unique_pts; pt++) {
+            h = hash_observation(h, data, DATA_SEQ(data, sp, pt));
+        }
+    }
+    h = fnv1a_hash(h, data->freq, data->n_unique_pts * sizeof(double));
+
+    h = fnv1a_hash(h, tree->tstring, strlen(tree->tstring) + 1);
+    for (int br = 0; br < tree->n_br; br++) {
+        h = fnv1a_hash(h, (tree->branches[br])->blength, sizeof(double));
+    }
+
+    h = fnv1a_hash(h, freqs, 64 * sizeof(double));
+    h = fnv1a_hash(h, &kappa, sizeof(double));
+    h = fnv1a_hash(h, &omega, sizeof(double));
+    h = fnv1a_hash(h, settings, nsettings * sizeof(int));
+    h = hash_param_file(h, nucfile);
+    h = hash_param_file(h, aminofile);
+
+    char *name = malloc(strlen(cachedir) + 32);
+    OOM(name);
+    sprintf(name, "%s/%016llx.params", cachedir, (unsigned long long)h);
+    return name;
+}
+
+/*  Apply cached parameters to tree. Returns true if they were found and are
+ * for this tree.
+ */
+int ReadTreeCache(const char *file, TREE * tree, double *kappa,
+                  double *omega)
+{
+    assert(NULL != file);
+    CheckIsTree(tree);
+    assert(NULL != kappa);
+    assert(NULL != omega);
+
+    struct slr_params *cached = ReadParams(file);
+    if (NULL == cached) {
+        return 0;
+    }
+    int ok = (cached->nparams >= 2 && cached->nbr == tree->n_br
+              && NULL != cached->topology);
+    if (ok) {
+        char *topology = topology_string(tree);
+        ok = (strcmp(topology, cached->topology) == 0);
+        free(topology);
+    }
+    if (ok) {
+        *kappa = cached->params[0];
+        *omega = cached->params[1];
+        add_lengths_to_tree(tree, cached->blengths);
+    } else {
+        warnx("Ignoring cached parameters %s, which are for a different tree",
+              file);
+    }
+    FreeParams(cached);
+    return ok;
+}
+
+/*  Written under a temporary name first, so concurrent runs never see a
+ * partially written file.
+ */
+void WriteTreeCache(const char *file, const double kappa, const double omega,
+                    const double *freqs, const int gencode, const TREE * tree)
+{
+    assert(NULL != file);
+
+    const double params[2] = { kappa, omega };
+    char *tmpname = malloc(strlen(file) + 32);
+    OOM(tmpname);
+    sprintf(tmpname, "%s.%ld.tmp", file, (long)getpid());
+
+    WriteParams(tmpname, params, 2, freqs, gencode, tree);
+    if (0 != rename(tmpname, file)) {
+        warnx("Failed to save fitted parameters to cache %s", file);
+        remove(tmpname);
+    }
+    free(tmpname);
+}
+
 #define OMEGAMAX	50.0
 #define OMEGAEXPCONST	0.5
 
@@ -0,0 +1,137 @@
+/*
+ *  Copyright 2003-2008 Tim Massingham (tim.massingham@ebi.ac.uk)
+ *  Funded by EMBL - European Bioinformatics Institute
+ */
+/*
+ *  This file is part of SLR ("Sitewise Likelihood Ratio")
+ *
+ *  SLR is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SLR is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SLR.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*  Generate synthetic codon alignments and trees, for measuring how Slr
+ * scales with the number of species, the number of codons and gappiness.
+ *
+ *  Usage: SlrSim [options] prefix
+ *    -n species   number of species [10]
+ *    -l codons    number of codons [100]
+ *    -t shape     "balanced" or "caterpillar" [balanced]
+ *    -b length    mean branch length [0.1]
+ *    -k kappa     transition / transversion ratio [2.0]
+ *    -w omega     dN/dS [0.2]
+ *    -g fraction  probability each codon is a gap [0]
+ *    -s seed      seed for random number generator, 0 for clock [0]
+ *
+ *  The alignment is written to "<prefix>.paml" and the tree to
+ * "<prefix>.trees". Codons are equally frequent.
+ */
+
+#include <err.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "codonmodel.h"
+#include "gencode.h"
+#include "rng.h"
+#include "simulate.h"
+#include "utility.h"
+
+int main(int argc, char *argv[])
+{
+    int n_sp = 10, n_pts = 100;
+    enum tree_shape shape = Shape_Balanced;
+    double blength = 0.1, kappa = 2.0, omega = 0.2, gapfrac = 0.;
+    unsigned int seed = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:l:t:b:k:w:g:s:")) != -1) {
+        switch (opt) {
+        case 'n':
+            n_sp = atoi(optarg);
+            break;
+        case 'l':
+            n_pts = atoi(optarg);
+            break;
+        case 't':
+            if (strcmp(optarg, "balanced") == 0) {
+                shape = Shape_Balanced;
+            } else if (strcmp(optarg, "caterpillar") == 0) {
+                shape = Shape_Caterpillar;
+            } else {
+                errx(EXIT_FAILURE, "Unrecognised shape of tree %s", optarg);
+            }
+            break;
+        case 'b':
+            blength = atof(optarg);
+            break;
+        case 'k':
+            kappa = atof(optarg);
+            break;
+        case 'w':
+            omega = atof(optarg);
+            break;
+        case 'g':
+            gapfrac = atof(optarg);
+            break;
+        case 's':
+            seed = (unsigned int)strtoul(optarg, NULL, 10);
+            break;
+        default:
+            errx(EXIT_FAILURE, "Usage: SlrSim [-n species] [-l codons] [-t balanced|caterpillar] [-b length] [-k kappa] [-w omega] [-g gaps] [-s seed] prefix");
+        }
+    }
+    if (optind != argc - 1) {
+        errx(EXIT_FAILURE, "Expecting prefix for output files");
+    }
+    if (n_sp < 3 || n_pts < 1 || blength <= 0. || kappa < 0. || omega < 0.
+        || gapfrac < 0. || gapfrac >= 1.) {
+        errx(EXIT_FAILURE, "Invalid parameters for simulation");
+    }
+    const char *prefix = argv[optind];
+    RL_Init(seed);
+
+    const int gencode = GENCODE_UNIVERSAL;
+    double pi[64];
+    const int nsense = NumberSenseCodonsInGenCode(gencode);
+    for (int i = 0; i < 64; i++) {
+        pi[i] = IsStop(i, gencode) ? 0. : 1. / nsense;
+    }
+    MODEL *model = NewCodonModel_full(gencode, kappa, omega, pi, 0, 1,
+                                      Branches_Fixed, NULL);
+    OOM(model);
+
+    TREE *tree = RandomTree(n_sp, shape, blength);
+    DATA_SET *data = SimulateCodons(tree, model, n_pts, gapfrac);
+
+    FILE *fp = fopen_with_suffix(prefix, ".trees", "w");
+    if (NULL == fp) {
+        err(EXIT_FAILURE, "Failed to open tree file for %s", prefix);
+    }
+    fprintf(fp, "%d 1\n", tree->n_sp);
+    fprint_tree(fp, tree->tree, NULL, tree);
+    fclose(fp);
+
+    fp = fopen_with_suffix(prefix, ".paml", "w");
+    if (NULL == fp) {
+        err(EXIT_FAILURE, "Failed to open alignment file for %s", prefix);
+    }
+    WriteCodonAlignment(fp, data);
+    fclose(fp);
+
+    FreeDataSet(data);
+    FreeTree(tree);
+    FreeModel(model);
+
+    return EXIT_SUCCESS;
+}
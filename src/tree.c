@@ -32,24 +32,14 @@
 #include "data.h"
 #include "tree.h"
 #include "utility.h"
-#include "mystring.h"
 
 #define TEST(A) { if (! (A) ) return 0; }
 #define Free(A) if(*A != NULL){ free(*A); *A=NULL;}
 
-char GetTreeElt (const char **tree_str);
-int GetLeafNo (const char **tree_str);
-char * GetLeafName ( const char **tree_str);
-double GetLength (const char **tree_str);
-NODE *create_tree_sub (const char **tree_str, NODE * parent, TREE * tree);
 int add_lengths_to_tree (TREE * tree, double *lengths);
-NODE *CreateNode (void);
-void FreeNode (NODE * node, NODE * parent);
 unsigned s_hash(const unsigned char *p);
 
-static void ExtendNode ( NODE * node);
-static NODE *CloneTree_sub (const NODE * node, const NODE * parent,
-			    const TREE * tree, TREE * tree_new);
+static NODE * lookup_leaf (const char * name, const TREE * tree);
 static void CheckIsConnected (const NODE * node1, const NODE * node2);
 static void CheckIsTree_sub (const NODE * code, const NODE * parent,
 			     const TREE * tree);
@@ -58,13 +48,6 @@ static void Recurse_forward_sub (const NODE * node, const NODE * parent,
 static void Recurse_backward_sub (const NODE * node, const NODE * parent,
 				  void (*fun) (void *, int, int), void *info);
 
-void * isleaf_rbmap(const void * key, void * value){
-	const NODE * leaf = (NODE *) value;
-	assert(NULL!=leaf);
-	assert(ISLEAF(leaf));
-	return value;
-}
-
 void CheckIsTree (const TREE * tree)
 {
 	int branch;
@@ -81,9 +64,12 @@ void CheckIsTree (const TREE * tree)
   assert (NULL != tree->tree);
   assert (NULL != tree->branches);
   assert (NULL != tree->leaves);
+  assert (NULL != tree->leaf_hash);
 
-  assert(nmemb_rbtree(tree->leaves)==tree->n_sp);
-  map_rbtree(tree->leaves,isleaf_rbmap);
+  for (int i = 0; i < tree->n_sp; i++) {
+    assert (ISLEAF (tree->leaves[i]));
+    assert (lookup_leaf (tree->leaves[i]->name, tree) == tree->leaves[i]);
+  }
   
   for ( branch = 0; branch < tree->n_br; branch++) {
     assert (NULL != tree->branches[branch]);
@@ -135,21 +121,284 @@ static void CheckIsTree_sub (const NODE * node, const NODE * parent,
 
 
 
+/*  Links between nodes while a tree string is parsed. Nodes are referred to
+ *  by index, since the array holding them may move as it grows.
+ */
+struct newick_link {
+  int parent;
+  int first_child, last_child, next_sibling;
+  int nchild;
+  double length;
+};
+
+struct newick_parser {
+  NODE * nodes;
+  struct newick_link * link;
+  int n, max;
+};
+
+static void newick_error (const TREE * tree, const char * p, const char * msg)
+{
+  fprintf (stderr, "Error reading tree at character %d: %s.\n",
+	   (int) (p - tree->tstring) + 1, msg);
+  fprintf (stderr, "Tree string is %s\n", tree->tstring);
+  exit (EXIT_FAILURE);
+}
+
+/*  Characters that may be part of a leaf name or an internal node label */
+static int IsNameChar (const char c)
+{
+  switch (c) {
+  case '(': case ')': case ',': case ':': case ';': case '\0':
+    return 0;
+  }
+  return 1;
+}
+
+static int newick_add_node (struct newick_parser * np, const int parent)
+{
+  if (np->n == np->max) {
+    np->max *= 2;
+    np->nodes = realloc (np->nodes, np->max * sizeof (NODE));
+    OOM (np->nodes);
+    np->link = realloc (np->link, np->max * sizeof (struct newick_link));
+    OOM (np->link);
+  }
+
+  const int i = np->n++;
+  memset (np->nodes + i, 0, sizeof (NODE));
+  np->nodes[i].bnumber = -1;
+  np->link[i].parent = parent;
+  np->link[i].first_child = -1;
+  np->link[i].last_child = -1;
+  np->link[i].next_sibling = -1;
+  np->link[i].nchild = 0;
+  np->link[i].length = -1.;
+  if (parent >= 0) {
+    struct newick_link * pl = np->link + parent;
+    if (pl->last_child >= 0)
+      np->link[pl->last_child].next_sibling = i;
+    else
+      pl->first_child = i;
+    pl->last_child = i;
+    pl->nchild++;
+  }
+
+  return i;
+}
+
+/*  Read the tree string in a single pass without recursion. Branches are
+ *  numbered in the order their nodes are completed: a leaf when its name has
+ *  been read, an internal node at its closing bracket. Spaces within leaf
+ *  names are dropped and labels of internal nodes are ignored.
+ */
+static void parse_newick (TREE * tree, struct newick_parser * np)
+{
+  const char * p = tree->tstring;
+  char * name = tree->name_pool;
+  int cur, last = -1;
+  int expect_child = 1;
+
+  while (isspace ((unsigned char) *p))
+    p++;
+  if ('(' != *p)
+    newick_error (tree, p, "tree must start with '('");
+  p++;
+  cur = newick_add_node (np, -1);
+
+  while (cur >= 0) {
+    const char c = *p;
+    if (isspace ((unsigned char) c)) {
+      p++;
+      continue;
+    }
+    switch (c) {
+    case '(':
+      if (!expect_child)
+	newick_error (tree, p, "expected ',' or ')' before '('");
+      cur = newick_add_node (np, cur);
+      p++;
+      break;
+    case ',':
+    case ')':
+      if (expect_child)
+	newick_error (tree, p, "empty subtree");
+      if (')' == c) {
+	last = cur;
+	cur = np->link[cur].parent;
+	if (cur >= 0)
+	  np->nodes[last].bnumber = tree->n_br++;
+	expect_child = 0;
+      } else {
+	expect_child = 1;
+      }
+      p++;
+      break;
+    case ':':
+      if (expect_child || last < 0)
+	newick_error (tree, p, "branch length without a subtree");
+      p++;
+      {
+	char * end;
+	np->link[last].length = strtod (p, &end);
+	if (end == p)
+	  newick_error (tree, p, "expected a branch length");
+	p = end;
+      }
+      break;
+    case ';':
+    case '\0':
+      newick_error (tree, p, "unbalanced brackets");
+      break;
+    default:
+      if (expect_child) {
+	last = newick_add_node (np, cur);
+	np->nodes[last].bnumber = tree->n_br++;
+	np->nodes[last].name = name;
+	for ( ; IsNameChar (*p); p++) {
+	  if (!isspace ((unsigned char) *p))
+	    *name++ = *p;
+	}
+	*name++ = '\0';
+	tree->n_sp++;
+	expect_child = 0;
+      } else {
+	while (IsNameChar (*p))
+	  p++;
+      }
+    }
+  }
+}
+
+/*  Connect the parsed nodes. Each node's branches are taken from a common
+ *  pool: the parent first, except at the root, then the children in order,
+ *  then a terminating NULL.
+ */
+static void link_nodes (TREE * tree, const struct newick_link * link,
+			const int n)
+{
+  int nslot = 0;
+  int nleaf = 0;
+
+  for (int i = 0; i < n; i++)
+    nslot += link[i].nchild + (link[i].parent >= 0) + 1;
+  tree->branch_pool = malloc (nslot * sizeof (NODE *));
+  OOM (tree->branch_pool);
+  tree->blength_pool = malloc (nslot * sizeof (double));
+  OOM (tree->blength_pool);
+  tree->branches = calloc (tree->n_br, sizeof (NODE *));
+  OOM (tree->branches);
+  tree->leaves = malloc (tree->n_sp * sizeof (NODE *));
+  OOM (tree->leaves);
+
+  NODE ** branch = tree->branch_pool;
+  double * blength = tree->blength_pool;
+  for (int i = 0; i < n; i++) {
+    NODE * node = tree->nodes + i;
+    int b = 0;
+
+    node->nbran = link[i].nchild + (link[i].parent >= 0);
+    node->maxbran = node->nbran + 1;
+    node->branch = branch;
+    node->blength = blength;
+    branch += node->maxbran;
+    blength += node->maxbran;
+
+    if (link[i].parent >= 0) {
+      node->branch[b] = tree->nodes + link[i].parent;
+      node->blength[b++] = link[i].length;
+      tree->branches[node->bnumber] = node;
+    }
+    for (int c = link[i].first_child; c >= 0; c = link[c].next_sibling) {
+      node->branch[b] = tree->nodes + c;
+      node->blength[b++] = link[c].length;
+    }
+    node->branch[b] = NULL;
+    node->blength[b] = -1.;
+
+    if (0 == link[i].nchild)
+      tree->leaves[nleaf++] = node;
+  }
+
+  tree->tree = tree->nodes;
+  tree->tree->bnumber = tree->n_br;
+}
+
+/*  String hash (Kernighan and Ritchie) */
+unsigned s_hash (const unsigned char *p)
+{
+  unsigned h = 0;
+
+  while ('\0' != *p)
+    h = 31 * h + *p++;
+
+  return h;
+}
+
+static void hash_leaves (TREE * tree)
+{
+  tree->hash_size = 16;
+  while (tree->hash_size < 2 * tree->n_sp)
+    tree->hash_size *= 2;
+  tree->leaf_hash = calloc (tree->hash_size, sizeof (NODE *));
+  OOM (tree->leaf_hash);
+
+  for (int i = 0; i < tree->n_sp; i++) {
+    const char * name = tree->leaves[i]->name;
+    unsigned h = s_hash ((const unsigned char *) name) & (tree->hash_size - 1);
+    while (NULL != tree->leaf_hash[h]) {
+      if (0 == strcmp (tree->leaf_hash[h]->name, name)) {
+	fprintf (stderr, "Species name %s already used in tree. Please make unique and rerun program.\n", name);
+	exit (EXIT_FAILURE);
+      }
+      h = (h + 1) & (tree->hash_size - 1);
+    }
+    tree->leaf_hash[h] = tree->leaves[i];
+  }
+}
+
+static NODE * lookup_leaf (const char * name, const TREE * tree)
+{
+  unsigned h = s_hash ((const unsigned char *) name) & (tree->hash_size - 1);
+
+  while (NULL != tree->leaf_hash[h]) {
+    if (0 == strcmp (tree->leaf_hash[h]->name, name))
+      return tree->leaf_hash[h];
+    h = (h + 1) & (tree->hash_size - 1);
+  }
+
+  return NULL;
+}
+
+/*  Build the tree described by tstring. All nodes are held in one array,
+ *  with the root first and the others in order of appearance.
+ */
 void create_tree (TREE * tree)
 {
-  const char *tmp;
+  struct newick_parser np;
   int old_sp;
 
   assert(NULL==tree->tree);
 
-  tmp = tree->tstring;
   old_sp = tree->n_sp;
   tree->n_sp = 0;
-  tree->leaves = create_rbtree(lexo,strcopykey,strfreekey);
-  //  Bifurcating tree is upper bound on number of branches
-  tree->branches = calloc(2*old_sp-3,sizeof(NODE *));
-  tree->tree = create_tree_sub (&tmp, NULL, tree);
-  tree->tree->bnumber = tree->n_br;
+  tree->n_br = 0;
+  tree->ambig = NULL;
+  tree->name_pool = malloc ((strlen (tree->tstring) + 1) * sizeof (char));
+  OOM (tree->name_pool);
+  //  Bifurcating tree is a good first guess for the number of nodes
+  np.n = 0;
+  np.max = (old_sp > 1) ? 2 * old_sp - 2 : 16;
+  np.nodes = malloc (np.max * sizeof (NODE));
+  OOM (np.nodes);
+  np.link = malloc (np.max * sizeof (struct newick_link));
+  OOM (np.link);
+
+  parse_newick (tree, &np);
+  tree->nodes = np.nodes;
+  link_nodes (tree, np.link, np.n);
+  free (np.link);
+  hash_leaves (tree);
 
   assert(old_sp == tree->n_sp);
   CheckIsTree (tree);
@@ -197,235 +446,50 @@ void fprint_tree (FILE * out, const NODE * node, const NODE * parent,
     fprintf (out, "\n");
 }
 
-NODE *CreateNode (void)
+static char * sprint_topology_sub (char * out, const NODE * node, const NODE * parent)
 {
-  NODE *node;
-  int i;
-  
-  node = malloc (sizeof (NODE));
-  OOM (node);
-  node->plik = NULL;
-  node->seq = NULL;
-  node->name = NULL;
-  node->mat = NULL;
-  node->back = NULL;
-  node->mid = NULL;
-  node->bmat = NULL;
-  node->dback = NULL;
-  node->bnumber = -1;
-  node->nbran = 0;
-  node->maxbran = 3;
-  node->blength = calloc(3,sizeof(double));
-  node->branch  = calloc(3,sizeof(NODE *));
-  for ( i=0 ; i<node->maxbran ; i++){
-    node->blength[i] = -1.;
-    node->branch[i] = NULL;
-  }
-
-  return node;
-}
-
-static void ExtendNode ( NODE * node){
-   NODE ** new_branch;
-   double * new_blength;
-   int bran;
-
-   assert(NULL!=node);
-   assert(node->maxbran>0);
-   new_branch  = calloc(2*node->maxbran,sizeof(NODE *));   OOM(new_branch);
-   new_blength = calloc(2*node->maxbran,sizeof(double));   OOM(new_blength);
-
-   assert(node->nbran>=0);
-   assert(node->nbran<=node->maxbran);
-   for ( bran=0 ; bran<node->nbran ; bran++){
-      new_branch[bran]  = node->branch[bran];
-      new_blength[bran] = node->blength[bran];
-   }
-   for ( ; bran<2*node->maxbran ; bran++){
-      new_branch[bran] = NULL;
-      new_blength[bran] = -1.;
-   }
-
-   node->maxbran *= 2;
-   free(node->branch);
-   free(node->blength);
-   node->branch  = new_branch;
-   node->blength = new_blength;
-}
-
-
-
+  int a = (parent == NULL) ? -1 : 0;
+  int leaf_flag = 0;
 
-
-
-NODE *create_tree_sub (const char **tree_str, NODE * parent, TREE * tree)
-{
-  NODE *node,*node_new;
-  char c;
-  int bufflen;
-  double l;
-  char * name;
-
-  node = CreateNode ();
-  if (parent != NULL) {
-    node->nbran++;
-    node->branch[0] = parent;
-  }
-  else{
-      (*tree_str)++;
-  }
-
-  while ( (c = GetTreeElt (tree_str)) != EOF) {
-    if (c == '(') {
-      node->branch[node->nbran]
-	= create_tree_sub (tree_str, node, tree);
-      (node->branch[node->nbran])->bnumber = tree->n_br;
-      tree->branches[tree->n_br++] = node->branch[node->nbran++];
-      if ( node->nbran >= node->maxbran - 1 ){ ExtendNode(node); }
-    }
-    else if (c == ')') {
-      node->branch[node->nbran] = NULL;
-      return node;
-    }
-    else if (c == ',') {
-      node_new = CreateNode();
-      node->branch[node->nbran] = node_new;
-      node_new->bnumber = tree->n_br;
-      tree->branches[tree->n_br++] = node->branch[node->nbran];
-      CHILD (node, node->nbran)->branch[0] = node;
-      CHILD (node, node->nbran)->branch[1] = NULL;
-      CHILD (node, node->nbran)->nbran = 1;
-      name = GetLeafName(tree_str);
-      bufflen = 1+strlen(name);
-      node_new->name = malloc (bufflen*sizeof(char));
-      strncpy(node_new->name,name,bufflen);
-      if ( insertelt_rbtree(tree->leaves,name,node_new) ){
-         fprintf(stderr,"Species name %s already used in tree. Please make unique and rerun program.\n",name);
-         exit(EXIT_FAILURE);
-      }
-
-      tree->n_sp++; node->nbran++;
-      if ( node->nbran >= node->maxbran - 1){ ExtendNode(node); }
+  *out++ = '(';
+  while (node->branch[++a] != NULL) {
+    if (leaf_flag == 1){
+      out += sprintf (out, ", ");
     }
-    else if (c == ':') {
-      l = GetLength (tree_str);
-      node->blength[node->nbran - 1] = l;
-      CHILD (node, node->nbran - 1)->blength[0] = l;
+    if (ISLEAF (CHILD (node, a))) {
+      out += sprintf (out, "%s", CHILD(node,a)->name);
     }
-
-  }
-
-  fprintf (stderr,"Error creating tree.\n");
-  fprintf (stderr,"Tree string is %s.\n",*tree_str);
-  fprintf (stderr,"This is probably a bug. Please report to tim.massingham@ebi.ac.uk\n");
-  fprint_tree(stderr, parent,parent,tree);
-  exit(EXIT_FAILURE);
-
-  return node;
-}
-
-
-char GetTreeElt (const char **tree_str)
-{
-  char c;
-
-  while (isspace (c = *(*tree_str)++));
-  if (c == ')' || c == '(' || c == EOF || c == ':')
-    return c;
-  /* Two possible cases if read comma. Either next is a leaf, which
-   * is indicated by comma-whitespace-char or next is a node, 
-   * indicated by comma-whitespace-bracket
-   */
-  if (',' == c) {
-    while (isspace (c = *(*tree_str)++));
-    switch(c){
-       case '(':	return '('; /*  new node */
-       case ':':
-       case ',':	fprintf(stderr,"Error reading tree. Found \",%c\".\n",c);
-			exit(EXIT_FAILURE);
-       default:		*(*tree_str)--;  /*  new leaf */
-			return ',';
+    else {
+      out = sprint_topology_sub (out, CHILD (node, a), node);
     }
+    leaf_flag = 1;
   }
+  out += sprintf (out, " )");
 
-
-  /* Case: just created a new node and encountered leaf */
-  (*tree_str)--;
-  c = ',';
-
-  return c;
+  return out;
 }
 
-int GetLeafNo (const char **tree_str)
+/*  Tree as string in the same form as fprint_tree but without branch
+ *  lengths. Two trees with the same string have the same topology and the
+ *  same numbering of branches.
+ */
+char * topology_string (const TREE * tree)
 {
-  char no[3];
-  int a = 0;
-
-  while (isspace (*(*tree_str))) {
-    *(*tree_str)++;
-  }
-  while (isdigit ((unsigned char) *(*tree_str)) != 0)
-    no[a++] = *(*tree_str)++;
-  no[a] = '\0';
-
-  (void) sscanf (no, "%d", &a);
-
-  return (a - 1);
-}
-
-char * GetLeafName ( const char ** tree_str){
-   Mystring string;
-   char * ret;
-
-   string = new_mystring(10);
-
-   while(isspace (*(*tree_str))) {
-      *(*tree_str)++;
-   }
-
-   const char ** tree_str_old = tree_str;
-   while ( *(*tree_str) != '\0' ){
-      if ( ! isspace(*(*tree_str)) ){
-         switch( *(*tree_str) ){
-         case '(': case ')': case ';': case ':': case ',':
-	        ret = cstring_of_mystring(string);
-	        free_mystring(string);
-	        return ret;
-         default:
-            append_char_to_mystring ( *(*tree_str),string);
-         }
-      }
-      *(*tree_str)++;
-   }
-   fprintf (stderr,"Read past end of tree string trying to read leaf name. %s\n",*tree_str_old);
-   exit(EXIT_FAILURE);
-   return NULL;
-}
-
+  size_t len = 4;
+  char * str;
 
-double GetLength (const char **tree_str)
-{
-  char no[25];
-  unsigned char c;
-  double l;
-  int a = 0;
-  int maxlen = 24;
-
-  do {
-    no[a++] = *(*tree_str)++;
-    c = (unsigned char) *(*tree_str);
-  } while (a < maxlen
-	   && (isdigit (c) != 0 || c == 'e' || c == '-' || c == '.'
-	       || c == '+'));
-  no[a] = '\0';
-  while (isdigit (c) != 0 || c == 'e' || c == '-' || c == '.' || c == '+') {
-    (*tree_str)++;
-    c = (unsigned char) *(*tree_str);
+  CheckIsTree (tree);
+  for (int a = 0; a < tree->n_br; a++) {
+    len += 5;
+    if (ISLEAF (tree->branches[a])){
+      len += strlen ((tree->branches[a])->name);
+    }
   }
+  str = malloc (len * sizeof (char));
+  OOM (str);
+  (void) sprint_topology_sub (str, tree->tree, NULL);
 
-  (void) sscanf (no, "%le", &l);
-
-  return l;
+  return str;
 }
 
 int add_lengths_to_tree (TREE * tree, double *lengths)
@@ -524,114 +588,55 @@ TREE *CopyTree (const TREE * tree)
   return tree_new;
 }
 
-void * intpcopy(const void * intp){
-	assert(NULL!=intp);
-	int * new_intp = malloc(sizeof(int));
-	*new_intp = *(int *)intp;
-	return new_intp;
-}
-
+/*  Copy of tree with its current branch lengths, rather than those in the
+ *  tree string.
+ */
 TREE *CloneTree (TREE * tree)
 {
   TREE *tree_new;
 
   CheckIsTree (tree);
 
-  tree_new = calloc (1, sizeof (TREE));
+  tree_new = CopyTree (tree);
   if (NULL == tree_new)
     return NULL;
-
-  tree_new->n_sp = tree->n_sp;
-  tree_new->n_br = tree->n_br;
-  tree_new->tstring = malloc ((1 + strlen (tree->tstring)) * sizeof (char));
-  strcpy (tree_new->tstring, tree->tstring);
-  tree_new->leaves = create_rbtree(lexo,strcopykey,strfreekey);
-  tree_new->branches = calloc(tree->n_br,sizeof(NODE *));
-  tree_new->tree = CloneTree_sub (tree->tree, NULL, tree, tree_new);
+  //  Same string, so nodes and their branches are laid out identically
+  memcpy (tree_new->blength_pool, tree->blength_pool,
+	  (3 * tree->n_br + 1) * sizeof (double));
 
   CheckIsTree (tree_new);
   return tree_new;
 }
 
-static NODE *CloneTree_sub (const NODE * node, const NODE * parent,
-			    const TREE * tree, TREE * tree_new)
-{
-  NODE *node_new;
-  int ln, n;
-  int bufflen;
-
-  node_new = CreateNode ();
-  OOM (node_new);
-  node_new->bnumber = node->bnumber;
-
-  n = 0;
-  while (node->branch[n] != NULL) {
-    if (node->branch[n] != parent) {
-      node_new->branch[n] =
-	CloneTree_sub (node->branch[n], node, tree, tree_new);
-      // Connect all children to parent
-      (node_new->branch[n])->branch[0] = node_new;
-    }
-    node_new->blength[n] = node->blength[n];
-    n++;
-  }
-  node_new->branch[n] = NULL;
-
-
-  // If on a leaf, then update leaves index
-  if (ISLEAF (node)) {
-    bufflen = 1 + strlen(node->name);
-    node_new->name = malloc(bufflen*sizeof(char));
-    strncpy(node_new->name,node->name,bufflen);
-    insertelt_rbtree(tree_new->leaves,node_new->name,node_new);
-  }
-  // If not at root node, then in branch index
-  if (NULL != parent) {
-    ln = find_branch_number (node, tree);
-    assert (node_new->bnumber == ln);
-    tree_new->branches[ln] = node_new;
-  }
-
-  return node_new;
-}
-
 
 void FreeTree (TREE * tree)
 {
 
   CheckIsTree (tree);
 
-  FreeNode (tree->tree, NULL);
+  //  One node for each branch and one for the root
+  for (int i = 0; i <= tree->n_br; i++) {
+    NODE * node = tree->nodes + i;
+    Free (&node->seq);
+    Free (&node->plik);
+    Free (&node->mid);
+    Free (&node->back);
+    Free (&node->dback);
+    Free (&node->mat);
+    Free (&node->bmat);
+  }
+  Free (&tree->nodes);
+  Free (&tree->branch_pool);
+  Free (&tree->blength_pool);
+  Free (&tree->name_pool);
+  Free (&tree->leaves);
+  Free (&tree->leaf_hash);
   Free (&tree->tstring);
   Free (&tree->branches);
-  free_rbtree(tree->leaves,free);
+  FreeAmbiguityTable (tree->ambig);
   Free (&tree);
 }
 
-void FreeNode (NODE * node, NODE * parent)
-{
-  int i = 0;
-
-  while (i < node->nbran && node->branch[i] != NULL) {
-    if (node->branch[i] != parent) {
-      FreeNode (node->branch[i], node);
-    }
-    i++;
-  }
-
-  Free (&node->branch);
-  Free (&node->blength);
-  Free (&node->seq);
-  Free (&node->name);
-  Free (&node->plik);
-  Free (&node->mid);
-  Free (&node->back);
-  Free (&node->dback);
-  Free (&node->mat);
-  Free (&node->bmat);
-  Free (&node);
-}
-
 
 
 void Recurse_forward (const TREE * tree, void (*fun) (void *, int, int),
@@ -713,6 +718,34 @@ static void Recurse_backward_sub (const NODE * node, const NODE * parent,
 
 
 
+/*  Read one tree, from the first non-space character up to and including
+ *  the terminating semicolon (or end of file). */
+static char * read_one_tree_string (FILE * fp)
+{
+  int c, len = 0, maxlen = 256;
+  char * str;
+
+  do
+    c = fgetc (fp);
+  while (isspace (c));
+
+  str = malloc (maxlen * sizeof (char));
+  OOM (str);
+  for ( ; c != EOF; c = fgetc (fp)) {
+    if (len + 2 >= maxlen) {
+      maxlen *= 2;
+      str = realloc (str, maxlen * sizeof (char));
+      OOM (str);
+    }
+    str[len++] = c;
+    if (c == ';')
+      break;
+  }
+  str[len] = '\0';
+
+  return str;
+}
+
 TREE **read_tree_strings (char *filename)
 {
   FILE *fp;
@@ -738,7 +771,7 @@ TREE **read_tree_strings (char *filename)
   for (int a = 0; a < n_tree; a++) {
     set[a] = malloc (sizeof (TREE));
     OOM (set[a]);
-    set[a]->tstring = ReadString (fp);
+    set[a]->tstring = read_one_tree_string (fp);
     set[a]->n_sp = n_sp;
     set[a]->n_br = 0;
     set[a]->tree = NULL;
@@ -796,8 +829,7 @@ NODE * find_leaf_by_name ( const char * name, const TREE * tree){
    CheckIsTree(tree);
    assert(NULL!=name);
 
-   NODE * leaf = (NODE *) getelt_rbtree(tree->leaves,name);
-   return leaf;
+   return lookup_leaf(name,tree);
 }
 
 
@@ -38,16 +38,14 @@
                   exit (EXIT_FAILURE); }
 #endif
 
-#ifndef _RBTREE_H_
-#include "rbtree.h"
-#endif
-
 #ifndef _VEC_H_
 #include "vec.h"
 #endif
 
 
 
+struct ambiguity_table;
+
 struct node {
         struct node **   branch;
         double          * blength;
@@ -72,7 +70,17 @@ typedef struct {
         char * tstring;
         NODE * tree;
         NODE ** branches;
-        RBTREE leaves;
+        NODE ** leaves;         /* In order of appearance in tstring */
+        /*  Storage for all nodes, their connections and leaf names */
+        NODE * nodes;
+        NODE ** branch_pool;
+        double * blength_pool;
+        char * name_pool;
+        /*  Open addressed table of leaves by name, size a power of two */
+        NODE ** leaf_hash;
+        unsigned int hash_size;
+        /*  Ambiguity codes of the data at the leaves */
+        struct ambiguity_table * ambig;
 } TREE;
 
 
@@ -81,6 +89,7 @@ void Recurse_backward ( const TREE * tree, void (*fun)(void *, int,int), void *i
 void CheckIsTree ( const TREE * tree);
 void create_tree (TREE * tree);
 void fprint_tree ( FILE * out, const NODE * node, const NODE * parent, const TREE * tree);
+char * topology_string ( const TREE * tree);
 int find_branch_number ( const NODE * branch, const TREE * tree);
 int find_connection ( const NODE * from, const NODE * to);
 int add_lengths_to_tree ( TREE * tree, double *lengths);
@@ -89,7 +98,6 @@ void ScaleTree ( TREE * tree, const double f);
 TREE * CopyTree ( const TREE * tree);
 TREE * CloneTree ( TREE * tree);
 void FreeTree ( TREE * tree);
-void FreeNode( NODE * node, NODE * parent);
 
 TREE ** read_tree_strings ( char * filename);
 TREE * copy_tree_strings ( const TREE * tree );
@@ -21,6 +21,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include "tree.h"
 #include "data.h"
@@ -28,49 +29,70 @@
 #include "bases.h"
 #include "tree_data.h"
 #include "utility.h"
-#include "rbtree.h"
 
 
 static int memadd_plik_tree ( TREE * tree, const int npt, const int exact_obs, const int nbase);
 static int memfree_plik_tree ( TREE * tree);
 static int memadd_seq_tree ( TREE * tree, const int size);
 static int memfree_seq_tree ( TREE * tree);
+static void set_leaf_plik ( double * plik, const int base, const MODEL * model, const struct ambiguity_table * ambig);
+static void use_ambiguities ( TREE * tree, const DATA_SET * data);
 
 
 void add_single_site_to_tree ( TREE * tree, const DATA_SET * data, const MODEL * model, const int a){
-        double b;
-
         CheckIsTree(tree);
+        /*  Other sites at the leaves keep their codes */
+        assert(NULL==tree->ambig || tree->ambig==data->ambig);
+        use_ambiguities(tree,data);
 
         for ( unsigned int i=0 ; i<data->n_sp ; i++){
 	    NODE * leaf = find_leaf(i,tree,data);
-	    leaf->seq[a] = data->seq[i][a];
+	    leaf->seq[a] = DATA_SEQ(data, i, a);
 	}
         if ( model->exact_obs != 1)
                 for ( unsigned int i=0 ; i<data->n_sp ; i++){
 			NODE * leaf = find_leaf(i,tree,data);
-                        if(data->seq[i][a] != GapChar(model->seqtype))
-                                b = 0.;
-                        else
-                                b = 1.;
-                        for ( unsigned int j=0 ; j<model->nbase ; j++)
-                                leaf->plik[j] = b;
-                        if (data->seq[i][a] != GapChar(model->seqtype))
-                                leaf->plik[a] = 1.;
+			set_leaf_plik(leaf->plik + a * model->nbase, DATA_SEQ(data, i, a), model, tree->ambig);
                 }
 
         CheckIsTree(tree);
 }
 
+/*  Likelihood of each base given an observation at a tip: one for every base
+ * compatible with it.
+ */
+static void set_leaf_plik ( double * plik, const int base, const MODEL * model, const struct ambiguity_table * ambig){
+        if ( IsAmbiguous(base)){
+                const struct ambiguity * amb = Ambiguity(ambig, base);
+                memset(plik, 0, model->nbase * sizeof(double));
+                for ( int k=0 ; k<amb->n ; k++)
+                        plik[amb->base[k]] = 1.;
+        } else if ( base != GapChar(model->seqtype)){
+                memset(plik, 0, model->nbase * sizeof(double));
+                plik[base] = 1.;
+        } else {
+                for ( unsigned int j=0 ; j<model->nbase ; j++)
+                        plik[j] = 1.;
+        }
+}
+
+/*  Codes at the leaves are those of the data last added */
+static void use_ambiguities ( TREE * tree, const DATA_SET * data){
+        if ( tree->ambig != data->ambig){
+                FreeAmbiguityTable(tree->ambig);
+                tree->ambig = ShareAmbiguityTable(data->ambig);
+        }
+}
+
 int add_data_to_tree (const DATA_SET * data_old, TREE * tree, MODEL * model)
 {
-  double *tmp;
   const DATA_SET *data;
 
   CheckIsTree (tree);
   CheckIsDataSet (data_old);
 
   data = data_old;
+  use_ambiguities (tree, data);
 
   model->n_unique_pts = data->n_unique_pts;
   model->n_pts = data->n_pts;
@@ -99,9 +121,8 @@ int add_data_to_tree (const DATA_SET * data_old, TREE * tree, MODEL * model)
 
 
   /* Flag each leaf so we can tell whether it has been visited or not */
-  for ( RBITER iter = iter_rbtree(tree->leaves) ; next_rbtree(iter) ; ){
-      const NODE * leaf = (const NODE *) itervalue_rbtree(iter);
-      leaf->seq[0] = -1;
+  for ( unsigned int i=0 ; i<tree->n_sp ; i++){
+      tree->leaves[i]->seq[0] = -1;
   }
 
   /* Add sequence to tree */
@@ -117,23 +138,22 @@ int add_data_to_tree (const DATA_SET * data_old, TREE * tree, MODEL * model)
        continue;
     }
     for (unsigned int b = 0; b < data->n_unique_pts; b++)
-      leaf->seq[b] = data->seq[a][b];
+      leaf->seq[b] = DATA_SEQ(data, a, b);
   }
   if(missing_species){fputc('\n',stdout);}
 
   /*  Go through all leaves in tree and fill in those that do not have sequence with gaps */
   const int gapc = GapChar(data->seq_type);
   bool missing_sequence = false;
-  for ( RBITER iter = iter_rbtree(tree->leaves) ; next_rbtree(iter) ; ){
-      const char * name = (const char *) iterkey_rbtree(iter);
-      const NODE * leaf = (const NODE *) itervalue_rbtree(iter);
+  for ( unsigned int i=0 ; i<tree->n_sp ; i++){
+      const NODE * leaf = tree->leaves[i];
 
       if ( leaf->seq[0] == -1 ){
          if ( false == missing_sequence ){
             printf("#  Species in tree with no sequence. Will be replaced by blank sequence: ");
             missing_sequence = true;
          }
-         printf("%s ",name);
+         printf("%s ",leaf->name);
 
          for ( unsigned int b=0 ; b<data->n_unique_pts ; b++){
             leaf->seq[b] = gapc;
@@ -141,17 +161,8 @@ int add_data_to_tree (const DATA_SET * data_old, TREE * tree, MODEL * model)
       }
 
       if (model->exact_obs != 1){
-         unsigned int b;
-         for (b = 0, tmp = leaf->plik; b < data->n_unique_pts * model->nbase; b++, tmp++) *tmp = 0.;
-             tmp = leaf->plik;
-             for (unsigned int b = 0; b < data->n_unique_pts; b++) {
-                 /*  Deal with non-gap */
-                 if (leaf->seq[b] != gapc)
-                    tmp[b * model->nbase + leaf->seq[b]] = 1.0;
-                 else
-                    for (unsigned int c = 0; c < model->nbase; c++)
-                       tmp[b * model->nbase + c] = 1.0;
-             }
+         for (unsigned int b = 0; b < data->n_unique_pts; b++)
+            set_leaf_plik(leaf->plik + b * model->nbase, leaf->seq[b], model, tree->ambig);
       }
   }
   if ( missing_sequence ){ fputc('\n',stdout); }
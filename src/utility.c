@@ -26,6 +26,10 @@
 #include <float.h>
 #include <ctype.h>
 #include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "utility.h"
 
 #ifndef OOM
@@ -372,3 +376,38 @@ FILE * fopen_with_suffix(const char * prefix, const char * suffix, const char *
     free(fname);
     return fp;
 }
+
+/*  64-bit FNV-1a hash of a block of memory, continuing from h. Start from
+ *  FNV_OFFSET to hash several blocks as one.
+ */
+uint64_t fnv1a_hash(uint64_t h, const void * p, const size_t len){
+    const unsigned char * c = p;
+    for ( size_t i=0 ; i<len ; i++){
+        h ^= c[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+/*  FNV-1a hash of the contents of a file, continuing from h. Returns false if
+ *  the file cannot be read.
+ */
+bool fnv1a_hash_file(uint64_t * h, const char * name){
+    struct stat st;
+    const int fd = open(name, O_RDONLY);
+    if ( -1==fd ){ return false; }
+    if ( 0!=fstat(fd,&st) ){
+        close(fd);
+        return false;
+    }
+    if ( 0==st.st_size ){
+        close(fd);
+        return true;
+    }
+    void * map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if ( MAP_FAILED==map ){ return false; }
+    *h = fnv1a_hash(*h, map, st.st_size);
+    munmap(map, st.st_size);
+    return true;
+}
@@ -30,6 +30,12 @@
 #include <stdbool.h>
 #endif
 
+#ifndef _STDINT_H_
+#include <stdint.h>
+#endif
+
+#define FNV_OFFSET 14695981039346656037ULL
+
 void slrwarn ( int i, char * s);
 void PrintMatrix ( const double * m, const int n);
 void PrintVector ( const double * x, const int n);
@@ -59,5 +65,7 @@ double * CopyVector ( const double * A, double * B, const unsigned int n);
 unsigned int sum_bool ( const bool * x, const unsigned int n);
 
 FILE * fopen_with_suffix(const char * prefix, const char * suffix, const char * mode);
+uint64_t fnv1a_hash(uint64_t h, const void * p, const size_t len);
+bool fnv1a_hash_file(uint64_t * h, const char * name);
 
 #endif